@@ -0,0 +1,214 @@
+	.file	"biosdisk.c"
+	.text
+	.type	call_int13h, @function
+call_int13h:
+#APP
+# 43 "disk/biosdisk.c" 1
+	pushf
+	pop %rax
+	
+# 0 "" 2
+#NO_APP
+	andl	$-514, %eax
+	movl	$19, (%rdi)
+	orb	$2, %ah
+	movl	%eax, 60(%rdi)
+	ret
+	.size	call_int13h, .-call_int13h
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"attempt to read outside of hd%2x\n"
+.LC1:
+	.string	"failure reading sector 0x%llx from hd%2x\n"
+	.text
+	.globl	biosdisk_read
+	.hidden	biosdisk_read
+	.type	biosdisk_read, @function
+biosdisk_read:
+	pushq	%r12
+	movq	%rcx, %r9
+	movq	%rdx, %r8
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	pushq	%rbx
+	subq	$80, %rsp
+	movq	24+disk_data(%rip), %rdi
+	movl	48+disk_data(%rip), %ecx
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 72(%rsp)
+	xorl	%eax, %eax
+	movq	8+disk_data(%rip), %r11
+	leaq	511(%rdx), %rax
+	movq	16+disk_data(%rip), %rbx
+	movq	%rdi, %rdx
+	shrq	$9, %rax
+	movq	32+disk_data(%rip), %r10
+	salq	%cl, %rdx
+	movq	%rdi, %rcx
+	movl	%eax, %eax
+	imulq	%r11, %rcx
+	addq	$196608, %rdx
+	imulq	%rbx, %rcx
+.L4:
+	testb	$1, %r10b
+	je	.L3
+	movw	$16, (%rdx)
+	andq	$-2, %r10
+	movq	%rcx, %rbp
+	movb	$1, %r12b
+	movw	%ax, 2(%rdx)
+	movl	$805306368, 4(%rdx)
+	movq	%rsi, 8(%rdx)
+	jmp	.L4
+.L3:
+	testb	%r12b, %r12b
+	je	.L5
+	movq	%r10, 32+disk_data(%rip)
+	movq	%rbp, 40+disk_data(%rip)
+.L5:
+	movl	disk_data(%rip), %ecx
+	cmpq	$16515072, %rsi
+	ja	.L19
+	movq	%rsi, %rax
+	xorl	%edx, %edx
+	divq	%rdi
+	xorl	%edx, %edx
+	leaq	8(%rsp), %rdi
+	divq	%rbx
+	movl	$3, %edx
+	cmpq	%r11, %rax
+	jb	.L8
+.L19:
+	movl	%ecx, %esi
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L7:
+	xorl	%eax, %eax
+	jmp	.L2
+.L8:
+	call	call_int13h
+	testb	$1, 68(%rsp)
+	jne	.L10
+	movq	%r8, %rdx
+	movq	%r9, %rdi
+	movl	$196608, %esi
+	call	memcpy
+	movl	$1, %eax
+	jmp	.L2
+.L10:
+	decl	%edx
+	jne	.L8
+	movl	%ecx, %edx
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L7
+.L2:
+	movq	72(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L11
+	call	__stack_chk_fail@PLT
+.L11:
+	addq	$80, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	biosdisk_read, .-biosdisk_read
+	.section	.rodata.str1.1
+.LC2:
+	.string	"hd%2x cannot get C/H/S values.\n"
+.LC3:
+	.string	"read error when probing drive 0x%2x\n"
+	.text
+	.globl	biosdisk_iterate
+	.hidden	biosdisk_iterate
+	.type	biosdisk_iterate, @function
+biosdisk_iterate:
+	pushq	%rbp
+	pushq	%rbx
+	movl	$128, %ebx
+	subq	$88, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 72(%rsp)
+	xorl	%eax, %eax
+	leaq	8(%rsp), %rbp
+.L22:
+	movl	$3, %edx
+.L25:
+	movq	%rbp, %rdi
+	call	call_int13h
+	testb	$1, 68(%rsp)
+	jne	.L23
+	movl	$56, %edx
+	xorl	%esi, %esi
+	leaq	disk_data(%rip), %rdi
+	call	memset
+	movl	%ebx, disk_data(%rip)
+	movl	%ebx, %esi
+	xorl	%eax, %eax
+	leaq	.LC2(%rip), %rdi
+	incl	%ebx
+	movl	$9, 48+disk_data(%rip)
+	call	printf
+	cmpl	$144, %ebx
+	jne	.L22
+	jmp	.L33
+.L23:
+	decl	%edx
+	jne	.L25
+	movq	72(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	jne	.L32
+	addq	$88, %rsp
+	movl	%ebx, %esi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	popq	%rbx
+	popq	%rbp
+	jmp	printf
+.L33:
+	movq	72(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L27
+.L32:
+	call	__stack_chk_fail@PLT
+.L27:
+	addq	$88, %rsp
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	biosdisk_iterate, .-biosdisk_iterate
+	.section	.rodata.str1.1
+.LC4:
+	.string	"scratch addr 0x%x\n"
+	.text
+	.globl	biosdisk_init
+	.hidden	biosdisk_init
+	.type	biosdisk_init, @function
+biosdisk_init:
+	pushq	%rax
+	movl	$196608, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movl	$4, %edx
+	xorl	%esi, %esi
+	popq	%rcx
+	movl	$196608, %edi
+	jmp	memset
+	.size	biosdisk_init, .-biosdisk_init
+	.globl	biosdisk_fini
+	.hidden	biosdisk_fini
+	.type	biosdisk_fini, @function
+biosdisk_fini:
+	ret
+	.size	biosdisk_fini, .-biosdisk_fini
+	.local	disk_data
+	.comm	disk_data,56,32
+	.hidden	memset
+	.hidden	memcpy
+	.hidden	printf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -1,8 +1,11 @@
 # Objects
+OBJECTS += disk/diskfile.o
 OBJECTS += disk/efidisk.o
+OBJECTS += disk/fat.o
 OBJECTS += disk/fsuuid.o
 OBJECTS += disk/gpt.o
 OBJECTS += disk/msdos.o
+OBJECTS += disk/ntfs.o
 
 OBJECTS += disk/biosdisk.o
 
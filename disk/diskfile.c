@@ -0,0 +1,372 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Files on the physical partition
+ *
+ * A file is resolved once to a list of partition extents by a
+ * minimal read-only filesystem driver, and its data is then fetched
+ * through the firmware disk services only when it is actually read.
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wctype.h>
+#include "diskfile.h"
+#include "ntloader.h"
+
+/** Maximum number of sectors per disk read
+ *
+ * The BIOS disk driver bounces through a scratch area which also
+ * holds its disk address packet, so keep each request well within it.
+ */
+#define DISKFILE_MAX_SECTORS 32
+
+/** Partition holding the files */
+static struct
+{
+    /** Disk handle */
+    void *disk;
+    /** Starting LBA */
+    uint64_t lba;
+    /** Read method */
+    int (*disk_read) (void *disk, uint64_t sector, size_t len, void *buf);
+} diskfile_part;
+
+/**
+ * Record partition holding the files
+ *
+ * @v disk		Disk handle
+ * @v lba		Starting LBA
+ * @v disk_read		Read method
+ */
+void diskfile_set_partition (void *disk, uint64_t lba,
+                             int (*disk_read) (void *disk, uint64_t sector,
+                                               size_t len, void *buf))
+{
+    diskfile_part.disk = disk;
+    diskfile_part.lba = lba;
+    diskfile_part.disk_read = disk_read;
+}
+
+/**
+ * Read sectors from partition
+ *
+ * @v sector		Starting sector within partition
+ * @v count		Number of sectors
+ * @v data		Data buffer
+ * @ret rc		Return status code
+ */
+int diskfile_read_sectors (uint64_t sector, unsigned int count, void *data)
+{
+    unsigned int frag;
+
+    if (! diskfile_part.disk_read)
+        return -1;
+
+    while (count)
+    {
+        frag = ((count > DISKFILE_MAX_SECTORS) ?
+                DISKFILE_MAX_SECTORS : count);
+        if (! diskfile_part.disk_read (diskfile_part.disk,
+                                       (diskfile_part.lba + sector),
+                                       (frag * DISKFILE_SECTOR_SIZE), data))
+            return -1;
+        sector += frag;
+        count -= frag;
+        data += (frag * DISKFILE_SECTOR_SIZE);
+    }
+    return 0;
+}
+
+/**
+ * Append extent to file
+ *
+ * @v file		File
+ * @v lba		Starting sector within partition (or DISKFILE_HOLE)
+ * @v count		Number of sectors
+ * @ret rc		Return status code
+ */
+int diskfile_add_extent (struct diskfile *file, uint64_t lba, uint64_t count)
+{
+    struct diskfile_extent *extent;
+    struct diskfile_extent *extents;
+    uint64_t start = 0;
+    unsigned int max;
+
+    if (! count)
+        return 0;
+
+    /* Merge with previous extent, if contiguous */
+    if (file->count)
+    {
+        extent = &file->extents[file->count - 1];
+        start = (extent->start + extent->count);
+        if (((lba == DISKFILE_HOLE) && (extent->lba == DISKFILE_HOLE)) ||
+            ((lba != DISKFILE_HOLE) && (extent->lba != DISKFILE_HOLE) &&
+             ((extent->lba + extent->count) == lba)))
+        {
+            extent->count += count;
+            return 0;
+        }
+    }
+
+    /* Grow extent list, if necessary */
+    if (file->count == file->max)
+    {
+        max = (file->max ? (file->max * 2) : 16);
+        extents = realloc (file->extents, (max * sizeof (extents[0])));
+        if (! extents)
+            return -1;
+        file->extents = extents;
+        file->max = max;
+    }
+
+    extent = &file->extents[file->count++];
+    extent->start = start;
+    extent->lba = lba;
+    extent->count = count;
+    return 0;
+}
+
+/**
+ * Free file extents
+ *
+ * @v file		File
+ */
+void diskfile_free_extents (struct diskfile *file)
+{
+    free (file->extents);
+    free (file->data);
+    file->extents = NULL;
+    file->data = NULL;
+    file->count = 0;
+    file->max = 0;
+}
+
+/**
+ * Compare name against wide-character name, case-insensitively
+ *
+ * @v name		Name
+ * @v len		Length of name
+ * @v wname		Wide-character name
+ * @v wlen		Length of wide-character name
+ * @ret match		Names match
+ */
+int diskfile_match (const char *name, size_t len,
+                    const uint16_t *wname, size_t wlen)
+{
+    size_t i;
+
+    if (len != wlen)
+        return 0;
+    for (i = 0 ; i < len ; i++)
+    {
+        if (towupper ((unsigned char) name[i]) != towupper (wname[i]))
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ * Get next path component
+ *
+ * @v path		Path (updated to follow component)
+ * @v len		Length of component to fill in
+ * @ret name		Component, or NULL at end of path
+ */
+const char *diskfile_next_name (const char **path, size_t *len)
+{
+    const char *name;
+    const char *end;
+
+    for (name = *path ; ((*name == '\\') || (*name == '/')) ; name++)
+        ;
+    if (! *name)
+        return NULL;
+    for (end = name ; (*end && (*end != '\\') && (*end != '/')) ; end++)
+        ;
+    *len = (end - name);
+    *path = end;
+    return name;
+}
+
+/**
+ * Find extent containing file sector
+ *
+ * @v file		File
+ * @v sector		Sector within file
+ * @ret extent		Extent, or NULL
+ */
+static struct diskfile_extent *diskfile_find_extent (struct diskfile *file,
+                                                     uint64_t sector)
+{
+    struct diskfile_extent *extent;
+    unsigned int lo = 0;
+    unsigned int hi = file->count;
+    unsigned int mid;
+
+    while (lo < hi)
+    {
+        mid = ((lo + hi) / 2);
+        extent = &file->extents[mid];
+        if (sector < extent->start)
+            hi = mid;
+        else if (sector >= (extent->start + extent->count))
+            lo = (mid + 1);
+        else
+            return extent;
+    }
+    return NULL;
+}
+
+/**
+ * Read data from file
+ *
+ * @v file		File
+ * @v data		Data buffer
+ * @v offset		Offset
+ * @v len		Length
+ * @ret rc		Return status code
+ */
+int diskfile_pread (struct diskfile *file, void *data,
+                    uint64_t offset, size_t len)
+{
+    uint8_t sector_buf[DISKFILE_SECTOR_SIZE];
+    struct diskfile_extent *extent;
+    uint64_t sector;
+    uint64_t lba;
+    uint64_t count;
+    size_t skip;
+    size_t frag_len;
+    size_t zero_len = 0;
+
+    /* Zero any uninitialised-data portion */
+    if ((offset + len) > file->valid)
+    {
+        zero_len = ((offset < file->valid) ?
+                    ((offset + len) - file->valid) : len);
+        len -= zero_len;
+        memset ((data + len), 0, zero_len);
+    }
+
+    /* Copy resident data */
+    if (file->data)
+    {
+        memcpy (data, (file->data + offset), len);
+        return 0;
+    }
+
+    while (len)
+    {
+        sector = (offset / DISKFILE_SECTOR_SIZE);
+        skip = (offset % DISKFILE_SECTOR_SIZE);
+        extent = diskfile_find_extent (file, sector);
+        if (! extent)
+        {
+            DBG ("no extent for file sector %#llx\n",
+                 ((unsigned long long) sector));
+            return -1;
+        }
+        count = (extent->start + extent->count - sector);
+        lba = ((extent->lba == DISKFILE_HOLE) ? DISKFILE_HOLE :
+               (extent->lba + (sector - extent->start)));
+
+        if ((skip == 0) && (len >= DISKFILE_SECTOR_SIZE))
+        {
+            /* Read whole sectors directly into buffer */
+            if (count > (len / DISKFILE_SECTOR_SIZE))
+                count = (len / DISKFILE_SECTOR_SIZE);
+            frag_len = (count * DISKFILE_SECTOR_SIZE);
+            if (lba == DISKFILE_HOLE)
+                memset (data, 0, frag_len);
+            else if (diskfile_read_sectors (lba, count, data) != 0)
+                return -1;
+        }
+        else
+        {
+            /* Bounce partial sector */
+            frag_len = (DISKFILE_SECTOR_SIZE - skip);
+            if (frag_len > len)
+                frag_len = len;
+            if (lba == DISKFILE_HOLE)
+                memset (sector_buf, 0, sizeof (sector_buf));
+            else if (diskfile_read_sectors (lba, 1, sector_buf) != 0)
+                return -1;
+            memcpy (data, (sector_buf + skip), frag_len);
+        }
+
+        data += frag_len;
+        offset += frag_len;
+        len -= frag_len;
+    }
+    return 0;
+}
+
+/**
+ * Open file on partition
+ *
+ * @v path		Path
+ * @ret file		File, or NULL on error
+ */
+struct diskfile *diskfile_open (const char *path)
+{
+    union volume_boot_record vbr;
+    struct diskfile *file;
+    int rc;
+
+    if (! diskfile_part.disk_read)
+    {
+        DBG ("no partition for %s\n", path);
+        return NULL;
+    }
+    if (diskfile_read_sectors (0, 1, &vbr) != 0)
+        return NULL;
+
+    file = malloc (sizeof (*file));
+    if (! file)
+        return NULL;
+    memset (file, 0, sizeof (*file));
+
+    if ((memcmp (vbr.exfat.oem_name, "EXFAT", 5) == 0) ||
+        (memcmp (vbr.fat.version.fat32.fstype, "FAT32", 5) == 0))
+        rc = fat_open (file, path, &vbr);
+    else if (memcmp (vbr.ntfs.oem_name, "NTFS", 4) == 0)
+        rc = ntfs_open (file, path, &vbr);
+    else
+    {
+        DBG ("unsupported filesystem for %s\n", path);
+        rc = -1;
+    }
+
+    if (rc != 0)
+    {
+        diskfile_free_extents (file);
+        free (file);
+        return NULL;
+    }
+
+    DBG ("...found %s len %#llx in %d extents\n", path,
+          (unsigned long long) file->len, file->count);
+    return file;
+}
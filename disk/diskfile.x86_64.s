@@ -0,0 +1,542 @@
+	.file	"diskfile.c"
+	.text
+	.globl	diskfile_set_partition
+	.hidden	diskfile_set_partition
+	.type	diskfile_set_partition, @function
+diskfile_set_partition:
+	movq	%rdi, diskfile_part(%rip)
+	movq	%rsi, 8+diskfile_part(%rip)
+	movq	%rdx, 16+diskfile_part(%rip)
+	ret
+	.size	diskfile_set_partition, .-diskfile_set_partition
+	.globl	diskfile_read_sectors
+	.hidden	diskfile_read_sectors
+	.type	diskfile_read_sectors, @function
+diskfile_read_sectors:
+	cmpq	$0, 16+diskfile_part(%rip)
+	je	.L16
+	pushq	%r14
+	pushq	%r13
+	movq	%rdx, %r13
+	pushq	%r12
+	movq	%rdi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	movl	%esi, %ebx
+.L3:
+	testl	%ebx, %ebx
+	je	.L17
+	movl	$32, %ebp
+	movq	8+diskfile_part(%rip), %rsi
+	movq	diskfile_part(%rip), %rdi
+	movq	%r13, %rcx
+	cmpl	%ebp, %ebx
+	cmovbe	%ebx, %ebp
+	addq	%r12, %rsi
+	movl	%ebp, %r14d
+	sall	$9, %r14d
+	movq	%r14, %rdx
+	call	*16+diskfile_part(%rip)
+	testl	%eax, %eax
+	jne	.L18
+	orl	$-1, %eax
+	jmp	.L2
+.L18:
+	movl	%ebp, %eax
+	subl	%ebp, %ebx
+	addq	%r14, %r13
+	addq	%rax, %r12
+	jmp	.L3
+.L17:
+	xorl	%eax, %eax
+.L2:
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+.L16:
+	orl	$-1, %eax
+	ret
+	.size	diskfile_read_sectors, .-diskfile_read_sectors
+	.globl	diskfile_add_extent
+	.hidden	diskfile_add_extent
+	.type	diskfile_add_extent, @function
+diskfile_add_extent:
+	testq	%rdx, %rdx
+	je	.L41
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	movq	%rsi, %r12
+	pushq	%rbp
+	movq	%rdx, %rbp
+	pushq	%rbx
+	movl	24(%rdi), %edx
+	movq	%rdi, %rbx
+	movq	32(%rdi), %rdi
+	testl	%edx, %edx
+	je	.L27
+	leal	-1(%rdx), %eax
+	imulq	$24, %rax, %rax
+	addq	%rdi, %rax
+	movq	16(%rax), %rcx
+	movq	(%rax), %r13
+	movq	8(%rax), %rsi
+	addq	%rcx, %r13
+	cmpq	$-1, %r12
+	jne	.L22
+	incq	%rsi
+	jmp	.L45
+.L22:
+	cmpq	$-1, %rsi
+	je	.L21
+	addq	%rcx, %rsi
+	cmpq	%r12, %rsi
+.L45:
+	jne	.L21
+	addq	%rbp, %rcx
+	movq	%rcx, 16(%rax)
+.L20:
+	xorl	%edx, %edx
+	jmp	.L19
+.L27:
+	xorl	%r13d, %r13d
+.L21:
+	cmpl	28(%rbx), %edx
+	jne	.L25
+	movl	$16, %r14d
+	testl	%edx, %edx
+	je	.L26
+	leal	(%rdx,%rdx), %r14d
+.L26:
+	movl	%r14d, %esi
+	imulq	$24, %rsi, %rsi
+	call	realloc
+	orl	$-1, %edx
+	testq	%rax, %rax
+	je	.L19
+	movq	%rax, 32(%rbx)
+	movl	%r14d, 28(%rbx)
+.L25:
+	movl	24(%rbx), %eax
+	leal	1(%rax), %edx
+	imulq	$24, %rax, %rax
+	addq	32(%rbx), %rax
+	movl	%edx, 24(%rbx)
+	movq	%r13, (%rax)
+	movq	%r12, 8(%rax)
+	movq	%rbp, 16(%rax)
+	jmp	.L20
+.L19:
+	popq	%rbx
+	movl	%edx, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+.L41:
+	xorl	%eax, %eax
+	ret
+	.size	diskfile_add_extent, .-diskfile_add_extent
+	.globl	diskfile_free_extents
+	.hidden	diskfile_free_extents
+	.type	diskfile_free_extents, @function
+diskfile_free_extents:
+	pushq	%rbx
+	movq	%rdi, %rbx
+	movq	32(%rdi), %rdi
+	call	free
+	movq	16(%rbx), %rdi
+	call	free
+	xorl	%eax, %eax
+	movq	%rax, 16(%rbx)
+	movq	%rax, 24(%rbx)
+	movq	%rax, 32(%rbx)
+	popq	%rbx
+	ret
+	.size	diskfile_free_extents, .-diskfile_free_extents
+	.globl	diskfile_match
+	.hidden	diskfile_match
+	.type	diskfile_match, @function
+diskfile_match:
+	xorl	%eax, %eax
+	cmpq	%rcx, %rsi
+	jne	.L48
+	xorl	%eax, %eax
+.L50:
+	cmpq	%rsi, %rax
+	je	.L56
+	movzbl	(%rdi,%rax), %ecx
+	leal	-97(%rcx), %r8d
+	cmpl	$25, %r8d
+	ja	.L51
+	subl	$32, %ecx
+.L51:
+	movzwl	(%rdx,%rax,2), %r8d
+	leal	-97(%r8), %r9d
+	cmpl	$25, %r9d
+	ja	.L52
+	subl	$32, %r8d
+.L52:
+	cmpl	%ecx, %r8d
+	jne	.L55
+	incq	%rax
+	jmp	.L50
+.L56:
+	movl	$1, %eax
+	ret
+.L55:
+	xorl	%eax, %eax
+.L48:
+	ret
+	.size	diskfile_match, .-diskfile_match
+	.globl	diskfile_next_name
+	.hidden	diskfile_next_name
+	.type	diskfile_next_name, @function
+diskfile_next_name:
+	movq	(%rdi), %rax
+.L58:
+	movb	(%rax), %dl
+	cmpb	$92, %dl
+	jne	.L69
+.L59:
+	incq	%rax
+	jmp	.L58
+.L69:
+	cmpb	$47, %dl
+	je	.L59
+	testb	%dl, %dl
+	je	.L64
+	movq	%rax, %rdx
+.L61:
+	movb	(%rdx), %cl
+	testb	%cl, %cl
+	setne	%r9b
+	cmpb	$92, %cl
+	setne	%r8b
+	testb	%r8b, %r9b
+	je	.L65
+	cmpb	$47, %cl
+	je	.L65
+	incq	%rdx
+	jmp	.L61
+.L65:
+	movq	%rdx, %rcx
+	subq	%rax, %rcx
+	movq	%rcx, (%rsi)
+	movq	%rdx, (%rdi)
+	ret
+.L64:
+	xorl	%eax, %eax
+	ret
+	.size	diskfile_next_name, .-diskfile_next_name
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"no extent for file sector %#llx\n"
+	.text
+	.globl	diskfile_pread
+	.hidden	diskfile_pread
+	.type	diskfile_pread, @function
+diskfile_pread:
+	pushq	%r15
+	pushq	%r14
+	movq	%rdi, %r14
+	pushq	%r13
+	movq	%rdx, %r13
+	pushq	%r12
+	movq	%rsi, %r12
+	pushq	%rbp
+	movq	%rcx, %rbp
+	addq	%rdx, %rcx
+	pushq	%rbx
+	subq	$536, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 520(%rsp)
+	xorl	%eax, %eax
+	movq	8(%rdi), %rax
+	cmpq	%rcx, %rax
+	jnb	.L71
+	movq	%rbp, %rdx
+	cmpq	%rax, %r13
+	jnb	.L72
+	subq	%rax, %rcx
+	movq	%rcx, %rdx
+.L72:
+	subq	%rdx, %rbp
+	xorl	%esi, %esi
+	leaq	(%r12,%rbp), %rdi
+	call	memset
+.L71:
+	movq	16(%r14), %rsi
+	testq	%rsi, %rsi
+	je	.L73
+	addq	%r13, %rsi
+	movq	%rbp, %rdx
+	movq	%r12, %rdi
+	call	memcpy
+	jmp	.L74
+.L77:
+	subq	%rsi, %rax
+	cmpq	$511, %rbp
+	movq	8(%rdx), %rdi
+	seta	%dl
+	testq	%r15, %r15
+	sete	%cl
+	andl	%ecx, %edx
+	cmpq	$-1, %rdi
+	jne	.L80
+	testb	%dl, %dl
+	je	.L81
+	movq	%rbp, %rbx
+	shrq	$9, %rbx
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+	salq	$9, %rbx
+.L82:
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	memset
+.L86:
+	addq	%rbx, %r12
+	addq	%rbx, %r13
+	subq	%rbx, %rbp
+.L73:
+	testq	%rbp, %rbp
+	je	.L74
+	movq	%r13, %rsi
+	movq	%r13, %r15
+	movl	24(%r14), %edi
+	xorl	%eax, %eax
+	shrq	$9, %rsi
+	andl	$511, %r15d
+.L76:
+	cmpl	%edi, %eax
+	jnb	.L101
+	leal	(%rdi,%rax), %ecx
+	shrl	%ecx
+	movl	%ecx, %edx
+	imulq	$24, %rdx, %rdx
+	addq	32(%r14), %rdx
+	movq	(%rdx), %r8
+	cmpq	%r8, %rsi
+	jb	.L94
+	movq	16(%rdx), %rax
+	addq	%r8, %rax
+	cmpq	%rax, %rsi
+	jb	.L77
+	leal	1(%rcx), %eax
+	jmp	.L76
+.L94:
+	movl	%ecx, %edi
+	jmp	.L76
+.L101:
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L79
+.L81:
+	movl	$512, %ebx
+	subq	%r15, %rbx
+	cmpq	%rbp, %rbx
+	cmova	%rbp, %rbx
+	jmp	.L83
+.L80:
+	addq	%rsi, %rdi
+	subq	%r8, %rdi
+	testb	%dl, %dl
+	je	.L84
+	movq	%rbp, %rsi
+	shrq	$9, %rsi
+	cmpq	%rax, %rsi
+	cmova	%rax, %rsi
+	movq	%rsi, %rbx
+	salq	$9, %rbx
+	cmpq	$-1, %rdi
+	je	.L82
+	movq	%r12, %rdx
+	call	diskfile_read_sectors
+	testl	%eax, %eax
+	je	.L86
+.L79:
+	orl	$-1, %eax
+	jmp	.L70
+.L84:
+	movl	$512, %ebx
+	subq	%r15, %rbx
+	cmpq	%rbp, %rbx
+	cmova	%rbp, %rbx
+	cmpq	$-1, %rdi
+	jne	.L88
+.L83:
+	leaq	8(%rsp), %rdi
+	movl	$512, %edx
+	xorl	%esi, %esi
+	call	memset
+	jmp	.L89
+.L88:
+	leaq	8(%rsp), %rdx
+	movl	$1, %esi
+	call	diskfile_read_sectors
+	testl	%eax, %eax
+	jne	.L79
+.L89:
+	leaq	8(%rsp,%r15), %rsi
+	movq	%rbx, %rdx
+	movq	%r12, %rdi
+	call	memcpy
+	jmp	.L86
+.L74:
+	xorl	%eax, %eax
+.L70:
+	movq	520(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L92
+	call	__stack_chk_fail@PLT
+.L92:
+	addq	$536, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	diskfile_pread, .-diskfile_pread
+	.section	.rodata.str1.1
+.LC1:
+	.string	"no partition for %s\n"
+.LC2:
+	.string	"EXFAT"
+.LC3:
+	.string	"FAT32"
+.LC4:
+	.string	"NTFS"
+.LC5:
+	.string	"unsupported filesystem for %s\n"
+.LC6:
+	.string	"...found %s len %#llx in %d extents\n"
+	.text
+	.globl	diskfile_open
+	.hidden	diskfile_open
+	.type	diskfile_open, @function
+diskfile_open:
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	movq	%rdi, %rbp
+	pushq	%rbx
+	subq	$536, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 520(%rsp)
+	xorl	%eax, %eax
+	cmpq	$0, 16+diskfile_part(%rip)
+	jne	.L103
+	movq	%rdi, %rsi
+	leaq	.LC1(%rip), %rdi
+	call	printf
+	jmp	.L104
+.L103:
+	leaq	8(%rsp), %r12
+	xorl	%edi, %edi
+	movl	$1, %esi
+	movq	%r12, %rdx
+	call	diskfile_read_sectors
+	testl	%eax, %eax
+	je	.L105
+.L104:
+	xorl	%ebx, %ebx
+	jmp	.L102
+.L105:
+	movl	$40, %edi
+	call	malloc
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L104
+	xorl	%esi, %esi
+	movl	$40, %edx
+	leaq	11(%rsp), %r13
+	movq	%rax, %rdi
+	call	memset
+	movl	$5, %edx
+	leaq	.LC2(%rip), %rsi
+	movq	%r13, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L108
+.L110:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	fat_open
+	jmp	.L109
+.L108:
+	leaq	90(%rsp), %rdi
+	movl	$5, %edx
+	leaq	.LC3(%rip), %rsi
+	call	memcmp
+	testl	%eax, %eax
+	je	.L110
+	movl	$4, %edx
+	leaq	.LC4(%rip), %rsi
+	movq	%r13, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L111
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	ntfs_open
+	jmp	.L109
+.L111:
+	movq	%rbp, %rsi
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L112
+.L109:
+	testl	%eax, %eax
+	je	.L113
+.L112:
+	movq	%rbx, %rdi
+	call	diskfile_free_extents
+	movq	%rbx, %rdi
+	call	free
+	jmp	.L104
+.L113:
+	movl	24(%rbx), %ecx
+	movq	(%rbx), %rdx
+	movq	%rbp, %rsi
+	leaq	.LC6(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L102:
+	movq	520(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L114
+	call	__stack_chk_fail@PLT
+.L114:
+	addq	$536, %rsp
+	movq	%rbx, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	diskfile_open, .-diskfile_open
+	.local	diskfile_part
+	.comm	diskfile_part,24,16
+	.hidden	ntfs_open
+	.hidden	fat_open
+	.hidden	memcmp
+	.hidden	malloc
+	.hidden	printf
+	.hidden	memcpy
+	.hidden	memset
+	.hidden	free
+	.hidden	realloc
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,738 @@
+	.file	"efidisk.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"failure reading sector 0x%llx from %s\n"
+	.text
+	.globl	efidisk_read
+	.hidden	efidisk_read
+	.type	efidisk_read, @function
+efidisk_read:
+	pushq	%r15
+	leaq	4095(%rdx), %r15
+	pushq	%r14
+	movq	%r15, %rax
+	movq	%rcx, %r14
+	pushq	%r13
+	shrq	$12, %rax
+	movq	%rdx, %r13
+	pushq	%r12
+	movq	%rdi, %r12
+	movq	%rax, %rdi
+	pushq	%rbp
+	movq	%rsi, %rbp
+	movl	$2, %esi
+	pushq	%rbx
+	subq	$24, %rsp
+	movq	%rax, 8(%rsp)
+	call	efi_allocate_pages
+	movq	%r15, %r9
+	movq	%rbp, %r8
+	movq	%rax, %rbx
+	movq	40(%r12), %rax
+	andq	$-4096, %r9
+	movq	8(%rax), %rdx
+	pushq	%rcx
+	movq	%rax, %rcx
+	pushq	%rbx
+	movl	(%rdx), %edx
+	subq	$32, %rsp
+	call	*24(%rax)
+	addq	$48, %rsp
+	movq	%r13, %rdx
+	movq	%rbx, %rsi
+	movq	%r14, %rdi
+	movq	%rax, %r15
+	call	memcpy
+	movq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	efi_free_pages
+	movl	$1, %eax
+	testq	%r15, %r15
+	je	.L1
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	xorl	%eax, %eax
+.L1:
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	efidisk_read, .-efidisk_read
+	.type	free_devices, @function
+free_devices:
+	testq	%rdi, %rdi
+	jne	.L13
+	ret
+.L13:
+	pushq	%rbx
+.L10:
+	movq	48(%rdi), %rbx
+	call	efi_free
+	movq	%rbx, %rdi
+	testq	%rbx, %rbx
+	jne	.L10
+	popq	%rbx
+	ret
+	.size	free_devices, .-free_devices
+	.type	compare_device_paths, @function
+compare_device_paths:
+	testq	%rdi, %rdi
+	je	.L30
+	pushq	%r12
+	movl	$1, %eax
+	pushq	%rbp
+	movq	%rsi, %rbp
+	pushq	%rbx
+	testq	%rsi, %rsi
+	je	.L14
+	movq	%rdi, %rbx
+	xorl	%eax, %eax
+	cmpq	%rsi, %rdi
+	je	.L14
+.L16:
+	movzwl	2(%rbx), %r12d
+	movzwl	2(%rbp), %ecx
+	movzwl	%r12w, %eax
+	cmpl	$3, %eax
+	jg	.L35
+.L24:
+	cmpw	$3, 2(%rbx)
+	movw	2(%rbp), %ax
+	jbe	.L36
+	cmpw	$3, %ax
+	setbe	%al
+	movzbl	%al, %eax
+	jmp	.L14
+.L35:
+	cmpw	$3, %cx
+	jbe	.L24
+	movb	(%rbx), %dl
+	movb	0(%rbp), %sil
+	andl	$127, %edx
+	andl	$127, %esi
+	cmpb	%sil, %dl
+	je	.L17
+	movzbl	%sil, %eax
+	movzbl	%dl, %edx
+	jmp	.L34
+.L17:
+	movb	1(%rbx), %sil
+	movzbl	1(%rbp), %edx
+	cmpb	%dl, %sil
+	je	.L18
+	movzbl	%sil, %eax
+.L34:
+	subl	%edx, %eax
+	jmp	.L14
+.L18:
+	cmpw	%cx, %r12w
+	je	.L19
+	subl	%ecx, %eax
+	jmp	.L14
+.L19:
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L14
+	cmpw	$3, 2(%rbx)
+	jbe	.L24
+	movb	(%rbx), %al
+	andl	$127, %eax
+	cmpb	$127, %al
+	jne	.L23
+	cmpb	$-1, 1(%rbx)
+	je	.L24
+.L23:
+	addq	%r12, %rbx
+	addq	%r12, %rbp
+	jmp	.L16
+.L36:
+	cmpw	$3, %ax
+	seta	%al
+	movzbl	%al, %eax
+	negl	%eax
+.L14:
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+.L30:
+	movl	$1, %eax
+	ret
+	.size	compare_device_paths, .-compare_device_paths
+	.type	open_protocol.constprop.0, @function
+open_protocol.constprop.0:
+	subq	$24, %rsp
+	movq	%rsi, %rdx
+	movq	%rdi, %rcx
+	movq	efi_image_handle(%rip), %r9
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 8(%rsp)
+	movq	efi_systab(%rip), %rax
+	movq	96(%rax), %rax
+	pushq	$2
+	pushq	$0
+	subq	$32, %rsp
+	leaq	48(%rsp), %r8
+	call	*280(%rax)
+	addq	$48, %rsp
+	movq	%rax, %rdx
+	movq	(%rsp), %rax
+	testq	%rdx, %rdx
+	je	.L37
+	xorl	%eax, %eax
+.L37:
+	movq	8(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L39
+	call	__stack_chk_fail@PLT
+.L39:
+	addq	$24, %rsp
+	ret
+	.size	open_protocol.constprop.0, .-open_protocol.constprop.0
+	.globl	find_last_device_path
+	.hidden	find_last_device_path
+	.type	find_last_device_path, @function
+find_last_device_path:
+	movq	%rdi, %rax
+	testq	%rdi, %rdi
+	je	.L44
+	movzwl	2(%rdi), %edx
+	cmpw	$3, %dx
+	jbe	.L49
+	movb	(%rdi), %cl
+	andl	$127, %ecx
+	cmpb	$127, %cl
+	jne	.L45
+	cmpb	$-1, 1(%rdi)
+	je	.L49
+.L45:
+	addq	%rax, %rdx
+.L46:
+	movzwl	2(%rdx), %ecx
+	cmpw	$3, %cx
+	jbe	.L44
+	movb	(%rdx), %sil
+	andl	$127, %esi
+	cmpb	$127, %sil
+	je	.L53
+.L47:
+	movq	%rdx, %rax
+	addq	%rcx, %rdx
+	jmp	.L46
+.L53:
+	cmpb	$-1, 1(%rdx)
+	jne	.L47
+	ret
+.L49:
+	xorl	%eax, %eax
+.L44:
+	ret
+	.size	find_last_device_path, .-find_last_device_path
+	.type	add_device, @function
+add_device:
+	pushq	%r12
+	movq	%rsi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+.L55:
+	movq	(%rbx), %r9
+	testq	%r9, %r9
+	je	.L62
+	movq	24(%r12), %rdi
+	call	find_last_device_path
+	movq	24(%r9), %rdi
+	movq	%rax, %r8
+	call	find_last_device_path
+	movq	%r8, %rsi
+	movq	%rax, %rdi
+	call	compare_device_paths
+	testl	%eax, %eax
+	jne	.L56
+	movq	(%rbx), %rax
+	movq	24(%r12), %rsi
+	movq	24(%rax), %rdi
+	call	compare_device_paths
+	testl	%eax, %eax
+	je	.L54
+.L56:
+	testl	%eax, %eax
+	jle	.L58
+.L62:
+	movl	$56, %edi
+	call	efi_malloc
+	movq	%rax, %rbp
+	testq	%rax, %rax
+	je	.L54
+	movl	$56, %edx
+	movq	%r12, %rsi
+	movq	%rax, %rdi
+	call	memcpy
+	movq	(%rbx), %rax
+	movq	%rax, 48(%rbp)
+	movq	%rbp, (%rbx)
+	jmp	.L54
+.L58:
+	movq	(%rbx), %rbx
+	addq	$48, %rbx
+	jmp	.L55
+.L54:
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	add_device, .-add_device
+	.section	.rodata.str1.1
+.LC1:
+	.string	"WARNING: malformed EFI Device Path node."
+	.text
+	.globl	duplicate_device_path
+	.hidden	duplicate_device_path
+	.type	duplicate_device_path, @function
+duplicate_device_path:
+	pushq	%r12
+	movq	%rdi, %rax
+	xorl	%r12d, %r12d
+	pushq	%rbp
+	movq	%rdi, %rbp
+	pushq	%rbx
+.L73:
+	movzwl	2(%rax), %ecx
+	cmpw	$3, %cx
+	ja	.L69
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	xorl	%ebx, %ebx
+	call	printf
+	jmp	.L68
+.L69:
+	movb	(%rax), %dl
+	addq	%rcx, %r12
+	andl	$127, %edx
+	cmpb	$127, %dl
+	jne	.L71
+	cmpb	$-1, 1(%rax)
+	je	.L72
+.L71:
+	addq	%rcx, %rax
+	jmp	.L73
+.L72:
+	movq	%r12, %rdi
+	call	efi_malloc
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L68
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	movq	%rax, %rdi
+	call	memcpy
+.L68:
+	movq	%rbx, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	duplicate_device_path, .-duplicate_device_path
+	.type	find_parent_device, @function
+find_parent_device:
+	pushq	%r13
+	movq	%rdi, %r13
+	pushq	%r12
+	movq	%rsi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	xorl	%ebx, %ebx
+	pushq	%rcx
+	movq	24(%rsi), %rdi
+	call	duplicate_device_path
+	testq	%rax, %rax
+	je	.L77
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	find_last_device_path
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L77
+	movl	$327551, (%rax)
+	movq	%r13, %rbx
+.L79:
+	testq	%rbx, %rbx
+	je	.L81
+	cmpq	%r12, %rbx
+	jne	.L80
+.L82:
+	movq	48(%rbx), %rbx
+	jmp	.L79
+.L80:
+	movq	24(%rbx), %rdi
+	movq	%rbp, %rsi
+	call	compare_device_paths
+	testl	%eax, %eax
+	jne	.L82
+.L81:
+	movq	%rbp, %rdi
+	call	efi_free
+.L77:
+	popq	%rdx
+	movq	%rbx, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	find_parent_device, .-find_parent_device
+	.section	.rodata.str1.1
+.LC2:
+	.string	"hd%d"
+.LC3:
+	.string	"%s\n"
+	.text
+	.globl	efidisk_iterate
+	.hidden	efidisk_iterate
+	.type	efidisk_iterate, @function
+efidisk_iterate:
+	pushq	%r13
+	leaq	.LC2(%rip), %r13
+	pushq	%r12
+	pushq	%rbp
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	pushq	%rdx
+	movq	efi_hd(%rip), %rbx
+.L93:
+	testq	%rbx, %rbx
+	je	.L92
+	movl	%ebp, %ecx
+	movq	%r13, %rdx
+	movl	$16, %esi
+	movq	%rbx, %rdi
+	xorl	%eax, %eax
+	leaq	efidisk_read(%rip), %r12
+	call	snprintf
+	movq	%rbx, %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	check_msdos_partmap
+	testl	%eax, %eax
+	jne	.L92
+	movq	%r12, %rsi
+	movq	%rbx, %rdi
+	call	check_gpt_partmap
+	testl	%eax, %eax
+	jne	.L92
+	movq	48(%rbx), %rbx
+	incl	%ebp
+	jmp	.L93
+.L92:
+	popq	%rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	efidisk_iterate, .-efidisk_iterate
+	.globl	efidisk_init
+	.hidden	efidisk_init
+	.type	efidisk_init, @function
+efidisk_init:
+	pushq	%r15
+	movl	$64, %edi
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$56, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	movq	efi_systab(%rip), %rax
+	leaq	16(%rsp), %r12
+	movq	$64, 16(%rsp)
+	movq	96(%rax), %rbp
+	call	efi_malloc
+	movq	%r12, %r9
+	xorl	%r8d, %r8d
+	movl	$2, %ecx
+	pushq	%rsi
+	leaq	efi_block_io_protocol_guid(%rip), %rdx
+	movq	%rax, %rbx
+	pushq	%rax
+	subq	$32, %rsp
+	call	*176(%rbp)
+	addq	$48, %rsp
+	movabsq	$-9223372036854775803, %rdx
+	cmpq	%rdx, %rax
+	jne	.L99
+	movq	%rbx, %rdi
+	call	efi_free
+	movq	16(%rsp), %rdi
+	call	efi_malloc
+	movq	%r12, %r9
+	xorl	%r8d, %r8d
+	leaq	efi_block_io_protocol_guid(%rip), %rdx
+	pushq	%rcx
+	movq	%rax, %rbx
+	movl	$2, %ecx
+	pushq	%rax
+	subq	$32, %rsp
+	call	*176(%rbp)
+	addq	$48, %rsp
+.L99:
+	testq	%rax, %rax
+	je	.L100
+	movq	%rbx, %rdi
+	call	efi_free
+.L100:
+	movq	16(%rsp), %rax
+	shrq	$3, %rax
+	testq	%rbx, %rbx
+	je	.L98
+	leaq	(%rbx,%rax,8), %r15
+	movq	%rbx, %r12
+	xorl	%ebp, %ebp
+.L102:
+	cmpq	%r15, %r12
+	je	.L169
+	movq	(%r12), %rdi
+	leaq	efi_device_path_protocol_guid(%rip), %rsi
+	call	open_protocol.constprop.0
+	movq	%rax, %r13
+	testq	%rax, %rax
+	je	.L104
+	movq	%rax, %rdi
+	call	find_last_device_path
+	movq	%rax, %r14
+	testq	%rax, %rax
+	jne	.L105
+.L104:
+	movq	%rbp, %rax
+	jmp	.L106
+.L105:
+	movq	(%r12), %rdi
+	leaq	efi_block_io_protocol_guid(%rip), %rsi
+	call	open_protocol.constprop.0
+	movq	%rax, %rdx
+	testq	%rax, %rax
+	je	.L104
+	movq	8(%rax), %rcx
+	testq	%rcx, %rcx
+	je	.L104
+	cmpl	$1766873157, (%rcx)
+	movl	12(%rcx), %eax
+	jne	.L107
+	cmpl	$1, %eax
+	je	.L104
+.L107:
+	leal	-1(%rax), %ecx
+	movq	%rdx, 8(%rsp)
+	testl	%eax, %ecx
+	jne	.L104
+	cmpl	$511, %eax
+	jbe	.L104
+	movl	$56, %edi
+	call	efi_malloc
+	movq	(%r12), %rcx
+	movq	8(%rsp), %rdx
+	movq	%r13, 24(%rax)
+	movq	%rcx, 16(%rax)
+	movq	%r14, 32(%rax)
+	movq	%rdx, 40(%rax)
+	movq	%rbp, 48(%rax)
+.L106:
+	addq	$8, %r12
+	movq	%rax, %rbp
+	jmp	.L102
+.L169:
+	movq	%rbx, %rdi
+	call	efi_free
+	testq	%rbp, %rbp
+	je	.L98
+	movq	%rbp, %rbx
+.L117:
+	movq	32(%rbx), %rax
+	testq	%rax, %rax
+	je	.L110
+	movb	(%rax), %dl
+	andl	$127, %edx
+	cmpb	$4, %dl
+	jne	.L110
+	movb	1(%rax), %al
+	cmpb	$1, %al
+	je	.L127
+	xorl	%r13d, %r13d
+	cmpb	$2, %al
+	je	.L112
+	jmp	.L110
+.L127:
+	movl	$1, %r13d
+.L112:
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	find_parent_device
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L110
+	movq	%rax, %rsi
+	movq	%rbp, %rdi
+	call	find_parent_device
+	testq	%rax, %rax
+	jne	.L166
+	cmpq	$0, 32(%r12)
+	je	.L166
+	movq	%r12, %rsi
+	leaq	efi_hd(%rip), %rdi
+	testl	%r13d, %r13d
+	jne	.L165
+	leaq	efi_cd(%rip), %rdi
+.L165:
+	call	add_device
+	xorl	%edx, %edx
+	movq	%rdx, 32(%r12)
+.L166:
+	xorl	%eax, %eax
+	movq	%rax, 32(%rbx)
+.L110:
+	movq	48(%rbx), %rbx
+	testq	%rbx, %rbx
+	jne	.L117
+	movq	%rbp, %rbx
+	leaq	efi_hd(%rip), %r13
+.L124:
+	movq	32(%rbx), %r12
+	testq	%r12, %r12
+	je	.L118
+	movb	(%r12), %al
+	andl	$127, %eax
+	cmpb	$4, %al
+	jne	.L119
+	cmpb	$3, 1(%r12)
+	jne	.L119
+	movabsq	$5308011921340204523, %rax
+	movq	%rax, 24(%rsp)
+	movabsq	$-5191896100618728309, %rax
+	movq	%rax, 32(%rsp)
+	cmpw	$20, 2(%r12)
+	jne	.L119
+	leaq	24(%rsp), %rsi
+	leaq	4(%r12), %rdi
+	movl	$16, %edx
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L119
+	movq	%rbx, %rsi
+	movq	%rbp, %rdi
+	call	find_parent_device
+	testq	%rax, %rax
+	jne	.L118
+.L119:
+	movq	40(%rbx), %rax
+	movq	8(%rax), %rdx
+	movb	(%r12), %al
+	andl	$127, %eax
+	cmpb	$2, %al
+	jne	.L121
+	cmpb	$1, 1(%r12)
+	jne	.L121
+	movl	4(%r12), %eax
+	cmpl	$100942288, %eax
+	sete	%cl
+	cmpl	$117457360, %eax
+	sete	%sil
+	orb	%sil, %cl
+	jne	.L128
+	cmpl	$117522897, %eax
+	jne	.L121
+.L128:
+	movq	%rbx, %rsi
+	leaq	efi_hd(%rip), %rdi
+	jmp	.L167
+.L121:
+	cmpb	$0, 7(%rdx)
+	movq	%rbx, %rsi
+	je	.L123
+	cmpl	$512, 12(%rdx)
+	leaq	efi_cd(%rip), %rdi
+	ja	.L167
+.L123:
+	movq	%r13, %rdi
+.L167:
+	call	add_device
+.L118:
+	movq	48(%rbx), %rbx
+	testq	%rbx, %rbx
+	jne	.L124
+	movq	40(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	jne	.L168
+	addq	$56, %rsp
+	movq	%rbp, %rdi
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	jmp	free_devices
+.L98:
+	movq	40(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L126
+.L168:
+	call	__stack_chk_fail@PLT
+.L126:
+	addq	$56, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	efidisk_init, .-efidisk_init
+	.globl	efidisk_fini
+	.hidden	efidisk_fini
+	.type	efidisk_fini, @function
+efidisk_fini:
+	pushq	%rax
+	xorl	%edi, %edi
+	call	free_devices
+	movq	efi_hd(%rip), %rdi
+	call	free_devices
+	movq	efi_cd(%rip), %rdi
+	popq	%rdx
+	jmp	free_devices
+	.size	efidisk_fini, .-efidisk_fini
+	.local	efi_cd
+	.comm	efi_cd,8,8
+	.local	efi_hd
+	.comm	efi_hd,8,8
+	.hidden	efi_device_path_protocol_guid
+	.hidden	efi_block_io_protocol_guid
+	.hidden	check_gpt_partmap
+	.hidden	check_msdos_partmap
+	.hidden	snprintf
+	.hidden	efi_malloc
+	.hidden	efi_systab
+	.hidden	efi_image_handle
+	.hidden	memcmp
+	.hidden	efi_free
+	.hidden	printf
+	.hidden	efi_free_pages
+	.hidden	memcpy
+	.hidden	efi_allocate_pages
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,556 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * FAT32 and exFAT extent resolver
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "diskfile.h"
+#include "ntloader.h"
+
+/** Number of FAT sectors cached while walking cluster chains */
+#define FAT_CACHE_SECTORS 8
+
+/** Number of FAT entries cached while walking cluster chains */
+#define FAT_CACHE_ENTRIES \
+    (FAT_CACHE_SECTORS * DISKFILE_SECTOR_SIZE / sizeof (uint32_t))
+
+/** Size of a directory entry */
+#define FAT_DIRENT_SIZE 32
+
+/** Directory entries per sector */
+#define FAT_DIRENTS_PER_SECTOR (DISKFILE_SECTOR_SIZE / FAT_DIRENT_SIZE)
+
+/** Maximum length of a long file name */
+#define FAT_MAX_NAME 255
+
+/** FAT32 attributes */
+#define FAT_ATTR_VOLUME 0x08
+#define FAT_ATTR_DIRECTORY 0x10
+#define FAT_ATTR_LFN 0x0f
+
+/** exFAT directory entry types */
+#define EXFAT_ENTRY_FILE 0x85
+#define EXFAT_ENTRY_STREAM 0xc0
+#define EXFAT_ENTRY_NAME 0xc1
+
+/** exFAT entry is in use */
+#define EXFAT_ENTRY_IN_USE 0x80
+
+/** exFAT entry is a secondary entry */
+#define EXFAT_ENTRY_SECONDARY 0x40
+
+/** exFAT stream has no FAT chain */
+#define EXFAT_STREAM_CONTIGUOUS 0x02
+
+/** A FAT32 or exFAT volume */
+struct fat_volume
+{
+    /** Volume is exFAT */
+    int exfat;
+    /** Starting sector of FAT */
+    uint64_t fat_start;
+    /** Starting sector of cluster 2 */
+    uint64_t data_start;
+    /** Sectors per cluster (log2) */
+    unsigned int spc_shift;
+    /** Number of clusters */
+    uint32_t count;
+    /** Root directory cluster */
+    uint32_t root;
+    /** First cached FAT sector */
+    uint64_t cached;
+    /** Cached FAT entries */
+    uint32_t fat[FAT_CACHE_ENTRIES];
+};
+
+/** A directory entry */
+struct fat_dirent
+{
+    /** First cluster */
+    uint32_t cluster;
+    /** Length */
+    uint64_t len;
+    /** Initialised length */
+    uint64_t valid;
+    /** Entry is a directory */
+    int dir;
+    /** Clusters are contiguous (no FAT chain) */
+    int contiguous;
+};
+
+/** A directory being read */
+struct fat_dir
+{
+    /** Volume */
+    struct fat_volume *vol;
+    /** Current cluster */
+    uint32_t cluster;
+    /** Clusters remaining (for contiguous directories) */
+    uint32_t remaining;
+    /** Directory is contiguous */
+    int contiguous;
+    /** Number of clusters visited */
+    uint32_t visited;
+    /** Next sector within cluster */
+    unsigned int sector;
+    /** Next entry within sector */
+    unsigned int entry;
+    /** Sector buffer */
+    uint8_t buf[DISKFILE_SECTOR_SIZE];
+};
+
+/** Offsets of the characters within a long file name entry */
+static const uint8_t fat_lfn_offsets[] =
+{
+    1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30
+};
+
+/**
+ * Read little-endian 16-bit value
+ *
+ * @v p			Data
+ * @ret val		Value
+ */
+static inline uint16_t fat_u16 (const uint8_t *p)
+{
+    return (p[0] | (p[1] << 8));
+}
+
+/**
+ * Read little-endian 32-bit value
+ *
+ * @v p			Data
+ * @ret val		Value
+ */
+static inline uint32_t fat_u32 (const uint8_t *p)
+{
+    return (fat_u16 (p) | (((uint32_t) fat_u16 (p + 2)) << 16));
+}
+
+/**
+ * Read little-endian 64-bit value
+ *
+ * @v p			Data
+ * @ret val		Value
+ */
+static inline uint64_t fat_u64 (const uint8_t *p)
+{
+    return (fat_u32 (p) | (((uint64_t) fat_u32 (p + 4)) << 32));
+}
+
+/**
+ * Check cluster number is within volume
+ *
+ * @v vol		Volume
+ * @v cluster		Cluster number
+ * @ret valid		Cluster is valid
+ */
+static inline int fat_valid (struct fat_volume *vol, uint32_t cluster)
+{
+    return ((cluster >= 2) && ((cluster - 2) < vol->count));
+}
+
+/**
+ * Get starting sector of cluster
+ *
+ * @v vol		Volume
+ * @v cluster		Cluster number
+ * @ret sector		Starting sector within partition
+ */
+static inline uint64_t fat_sector (struct fat_volume *vol, uint32_t cluster)
+{
+    return (vol->data_start + (((uint64_t) (cluster - 2)) << vol->spc_shift));
+}
+
+/**
+ * Get next cluster in chain
+ *
+ * @v vol		Volume
+ * @v cluster		Cluster number
+ * @v next		Next cluster number to fill in (0 at end of chain)
+ * @ret rc		Return status code
+ */
+static int fat_next (struct fat_volume *vol, uint32_t cluster, uint32_t *next)
+{
+    uint64_t sector;
+    uint32_t val;
+
+    sector = (vol->fat_start + (cluster / FAT_CACHE_ENTRIES) *
+              FAT_CACHE_SECTORS);
+    if (sector != vol->cached)
+    {
+        if (diskfile_read_sectors (sector, FAT_CACHE_SECTORS,
+                                   vol->fat) != 0)
+            return -1;
+        vol->cached = sector;
+    }
+    val = vol->fat[cluster % FAT_CACHE_ENTRIES];
+    if (! vol->exfat)
+        val &= 0x0fffffff;
+
+    if (val >= (vol->exfat ? 0xfffffff8 : 0x0ffffff8))
+        val = 0;
+    else if (! fat_valid (vol, val))
+    {
+        DBG ("bad FAT entry %#x for cluster %#x\n", val, cluster);
+        return -1;
+    }
+    *next = val;
+    return 0;
+}
+
+/**
+ * Get next directory entry
+ *
+ * @v dir		Directory
+ * @ret entry		Directory entry, or NULL at end of directory
+ */
+static const uint8_t *fat_dir_next (struct fat_dir *dir)
+{
+    struct fat_volume *vol = dir->vol;
+    uint32_t next;
+
+    if (dir->entry == FAT_DIRENTS_PER_SECTOR)
+    {
+        if (dir->sector == (1U << vol->spc_shift))
+        {
+            /* Move to next cluster */
+            if (dir->contiguous)
+            {
+                if (--dir->remaining == 0)
+                    return NULL;
+                next = (dir->cluster + 1);
+            }
+            else if (fat_next (vol, dir->cluster, &next) != 0)
+                return NULL;
+            if ((! fat_valid (vol, next)) || (++dir->visited > vol->count))
+                return NULL;
+            dir->cluster = next;
+            dir->sector = 0;
+        }
+        if (diskfile_read_sectors ((fat_sector (vol, dir->cluster) +
+                                    dir->sector), 1, dir->buf) != 0)
+            return NULL;
+        dir->sector++;
+        dir->entry = 0;
+    }
+    return (dir->buf + (FAT_DIRENT_SIZE * dir->entry++));
+}
+
+/**
+ * Open directory
+ *
+ * @v vol		Volume
+ * @v dirent		Directory entry
+ * @v dir		Directory to fill in
+ * @ret rc		Return status code
+ */
+static int fat_dir_open (struct fat_volume *vol, struct fat_dirent *dirent,
+                         struct fat_dir *dir)
+{
+    uint64_t cluster_size = (DISKFILE_SECTOR_SIZE << vol->spc_shift);
+
+    if (! fat_valid (vol, dirent->cluster))
+        return -1;
+    dir->vol = vol;
+    dir->cluster = dirent->cluster;
+    dir->contiguous = dirent->contiguous;
+    dir->remaining = ((dirent->len + cluster_size - 1) >>
+                      (vol->spc_shift + 9));
+    if (dir->contiguous && (! dir->remaining))
+        return -1;
+    dir->visited = 0;
+    dir->sector = 0;
+    dir->entry = FAT_DIRENTS_PER_SECTOR;
+    return 0;
+}
+
+/**
+ * Find name within FAT32 directory
+ *
+ * @v vol		Volume
+ * @v dirent		Directory entry (updated to found entry)
+ * @v name		Name
+ * @v len		Length of name
+ * @ret rc		Return status code
+ */
+static int fat32_lookup (struct fat_volume *vol, struct fat_dirent *dirent,
+                         const char *name, size_t len)
+{
+    struct fat_dir dir;
+    uint16_t lfn[FAT_MAX_NAME + 13];
+    uint16_t sfn[12];
+    const uint8_t *entry;
+    size_t lfn_len = 0;
+    size_t sfn_len;
+    unsigned int seq;
+    unsigned int i;
+
+    if (fat_dir_open (vol, dirent, &dir) != 0)
+        return -1;
+
+    while ((entry = fat_dir_next (&dir)) != NULL)
+    {
+        if (entry[0] == 0x00)
+            break;
+        if (entry[0] == 0xe5)
+        {
+            lfn_len = 0;
+            continue;
+        }
+
+        /* Accumulate long file name */
+        if (entry[11] == FAT_ATTR_LFN)
+        {
+            seq = (entry[0] & 0x1f);
+            if ((seq == 0) || (seq > 20))
+            {
+                lfn_len = 0;
+                continue;
+            }
+            if (entry[0] & 0x40)
+                lfn_len = (seq * 13);
+            if ((seq * 13) > lfn_len)
+                continue;
+            for (i = 0 ; i < 13 ; i++)
+                lfn[(seq - 1) * 13 + i] = fat_u16 (entry + fat_lfn_offsets[i]);
+            continue;
+        }
+        if (entry[11] & FAT_ATTR_VOLUME)
+        {
+            lfn_len = 0;
+            continue;
+        }
+
+        /* Construct short file name */
+        for (sfn_len = 0, i = 0 ; i < 8 && entry[i] != ' ' ; i++)
+            sfn[sfn_len++] = ((i == 0 && entry[i] == 0x05) ? 0xe5 : entry[i]);
+        if (entry[8] != ' ')
+        {
+            sfn[sfn_len++] = '.';
+            for (i = 8 ; i < 11 && entry[i] != ' ' ; i++)
+                sfn[sfn_len++] = entry[i];
+        }
+
+        /* Trim long file name at terminator */
+        for (i = 0 ; i < lfn_len && lfn[i] ; i++)
+            ;
+
+        if ((i && diskfile_match (name, len, lfn, i)) ||
+            diskfile_match (name, len, sfn, sfn_len))
+        {
+            dirent->cluster = ((fat_u16 (entry + 20) << 16) |
+                               fat_u16 (entry + 26));
+            dirent->len = fat_u32 (entry + 28);
+            dirent->valid = dirent->len;
+            dirent->dir = (entry[11] & FAT_ATTR_DIRECTORY);
+            dirent->contiguous = 0;
+            return 0;
+        }
+        lfn_len = 0;
+    }
+    return -1;
+}
+
+/**
+ * Find name within exFAT directory
+ *
+ * @v vol		Volume
+ * @v dirent		Directory entry (updated to found entry)
+ * @v name		Name
+ * @v len		Length of name
+ * @ret rc		Return status code
+ */
+static int exfat_lookup (struct fat_volume *vol, struct fat_dirent *dirent,
+                         const char *name, size_t len)
+{
+    struct fat_dir dir;
+    struct fat_dirent found;
+    uint16_t wname[FAT_MAX_NAME + 15];
+    const uint8_t *entry;
+    unsigned int remaining = 0;
+    unsigned int name_len = 0;
+    unsigned int wlen = 0;
+    int have_stream = 0;
+    unsigned int i;
+
+    if (fat_dir_open (vol, dirent, &dir) != 0)
+        return -1;
+    memset (&found, 0, sizeof (found));
+
+    while ((entry = fat_dir_next (&dir)) != NULL)
+    {
+        if (entry[0] == 0x00)
+            break;
+
+        /* Start a new entry set at each file entry */
+        if (entry[0] == EXFAT_ENTRY_FILE)
+        {
+            remaining = entry[1];
+            found.dir = (fat_u16 (entry + 4) & FAT_ATTR_DIRECTORY);
+            have_stream = 0;
+            wlen = 0;
+            continue;
+        }
+        if ((! (entry[0] & EXFAT_ENTRY_IN_USE)) ||
+            (! (entry[0] & EXFAT_ENTRY_SECONDARY)))
+        {
+            remaining = 0;
+            continue;
+        }
+        if (! remaining)
+            continue;
+        remaining--;
+
+        if (entry[0] == EXFAT_ENTRY_STREAM)
+        {
+            found.contiguous = (entry[1] & EXFAT_STREAM_CONTIGUOUS);
+            name_len = entry[3];
+            found.valid = fat_u64 (entry + 8);
+            found.cluster = fat_u32 (entry + 20);
+            found.len = fat_u64 (entry + 24);
+            have_stream = 1;
+        }
+        else if ((entry[0] == EXFAT_ENTRY_NAME) && (wlen < FAT_MAX_NAME))
+        {
+            for (i = 0 ; i < 15 ; i++)
+                wname[wlen++] = fat_u16 (entry + 2 + (2 * i));
+        }
+
+        if ((remaining == 0) && have_stream && (name_len <= wlen) &&
+            diskfile_match (name, len, wname, name_len))
+        {
+            memcpy (dirent, &found, sizeof (*dirent));
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Open file on FAT32 or exFAT volume
+ *
+ * @v file		File to fill in
+ * @v path		Path
+ * @v vbr		Volume boot record
+ * @ret rc		Return status code
+ */
+int fat_open (struct diskfile *file, const char *path,
+              const union volume_boot_record *vbr)
+{
+    struct fat_volume vol;
+    struct fat_dirent dirent;
+    const char *name;
+    size_t len;
+    uint32_t cluster;
+    uint32_t next;
+    uint64_t clusters;
+    uint32_t total;
+    unsigned int spc;
+
+    /* Parse boot record */
+    memset (&vol, 0, sizeof (vol));
+    vol.cached = ~0ULL;
+    vol.exfat = (memcmp (vbr->exfat.oem_name, "EXFAT", 5) == 0);
+    if (vol.exfat)
+    {
+        if (vbr->exfat.bytes_per_sector_shift != 9)
+            return -1;
+        vol.spc_shift = vbr->exfat.sectors_per_cluster_shift;
+        vol.fat_start = vbr->exfat.num_reserved_sectors;
+        vol.data_start = vbr->exfat.cluster_offset;
+        vol.count = vbr->exfat.cluster_count;
+        vol.root = vbr->exfat.root_cluster;
+    }
+    else
+    {
+        if (vbr->fat.bytes_per_sector != DISKFILE_SECTOR_SIZE)
+            return -1;
+        spc = vbr->fat.sectors_per_cluster;
+        if ((! spc) || (spc & (spc - 1)))
+            return -1;
+        SECTOR_LOG2ULL (vol.spc_shift, spc);
+        vol.fat_start = vbr->fat.num_reserved_sectors;
+        vol.data_start = (vol.fat_start + (vbr->fat.num_fats *
+                          vbr->fat.version.fat32.sectors_per_fat_32));
+        total = vbr->fat.num_total_sectors_32;
+        if (total <= vol.data_start)
+            return -1;
+        vol.count = ((total - vol.data_start) >> vol.spc_shift);
+        vol.root = vbr->fat.version.fat32.root_cluster;
+    }
+    if (vol.spc_shift > 16)
+        return -1;
+
+    /* Walk path from root directory */
+    memset (&dirent, 0, sizeof (dirent));
+    dirent.cluster = vol.root;
+    dirent.dir = 1;
+    while ((name = diskfile_next_name (&path, &len)) != NULL)
+    {
+        if ((! dirent.dir) ||
+            ((vol.exfat ? exfat_lookup : fat32_lookup)
+             (&vol, &dirent, name, len) != 0))
+        {
+            DBG ("%.*s not found\n", ((int) len), name);
+            return -1;
+        }
+    }
+    if (dirent.dir)
+        return -1;
+
+    /* Construct extents */
+    file->len = dirent.len;
+    file->valid = dirent.valid;
+    clusters = ((dirent.len + (DISKFILE_SECTOR_SIZE << vol.spc_shift) - 1)
+                >> (vol.spc_shift + 9));
+    if (! clusters)
+        return 0;
+    cluster = dirent.cluster;
+    if ((! fat_valid (&vol, cluster)) || (clusters > vol.count))
+        return -1;
+    if (dirent.contiguous)
+    {
+        if ((cluster - 2 + clusters) > vol.count)
+            return -1;
+        return diskfile_add_extent (file, fat_sector (&vol, cluster),
+                                    (clusters << vol.spc_shift));
+    }
+    while (clusters--)
+    {
+        if (diskfile_add_extent (file, fat_sector (&vol, cluster),
+                                 (1U << vol.spc_shift)) != 0)
+            return -1;
+        if (! clusters)
+            break;
+        if ((fat_next (&vol, cluster, &next) != 0) || (! next))
+        {
+            DBG ("truncated cluster chain\n");
+            return -1;
+        }
+        cluster = next;
+    }
+    return 0;
+}
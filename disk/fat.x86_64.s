@@ -0,0 +1,739 @@
+	.file	"fat.c"
+	.text
+	.type	fat_u32, @function
+fat_u32:
+	movl	(%rdi), %eax
+	ret
+	.size	fat_u32, .-fat_u32
+	.type	fat_dir_open, @function
+fat_dir_open:
+	movl	24(%rdi), %ecx
+	movl	$512, %eax
+	movl	(%rsi), %r8d
+	sall	%cl, %eax
+	cltq
+	cmpl	$1, %r8d
+	ja	.L3
+.L5:
+	orl	$-1, %eax
+	ret
+.L3:
+	leal	-2(%r8), %r9d
+	cmpl	28(%rdi), %r9d
+	jnb	.L5
+	movq	%rdi, (%rdx)
+	movl	28(%rsi), %edi
+	addl	$9, %ecx
+	movq	8(%rsi), %rsi
+	movl	%r8d, 8(%rdx)
+	movl	%edi, 16(%rdx)
+	leaq	-1(%rax,%rsi), %rax
+	shrq	%cl, %rax
+	movl	%eax, 12(%rdx)
+	testl	%edi, %edi
+	je	.L7
+	testl	%eax, %eax
+	je	.L5
+.L7:
+	xorl	%eax, %eax
+	movl	%eax, 20(%rdx)
+	movl	$1, %eax
+	salq	$36, %rax
+	movq	%rax, 24(%rdx)
+	xorl	%eax, %eax
+	ret
+	.size	fat_dir_open, .-fat_dir_open
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"bad FAT entry %#x for cluster %#x\n"
+	.text
+	.type	fat_next, @function
+fat_next:
+	pushq	%r13
+	movl	%esi, %eax
+	pushq	%r12
+	movq	%rdx, %r12
+	shrl	$10, %eax
+	pushq	%rbp
+	movl	%esi, %ebp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	pushq	%rcx
+	movq	8(%rdi), %rdx
+	leaq	(%rdx,%rax,8), %r13
+	cmpq	%r13, 40(%rdi)
+	je	.L13
+	leaq	48(%rdi), %rdx
+	movl	$8, %esi
+	movq	%r13, %rdi
+	call	diskfile_read_sectors
+	testl	%eax, %eax
+	jne	.L14
+	movq	%r13, 40(%rbx)
+.L13:
+	movl	%ebp, %eax
+	andl	$1023, %eax
+	cmpl	$0, (%rbx)
+	movl	48(%rbx,%rax,4), %esi
+	movl	$-8, %eax
+	jne	.L15
+	andl	$268435455, %esi
+	movl	$268435448, %eax
+.L15:
+	cmpl	%eax, %esi
+	jnb	.L20
+	cmpl	$1, %esi
+	jbe	.L17
+	leal	-2(%rsi), %eax
+	cmpl	28(%rbx), %eax
+	jb	.L16
+.L17:
+	movl	%ebp, %edx
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L14:
+	orl	$-1, %eax
+	jmp	.L12
+.L20:
+	xorl	%esi, %esi
+.L16:
+	movl	%esi, (%r12)
+	xorl	%eax, %eax
+.L12:
+	popq	%rdx
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	fat_next, .-fat_next
+	.type	fat_dir_next, @function
+fat_dir_next:
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+	movq	(%rdi), %rbp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 8(%rsp)
+	xorl	%eax, %eax
+	cmpl	$16, 28(%rdi)
+	jne	.L23
+	movl	24(%rbp), %ecx
+	movl	$1, %eax
+	sall	%cl, %eax
+	cmpl	%eax, 24(%rdi)
+	jne	.L24
+	cmpl	$0, 16(%rdi)
+	je	.L25
+	decl	12(%rdi)
+	jne	.L26
+.L29:
+	xorl	%eax, %eax
+	jmp	.L22
+.L26:
+	movl	8(%rdi), %eax
+	incl	%eax
+	movl	%eax, 4(%rsp)
+	jmp	.L28
+.L25:
+	movl	8(%rdi), %esi
+	leaq	4(%rsp), %rdx
+	movq	%rbp, %rdi
+	call	fat_next
+	testl	%eax, %eax
+	jne	.L29
+.L28:
+	movl	4(%rsp), %edx
+	cmpl	$1, %edx
+	jbe	.L29
+	movl	28(%rbp), %ecx
+	leal	-2(%rdx), %eax
+	cmpl	%ecx, %eax
+	jnb	.L29
+	movl	20(%rbx), %eax
+	incl	%eax
+	movl	%eax, 20(%rbx)
+	cmpl	%eax, %ecx
+	jb	.L29
+	movl	%edx, 8(%rbx)
+	xorl	%edx, %edx
+	movl	%edx, 24(%rbx)
+.L24:
+	movl	8(%rbx), %eax
+	movl	24(%rbp), %ecx
+	leaq	32(%rbx), %rdx
+	movl	$1, %esi
+	leal	-2(%rax), %edi
+	movl	24(%rbx), %eax
+	addq	16(%rbp), %rax
+	salq	%cl, %rdi
+	addq	%rax, %rdi
+	call	diskfile_read_sectors
+	testl	%eax, %eax
+	jne	.L29
+	xorl	%eax, %eax
+	incl	24(%rbx)
+	movl	%eax, 28(%rbx)
+.L23:
+	movl	28(%rbx), %eax
+	leal	1(%rax), %edx
+	sall	$5, %eax
+	movl	%edx, 28(%rbx)
+	leaq	32(%rbx,%rax), %rax
+.L22:
+	movq	8(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L30
+	call	__stack_chk_fail@PLT
+.L30:
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	fat_dir_next, .-fat_dir_next
+	.type	fat32_lookup, @function
+fat32_lookup:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	xorl	%r13d, %r13d
+	pushq	%r12
+	pushq	%rbp
+	movq	%rsi, %rbp
+	pushq	%rbx
+	subq	$1144, %rsp
+	leaq	584(%rsp), %r15
+	movq	%rdx, (%rsp)
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 1128(%rsp)
+	xorl	%eax, %eax
+	movq	%r15, %rdx
+	movq	%rcx, 8(%rsp)
+	call	fat_dir_open
+	movl	%eax, %r12d
+	testl	%eax, %eax
+	je	.L33
+.L35:
+	orl	$-1, %r12d
+	jmp	.L32
+.L55:
+	movb	(%rbx), %dl
+	testb	%dl, %dl
+	je	.L35
+	cmpb	$-27, %dl
+	je	.L36
+	movb	11(%rbx), %al
+	cmpb	$15, %al
+	jne	.L37
+	movl	%edx, %eax
+	andl	$31, %eax
+	leal	-1(%rax), %ecx
+	cmpl	$19, %ecx
+	ja	.L36
+	imull	$13, %eax, %ecx
+	andb	$64, %dl
+	movq	%rcx, %rax
+	jne	.L58
+	cmpq	%rcx, %r13
+	jnb	.L38
+.L33:
+	movq	%r15, %rdi
+	call	fat_dir_next
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	jne	.L55
+	jmp	.L35
+.L58:
+	movq	%rcx, %r13
+.L38:
+	leaq	fat_lfn_offsets(%rip), %rcx
+	leal	-13(%rax), %edx
+.L40:
+	movzbl	(%rcx), %edi
+	incq	%rcx
+	movw	(%rbx,%rdi), %r8w
+	movl	%edx, %edi
+	incl	%edx
+	movw	%r8w, 48(%rsp,%rdi,2)
+	cmpl	%eax, %edx
+	jne	.L40
+	jmp	.L33
+.L37:
+	testb	$8, %al
+	jne	.L36
+	xorl	%eax, %eax
+.L42:
+	movzbl	(%rbx,%rax), %edx
+	cmpb	$32, %dl
+	je	.L45
+	testl	%eax, %eax
+	jne	.L43
+	cmpb	$5, %dl
+	jne	.L43
+	movw	$229, 24(%rsp)
+	movl	$1, %eax
+	jmp	.L42
+.L43:
+	incq	%rax
+	movw	%dx, 22(%rsp,%rax,2)
+	cmpq	$8, %rax
+	jne	.L42
+.L45:
+	cmpb	$32, 8(%rbx)
+	movq	%rax, %r14
+	je	.L47
+	movw	$46, 24(%rsp,%rax,2)
+	movq	%rbx, %rdx
+	incq	%r14
+	leaq	4(%rax), %rcx
+	subq	%rax, %rdx
+.L48:
+	movzbl	7(%rdx,%r14), %eax
+	cmpb	$32, %al
+	je	.L47
+	incq	%r14
+	movw	%ax, 22(%rsp,%r14,2)
+	cmpq	%rcx, %r14
+	jne	.L48
+.L47:
+	xorl	%ecx, %ecx
+	leaq	48(%rsp), %rax
+.L51:
+	cmpq	%rcx, %r13
+	je	.L50
+	cmpw	$0, (%rax,%rcx,2)
+	leaq	1(%rcx), %rdx
+	je	.L50
+	movq	%rdx, %rcx
+	jmp	.L51
+.L50:
+	testl	%ecx, %ecx
+	jne	.L52
+.L54:
+	movq	8(%rsp), %rsi
+	movq	(%rsp), %rdi
+	leaq	24(%rsp), %rdx
+	movq	%r14, %rcx
+	call	diskfile_match
+	testl	%eax, %eax
+	je	.L36
+	jmp	.L53
+.L52:
+	movq	8(%rsp), %rsi
+	movq	(%rsp), %rdi
+	leaq	48(%rsp), %rdx
+	call	diskfile_match
+	testl	%eax, %eax
+	je	.L54
+.L53:
+	movzwl	20(%rbx), %eax
+	movzwl	26(%rbx), %edx
+	leaq	28(%rbx), %rdi
+	sall	$16, %eax
+	orl	%edx, %eax
+	movl	%eax, 0(%rbp)
+	call	fat_u32
+	movl	%eax, %eax
+	movq	%rax, 8(%rbp)
+	movq	%rax, 16(%rbp)
+	movb	11(%rbx), %al
+	andl	$16, %eax
+	movl	%eax, 24(%rbp)
+	xorl	%eax, %eax
+	movl	%eax, 28(%rbp)
+	jmp	.L32
+.L36:
+	xorl	%r13d, %r13d
+	jmp	.L33
+.L32:
+	movq	1128(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L56
+	call	__stack_chk_fail@PLT
+.L56:
+	addq	$1144, %rsp
+	movl	%r12d, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	fat32_lookup, .-fat32_lookup
+	.type	exfat_lookup, @function
+exfat_lookup:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$1176, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 1160(%rsp)
+	xorl	%eax, %eax
+	leaq	616(%rsp), %rax
+	movq	%rdx, 16(%rsp)
+	movq	%rax, %rdx
+	movq	%rsi, (%rsp)
+	movq	%rcx, 24(%rsp)
+	movq	%rax, 8(%rsp)
+	call	fat_dir_open
+	testl	%eax, %eax
+	je	.L78
+.L81:
+	orl	$-1, %ebp
+	jmp	.L77
+.L78:
+	leaq	40(%rsp), %r15
+	movl	$32, %edx
+	xorl	%esi, %esi
+	movl	%eax, %ebp
+	movq	%r15, %rdi
+	xorl	%r14d, %r14d
+	xorl	%ebx, %ebx
+	xorl	%r12d, %r12d
+	call	memset
+.L91:
+	xorl	%r13d, %r13d
+.L80:
+	movq	8(%rsp), %rdi
+	call	fat_dir_next
+	movq	%rax, %rdx
+	testq	%rax, %rax
+	je	.L81
+	movb	(%rdx), %al
+	testb	%al, %al
+	je	.L81
+	cmpb	$-123, %al
+	jne	.L82
+	movw	4(%rdx), %ax
+	movzbl	1(%rdx), %r13d
+	xorl	%r14d, %r14d
+	xorl	%ebx, %ebx
+	andl	$16, %eax
+	movl	%eax, 64(%rsp)
+	jmp	.L80
+.L82:
+	testb	%al, %al
+	jns	.L91
+	testb	$64, %al
+	je	.L91
+	testl	%r13d, %r13d
+	je	.L91
+	decl	%r13d
+	cmpb	$-64, %al
+	jne	.L84
+	movb	1(%rdx), %al
+	leaq	8(%rdx), %rdi
+	movl	$1, %r14d
+	andl	$2, %eax
+	movl	%eax, 68(%rsp)
+	movzbl	3(%rdx), %r12d
+	call	fat_u32
+	leaq	12(%rdx), %rdi
+	movl	%eax, %esi
+	call	fat_u32
+	leaq	20(%rdx), %rdi
+	salq	$32, %rax
+	orq	%rsi, %rax
+	movq	%rax, 56(%rsp)
+	call	fat_u32
+	leaq	24(%rdx), %rdi
+	movl	%eax, 40(%rsp)
+	call	fat_u32
+	leaq	28(%rdx), %rdi
+	movl	%eax, %esi
+	call	fat_u32
+	salq	$32, %rax
+	orq	%rsi, %rax
+	movq	%rax, 48(%rsp)
+	jmp	.L85
+.L84:
+	cmpl	$254, %ebx
+	ja	.L85
+	cmpb	$-63, %al
+	jne	.L85
+	xorl	%eax, %eax
+.L86:
+	movw	2(%rdx,%rax,2), %di
+	leal	(%rbx,%rax), %esi
+	incq	%rax
+	movw	%di, 76(%rsp,%rsi,2)
+	cmpq	$15, %rax
+	jne	.L86
+	addl	$15, %ebx
+.L85:
+	testl	%r13d, %r13d
+	jne	.L80
+	testl	%r14d, %r14d
+	je	.L80
+	cmpl	%r12d, %ebx
+	jb	.L91
+	movq	24(%rsp), %rsi
+	movq	16(%rsp), %rdi
+	movl	%r12d, %ecx
+	leaq	76(%rsp), %rdx
+	call	diskfile_match
+	testl	%eax, %eax
+	je	.L91
+	movq	(%rsp), %rdi
+	movl	$32, %edx
+	movq	%r15, %rsi
+	call	memcpy
+.L77:
+	movq	1160(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L89
+	call	__stack_chk_fail@PLT
+.L89:
+	addq	$1176, %rsp
+	movl	%ebp, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	exfat_lookup, .-exfat_lookup
+	.section	.rodata.str1.1
+.LC1:
+	.string	"EXFAT"
+.LC2:
+	.string	"%.*s not found\n"
+.LC3:
+	.string	"truncated cluster chain\n"
+	.text
+	.globl	fat_open
+	.hidden	fat_open
+	.type	fat_open, @function
+fat_open:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	movq	%rdi, %rbp
+	pushq	%rbx
+	movq	%rdx, %rbx
+	movl	$4144, %edx
+	subq	$4232, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 4216(%rsp)
+	xorl	%eax, %eax
+	leaq	72(%rsp), %r12
+	movq	%rsi, 8(%rsp)
+	xorl	%esi, %esi
+	movq	%r12, %rdi
+	call	memset
+	leaq	3(%rbx), %rdi
+	movl	$5, %edx
+	leaq	.LC1(%rip), %rsi
+	movq	$-1, 112(%rsp)
+	call	memcmp
+	testl	%eax, %eax
+	sete	%al
+	movzbl	%al, %eax
+	movl	%eax, 72(%rsp)
+	jne	.L113
+	cmpb	$9, 108(%rbx)
+	jne	.L115
+	movzbl	109(%rbx), %eax
+	movl	%eax, 96(%rsp)
+	movl	80(%rbx), %eax
+	movq	%rax, 80(%rsp)
+	movl	88(%rbx), %eax
+	movq	%rax, 88(%rsp)
+	movl	92(%rbx), %eax
+	movl	%eax, 100(%rsp)
+	movl	96(%rbx), %eax
+	jmp	.L116
+.L113:
+	cmpw	$512, 11(%rbx)
+	jne	.L115
+	movzbl	13(%rbx), %edx
+	testl	%edx, %edx
+	je	.L115
+	leal	-1(%rdx), %eax
+	andl	%edx, %eax
+	jne	.L115
+	xorl	%esi, %esi
+	movl	$1, %r8d
+.L118:
+	movl	%eax, %ecx
+	movl	%r8d, %edi
+	sall	%cl, %edi
+	movl	%eax, %ecx
+	incl	%eax
+	cmpl	%edx, %edi
+	jnb	.L146
+	movb	$1, %sil
+	jmp	.L118
+.L146:
+	xorl	%eax, %eax
+	testb	%sil, %sil
+	movzwl	14(%rbx), %edx
+	cmovne	%ecx, %eax
+	movq	%rdx, 80(%rsp)
+	movl	%eax, 96(%rsp)
+	movzbl	16(%rbx), %eax
+	imull	36(%rbx), %eax
+	addq	%rdx, %rax
+	movl	32(%rbx), %edx
+	movq	%rax, 88(%rsp)
+	cmpq	%rdx, %rax
+	jnb	.L115
+	subq	%rax, %rdx
+	movl	44(%rbx), %eax
+	shrq	%cl, %rdx
+	movl	%edx, 100(%rsp)
+.L116:
+	cmpl	$16, 96(%rsp)
+	movl	%eax, 104(%rsp)
+	ja	.L115
+	leaq	40(%rsp), %r13
+	movl	$32, %edx
+	xorl	%esi, %esi
+	movq	%r13, %rdi
+	leaq	fat32_lookup(%rip), %r14
+	call	memset
+	movl	104(%rsp), %eax
+	movl	$1, 64(%rsp)
+	movl	%eax, 40(%rsp)
+.L121:
+	leaq	32(%rsp), %rsi
+	leaq	8(%rsp), %rdi
+	call	diskfile_next_name
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L147
+	cmpl	$0, 64(%rsp)
+	jne	.L122
+.L124:
+	movl	32(%rsp), %esi
+	movq	%rbx, %rdx
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L115
+.L122:
+	cmpl	$0, 72(%rsp)
+	movq	32(%rsp), %rcx
+	movq	%rbx, %rdx
+	movq	%r13, %rsi
+	leaq	exfat_lookup(%rip), %rax
+	movq	%r12, %rdi
+	cmove	%r14, %rax
+	call	*%rax
+	testl	%eax, %eax
+	je	.L121
+	jmp	.L124
+.L147:
+	movl	64(%rsp), %r13d
+	testl	%r13d, %r13d
+	jne	.L115
+	movq	56(%rsp), %rax
+	movl	96(%rsp), %edx
+	movq	48(%rsp), %rsi
+	movl	%edx, %ecx
+	movq	%rax, 8(%rbp)
+	movl	$512, %eax
+	sall	%cl, %eax
+	leal	9(%rdx), %ecx
+	movq	%rsi, 0(%rbp)
+	cltq
+	leaq	-1(%rsi,%rax), %rbx
+	shrq	%cl, %rbx
+	testq	%rbx, %rbx
+	je	.L112
+	movl	40(%rsp), %r14d
+	cmpl	$1, %r14d
+	jbe	.L115
+	movl	100(%rsp), %eax
+	leal	-2(%r14), %esi
+	cmpl	%eax, %esi
+	jnb	.L115
+	cmpq	%rbx, %rax
+	jb	.L115
+	cmpl	$0, 68(%rsp)
+	movl	$1, %r15d
+	je	.L128
+	leaq	(%rbx,%rsi), %rcx
+	cmpq	%rcx, %rax
+	jb	.L115
+	movl	%edx, %ecx
+	movq	%rbp, %rdi
+	salq	%cl, %rbx
+	salq	%cl, %rsi
+	addq	88(%rsp), %rsi
+	movq	%rbx, %rdx
+	call	diskfile_add_extent
+	movl	%eax, %r13d
+	jmp	.L112
+.L144:
+	testq	%rbx, %rbx
+	je	.L112
+	leaq	28(%rsp), %rdx
+	movl	%r14d, %esi
+	movq	%r12, %rdi
+	call	fat_next
+	testl	%eax, %eax
+	jne	.L130
+	movl	28(%rsp), %r14d
+	testl	%r14d, %r14d
+	je	.L130
+.L128:
+	movl	96(%rsp), %ecx
+	movl	%r15d, %edx
+	leal	-2(%r14), %esi
+	movq	%rbp, %rdi
+	decq	%rbx
+	salq	%cl, %rsi
+	sall	%cl, %edx
+	addq	88(%rsp), %rsi
+	call	diskfile_add_extent
+	testl	%eax, %eax
+	je	.L144
+	jmp	.L115
+.L130:
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L115:
+	orl	$-1, %r13d
+.L112:
+	movq	4216(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L132
+	call	__stack_chk_fail@PLT
+.L132:
+	addq	$4232, %rsp
+	movl	%r13d, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	fat_open, .-fat_open
+	.section	.rodata
+	.align 8
+	.type	fat_lfn_offsets, @object
+	.size	fat_lfn_offsets, 13
+fat_lfn_offsets:
+	.ascii	"\001\003\005\007\t\016\020\022\024\026\030\034\036"
+	.hidden	diskfile_add_extent
+	.hidden	diskfile_next_name
+	.hidden	memcmp
+	.hidden	memcpy
+	.hidden	memset
+	.hidden	diskfile_match
+	.hidden	printf
+	.hidden	diskfile_read_sectors
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
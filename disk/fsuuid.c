@@ -21,6 +21,7 @@
 #include <string.h>
 #include <strings.h>
 #include "fsuuid.h"
+#include "diskfile.h"
 #include "cmdline.h"
 #include "ntloader.h"
 
@@ -72,6 +73,9 @@ check_fsuuid (void *disk, uint64_t lba,
 
     DBG ("%s %s\n", fs, uuid);
     if (strcasecmp (uuid, nt_cmdline->fsuuid) == 0)
+    {
+        diskfile_set_partition (disk, lba, disk_read);
         return 1;
+    }
     return 0;
 }
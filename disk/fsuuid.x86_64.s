@@ -0,0 +1,171 @@
+	.file	"fsuuid.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"exFAT"
+.LC1:
+	.string	"NTFS "
+.LC2:
+	.string	"FAT12"
+.LC3:
+	.string	"FAT16"
+.LC4:
+	.string	"-"
+.LC5:
+	.string	"FAT32"
+.LC6:
+	.string	"invalid partition\n"
+.LC7:
+	.string	"EXFAT"
+.LC8:
+	.string	"%04x-%04x"
+.LC9:
+	.string	"NTFS"
+.LC10:
+	.string	"%016llx"
+.LC11:
+	.string	"%s %s\n"
+	.text
+	.globl	check_fsuuid
+	.hidden	check_fsuuid
+	.type	check_fsuuid, @function
+check_fsuuid:
+	pushq	%r15
+	pushq	%r14
+	movq	%rdx, %r14
+	movl	$512, %edx
+	pushq	%r13
+	movq	%rsi, %r13
+	pushq	%r12
+	movq	%rdi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$552, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 536(%rsp)
+	xorl	%eax, %eax
+	xorl	%eax, %eax
+	leaq	7(%rsp), %rcx
+	movq	$32, 519(%rsp)
+	movq	%rax, 527(%rsp)
+	movb	$0, 535(%rsp)
+	call	*%r14
+	testl	%eax, %eax
+	jne	.L2
+	leaq	.LC6(%rip), %rdi
+	call	printf
+	jmp	.L3
+.L2:
+	leaq	10(%rsp), %rbx
+	movl	$5, %edx
+	leaq	.LC7(%rip), %rsi
+	movq	%rbx, %rdi
+	leaq	519(%rsp), %rbp
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L4
+	movl	107(%rsp), %r8d
+	movl	$17, %esi
+	leaq	.LC8(%rip), %rdx
+	movq	%rbp, %rdi
+	movl	%r8d, %ecx
+	movzwl	%r8w, %r8d
+	shrl	$16, %ecx
+	call	snprintf
+	leaq	.LC0(%rip), %rsi
+	jmp	.L5
+.L4:
+	movl	$4, %edx
+	leaq	.LC9(%rip), %rsi
+	movq	%rbx, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L6
+	movq	79(%rsp), %rcx
+	movl	$17, %esi
+	leaq	.LC10(%rip), %rdx
+	movq	%rbp, %rdi
+	call	snprintf
+	leaq	.LC1(%rip), %rsi
+	jmp	.L5
+.L6:
+	leaq	61(%rsp), %r15
+	leaq	.LC2(%rip), %rbx
+	movl	$5, %edx
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	je	.L15
+	leaq	.LC3(%rip), %rbx
+	movl	$5, %edx
+	movq	%r15, %rdi
+	movq	%rbx, %rsi
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L8
+.L15:
+	movl	46(%rsp), %r8d
+	jmp	.L14
+.L8:
+	leaq	.LC5(%rip), %rbx
+	leaq	89(%rsp), %rdi
+	movl	$5, %edx
+	movq	%rbx, %rsi
+	call	memcmp
+	leaq	.LC4(%rip), %rsi
+	testl	%eax, %eax
+	jne	.L5
+	movl	74(%rsp), %r8d
+.L14:
+	movl	%r8d, %ecx
+	movl	$17, %esi
+	movzwl	%r8w, %r8d
+	movq	%rbp, %rdi
+	shrl	$16, %ecx
+	leaq	.LC8(%rip), %rdx
+	call	snprintf
+	movq	%rbx, %rsi
+.L5:
+	leaq	.LC11(%rip), %rdi
+	xorl	%eax, %eax
+	movq	%rbp, %rdx
+	call	printf
+	movq	nt_cmdline(%rip), %rax
+	movq	%rbp, %rdi
+	leaq	292(%rax), %rsi
+	call	strcasecmp
+	testl	%eax, %eax
+	je	.L9
+.L3:
+	xorl	%eax, %eax
+	jmp	.L1
+.L9:
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	movq	%r12, %rdi
+	call	diskfile_set_partition
+	movl	$1, %eax
+.L1:
+	movq	536(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L11
+	call	__stack_chk_fail@PLT
+.L11:
+	addq	$552, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	check_fsuuid, .-check_fsuuid
+	.hidden	diskfile_set_partition
+	.hidden	strcasecmp
+	.hidden	nt_cmdline
+	.hidden	snprintf
+	.hidden	memcmp
+	.hidden	printf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
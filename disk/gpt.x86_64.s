@@ -0,0 +1,148 @@
+	.file	"gpt.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"GPT magic not found\n"
+.LC1:
+	.string	"part %d "
+.LC2:
+	.string	"GPT LBA=%lld\n"
+	.text
+	.globl	check_gpt_partmap
+	.hidden	check_gpt_partmap
+	.type	check_gpt_partmap, @function
+check_gpt_partmap:
+	pushq	%r15
+	movl	$92, %edx
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	movq	%rsi, %rbp
+	movl	$1, %esi
+	pushq	%rbx
+	subq	$1288, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 1272(%rsp)
+	xorl	%eax, %eax
+	leaq	20(%rsp), %rbx
+	movq	%rdi, 8(%rsp)
+	movq	%rbx, %rcx
+	call	*%rbp
+	testl	%eax, %eax
+	je	.L3
+	movl	$8, %edx
+	leaq	gpt_magic(%rip), %rsi
+	movq	%rbx, %rdi
+	xorl	%r12d, %r12d
+	call	memcmp
+	leaq	gpt_part_type_empty(%rip), %r15
+	testl	%eax, %eax
+	je	.L4
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L3
+.L8:
+	movl	104(%rsp), %r14d
+	movq	8(%rsp), %rdi
+	movl	$512, %edx
+	leaq	248(%rsp), %r13
+	movq	%r13, %rcx
+	imull	%r12d, %r14d
+	movl	%r14d, %ebx
+	andl	$511, %r14d
+	shrq	$9, %rbx
+	addq	92(%rsp), %rbx
+	movq	%rbx, %rsi
+	call	*%rbp
+	testl	%eax, %eax
+	je	.L3
+	movq	8(%rsp), %rdi
+	leaq	1(%rbx), %rsi
+	movl	$512, %edx
+	leaq	760(%rsp), %rcx
+	call	*%rbp
+	testl	%eax, %eax
+	je	.L3
+	leaq	112(%rsp), %rbx
+	leaq	0(%r13,%r14), %rsi
+	movl	$128, %edx
+	movq	%rbx, %rdi
+	call	memcpy
+	movl	$16, %edx
+	movq	%rbx, %rsi
+	movq	%r15, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L26
+.L6:
+	incl	%r12d
+.L4:
+	cmpl	100(%rsp), %r12d
+	jb	.L8
+	jmp	.L3
+.L26:
+	movl	%r12d, %esi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	144(%rsp), %rsi
+	movq	8(%rsp), %rdi
+	movq	%rbp, %rdx
+	call	check_fsuuid
+	testl	%eax, %eax
+	je	.L6
+	movq	144(%rsp), %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	nt_cmdline(%rip), %rax
+	movl	$16, %edx
+	leaq	128(%rsp), %rsi
+	leaq	309(%rax), %rdi
+	call	memcpy
+	leaq	76(%rsp), %rsi
+	movl	$16, %edx
+	movq	nt_cmdline(%rip), %rdi
+	movb	$0, 341(%rdi)
+	addq	$325, %rdi
+	call	memcpy
+	movl	$1, %eax
+	jmp	.L1
+.L3:
+	xorl	%eax, %eax
+.L1:
+	movq	1272(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L9
+	call	__stack_chk_fail@PLT
+.L9:
+	addq	$1288, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	check_gpt_partmap, .-check_gpt_partmap
+	.section	.rodata
+	.align 16
+	.type	gpt_part_type_empty, @object
+	.size	gpt_part_type_empty, 16
+gpt_part_type_empty:
+	.zero	16
+	.data
+	.align 8
+	.type	gpt_magic, @object
+	.size	gpt_magic, 8
+gpt_magic:
+	.ascii	"EFI PART"
+	.hidden	nt_cmdline
+	.hidden	check_fsuuid
+	.hidden	memcpy
+	.hidden	printf
+	.hidden	memcmp
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,155 @@
+	.file	"msdos.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"MSDOS partition signature not found.\n"
+.LC1:
+	.string	"too many partitions.\n"
+.LC2:
+	.string	"found dummy mbr.\n"
+.LC3:
+	.string	"part %d (%d) "
+.LC4:
+	.string	"MBR Start=0x%llx Signature=%04X\n"
+	.text
+	.type	check_mbr, @function
+check_mbr:
+	pushq	%r15
+	movq	%rdx, %r15
+	movl	$512, %edx
+	pushq	%r14
+	movl	%esi, %r14d
+	pushq	%r13
+	movq	%r14, %rsi
+	pushq	%r12
+	movq	%rdi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$536, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 520(%rsp)
+	xorl	%eax, %eax
+	leaq	8(%rsp), %rbp
+	movq	%rbp, %rcx
+	call	*%r15
+	testl	%eax, %eax
+	je	.L6
+	cmpw	$-21931, 518(%rsp)
+	je	.L3
+	leaq	.LC0(%rip), %rdi
+.L22:
+	xorl	%eax, %eax
+	call	printf
+.L6:
+	xorl	%eax, %eax
+	jmp	.L1
+.L3:
+	movq	%r14, %r13
+	xorl	%ebx, %ebx
+.L12:
+	movl	part_count(%rip), %esi
+	cmpl	$31, %esi
+	jbe	.L5
+	leaq	.LC1(%rip), %rdi
+	jmp	.L22
+.L5:
+	movb	450(%rbp), %al
+	cmpb	$-18, %al
+	jne	.L7
+	leaq	.LC2(%rip), %rdi
+	jmp	.L22
+.L7:
+	cmpl	$0, 458(%rbp)
+	je	.L8
+	testb	%al, %al
+	je	.L8
+	movl	%eax, %edx
+	andl	$127, %edx
+	cmpb	$5, %dl
+	je	.L9
+	cmpb	$15, %al
+	je	.L9
+	leal	1(%rsi), %eax
+	movl	%ebx, %edx
+	leaq	.LC3(%rip), %rdi
+	movl	%eax, part_count(%rip)
+	xorl	%eax, %eax
+	call	printf
+	movl	%r13d, %esi
+	movq	%r15, %rdx
+	movq	%r12, %rdi
+	addl	454(%rbp), %esi
+	call	check_fsuuid
+	testl	%eax, %eax
+	je	.L8
+	movslq	%ebx, %rbx
+	movl	448(%rsp), %edx
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	salq	$4, %rbx
+	movl	462(%rsp,%rbx), %esi
+	addq	%r14, %rsi
+	salq	$9, %rsi
+	movq	%rsi, (%rsp)
+	call	printf
+	movq	nt_cmdline(%rip), %rax
+	movq	%rsp, %rsi
+	movl	$8, %edx
+	leaq	309(%rax), %rdi
+	call	memcpy
+	movq	nt_cmdline(%rip), %rdi
+	movl	$4, %edx
+	leaq	448(%rsp), %rsi
+	movb	$1, 341(%rdi)
+	addq	$325, %rdi
+	call	memcpy
+	jmp	.L11
+.L9:
+	movl	454(%rbp), %esi
+	movq	%r15, %rdx
+	movq	%r12, %rdi
+	addl	%r13d, %esi
+	call	check_mbr
+	testl	%eax, %eax
+	jne	.L11
+.L8:
+	incl	%ebx
+	addq	$16, %rbp
+	cmpl	$4, %ebx
+	jne	.L12
+	jmp	.L6
+.L11:
+	movl	$1, %eax
+.L1:
+	movq	520(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L13
+	call	__stack_chk_fail@PLT
+.L13:
+	addq	$536, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	check_mbr, .-check_mbr
+	.globl	check_msdos_partmap
+	.hidden	check_msdos_partmap
+	.type	check_msdos_partmap, @function
+check_msdos_partmap:
+	movq	%rsi, %rdx
+	xorl	%eax, %eax
+	xorl	%esi, %esi
+	movl	%eax, part_count(%rip)
+	jmp	check_mbr
+	.size	check_msdos_partmap, .-check_msdos_partmap
+	.local	part_count
+	.comm	part_count,4,4
+	.hidden	memcpy
+	.hidden	nt_cmdline
+	.hidden	check_fsuuid
+	.hidden	printf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,577 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * NTFS extent resolver
+ *
+ * Only what is needed to map an uncompressed, unencrypted file to its
+ * clusters is supported: directory B+ trees are descended using a
+ * simple case-insensitive collation, and attributes must live in the
+ * base file record (i.e. no $ATTRIBUTE_LIST).
+ *
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wctype.h>
+#include "diskfile.h"
+#include "ntloader.h"
+
+/** Maximum supported file record and index block size */
+#define NTFS_MAX_BLOCK 4096
+
+/** Maximum directory tree depth */
+#define NTFS_MAX_DEPTH 32
+
+/** Record number of $MFT */
+#define NTFS_MFT 0
+
+/** Record number of the root directory */
+#define NTFS_ROOT 5
+
+/** File record is in use */
+#define NTFS_RECORD_IN_USE 0x0001
+
+/** Attribute types */
+#define NTFS_AT_ATTRIBUTE_LIST 0x20
+#define NTFS_AT_DATA 0x80
+#define NTFS_AT_INDEX_ROOT 0x90
+#define NTFS_AT_INDEX_ALLOCATION 0xa0
+#define NTFS_AT_END 0xffffffff
+
+/** Attribute is compressed or encrypted */
+#define NTFS_ATTR_UNSUPPORTED 0x40ff
+
+/** Index entry points to a subnode */
+#define NTFS_INDEX_SUBNODE 0x01
+
+/** Index entry is the last in its node */
+#define NTFS_INDEX_LAST 0x02
+
+/** $FILE_NAME flag for directories */
+#define NTFS_FILE_NAME_DIRECTORY 0x10000000
+
+/** Name of directory indices */
+static const uint16_t ntfs_i30[] = { '$', 'I', '3', '0' };
+
+/** An NTFS volume */
+struct ntfs_volume
+{
+    /** Sectors per cluster */
+    uint32_t spc;
+    /** File record size */
+    uint32_t record_size;
+    /** Index block size */
+    uint32_t index_size;
+    /** Index block VCN unit size */
+    uint32_t index_unit;
+    /** $MFT data */
+    struct diskfile mft;
+};
+
+/** File record buffer */
+static uint8_t ntfs_record[NTFS_MAX_BLOCK];
+
+/** Index block buffer */
+static uint8_t ntfs_index[NTFS_MAX_BLOCK];
+
+/**
+ * Read little-endian 16-bit value
+ *
+ * @v p			Data
+ * @ret val		Value
+ */
+static inline uint16_t ntfs_u16 (const uint8_t *p)
+{
+    return (p[0] | (p[1] << 8));
+}
+
+/**
+ * Read little-endian 32-bit value
+ *
+ * @v p			Data
+ * @ret val		Value
+ */
+static inline uint32_t ntfs_u32 (const uint8_t *p)
+{
+    return (ntfs_u16 (p) | (((uint32_t) ntfs_u16 (p + 2)) << 16));
+}
+
+/**
+ * Read little-endian 64-bit value
+ *
+ * @v p			Data
+ * @ret val		Value
+ */
+static inline uint64_t ntfs_u64 (const uint8_t *p)
+{
+    return (ntfs_u32 (p) | (((uint64_t) ntfs_u32 (p + 4)) << 32));
+}
+
+/**
+ * Calculate block size from boot record encoding
+ *
+ * @v clusters		Clusters per block (or negative log2 of bytes)
+ * @v cluster_size	Cluster size
+ * @ret size		Block size
+ */
+static uint32_t ntfs_block_size (int8_t clusters, uint32_t cluster_size)
+{
+    if (clusters > 0)
+        return (clusters * cluster_size);
+    if (clusters < -31)
+        return 0;
+    return (1U << (-clusters));
+}
+
+/**
+ * Apply update sequence fixups to a multi-sector block
+ *
+ * @v buf		Block
+ * @v len		Length of block
+ * @v magic		Expected block signature
+ * @ret rc		Return status code
+ */
+static int ntfs_fixup (uint8_t *buf, size_t len, const char *magic)
+{
+    unsigned int usa_ofs;
+    unsigned int usa_count;
+    unsigned int i;
+    uint8_t *usa;
+    uint8_t *end;
+
+    if (memcmp (buf, magic, 4) != 0)
+        return -1;
+    usa_ofs = ntfs_u16 (buf + 4);
+    usa_count = ntfs_u16 (buf + 6);
+    if ((usa_count == 0) ||
+        ((usa_count - 1) != (len / DISKFILE_SECTOR_SIZE)) ||
+        ((usa_ofs + (2 * usa_count)) > len))
+        return -1;
+
+    usa = (buf + usa_ofs);
+    for (i = 1 ; i < usa_count ; i++)
+    {
+        end = (buf + (i * DISKFILE_SECTOR_SIZE) - 2);
+        if ((end[0] != usa[0]) || (end[1] != usa[1]))
+            return -1;
+        end[0] = usa[2 * i];
+        end[1] = usa[2 * i + 1];
+    }
+    return 0;
+}
+
+/**
+ * Read file record
+ *
+ * @v vol		Volume
+ * @v num		Record number
+ * @ret rc		Return status code
+ */
+static int ntfs_read_record (struct ntfs_volume *vol, uint64_t num)
+{
+    if ((diskfile_pread (&vol->mft, ntfs_record, (num * vol->record_size),
+                         vol->record_size) != 0) ||
+        (ntfs_fixup (ntfs_record, vol->record_size, "FILE") != 0) ||
+        (! (ntfs_u16 (ntfs_record + 0x16) & NTFS_RECORD_IN_USE)))
+    {
+        DBG ("bad file record %#llx\n", (unsigned long long) num);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Find attribute within file record
+ *
+ * @v vol		Volume
+ * @v type		Attribute type
+ * @v name		Attribute name
+ * @v name_len		Length of attribute name
+ * @ret attr		Attribute, or NULL
+ */
+static uint8_t *ntfs_find_attr (struct ntfs_volume *vol, uint32_t type,
+                                const uint16_t *name, size_t name_len)
+{
+    uint8_t *attr = (ntfs_record + ntfs_u16 (ntfs_record + 0x14));
+    uint8_t *end = (ntfs_record + vol->record_size);
+    uint32_t attr_type;
+    uint32_t attr_len;
+    int have_list = 0;
+    size_t i;
+
+    while ((attr + 16) <= end)
+    {
+        attr_type = ntfs_u32 (attr);
+        attr_len = ntfs_u32 (attr + 4);
+        if ((attr_type == NTFS_AT_END) || (attr_len < 16) ||
+            (attr_len > (size_t) (end - attr)))
+            break;
+        if (attr_type == NTFS_AT_ATTRIBUTE_LIST)
+            have_list = 1;
+        if ((attr_type == type) && (attr[9] == name_len) &&
+            ((ntfs_u16 (attr + 10) + (2 * name_len)) <= attr_len))
+        {
+            for (i = 0 ; i < name_len ; i++)
+            {
+                if (ntfs_u16 (attr + ntfs_u16 (attr + 10) + (2 * i)) !=
+                    name[i])
+                    break;
+            }
+            if (i == name_len)
+                return attr;
+        }
+        attr += attr_len;
+    }
+
+    if (have_list)
+        DBG ("attribute %#x may be in $ATTRIBUTE_LIST (unsupported)\n", type);
+    return NULL;
+}
+
+/**
+ * Describe attribute value as a file
+ *
+ * @v vol		Volume
+ * @v attr		Attribute
+ * @v file		File to fill in
+ * @ret rc		Return status code
+ */
+static int ntfs_attr_extents (struct ntfs_volume *vol, const uint8_t *attr,
+                              struct diskfile *file)
+{
+    const uint8_t *run;
+    const uint8_t *end;
+    uint64_t vcn = 0;
+    uint64_t length;
+    uint64_t lcn = 0;
+    uint64_t delta;
+    unsigned int len_size;
+    unsigned int ofs_size;
+    unsigned int i;
+    uint32_t attr_len = ntfs_u32 (attr + 4);
+
+    /* Copy resident value */
+    if (! attr[8])
+    {
+        file->len = ntfs_u32 (attr + 0x10);
+        file->valid = file->len;
+        if ((ntfs_u16 (attr + 0x14) + file->len) > attr_len)
+            return -1;
+        file->data = malloc (file->len + 1);
+        if (! file->data)
+            return -1;
+        memcpy (file->data, (attr + ntfs_u16 (attr + 0x14)), file->len);
+        return 0;
+    }
+
+    if (ntfs_u16 (attr + 0x0c) & NTFS_ATTR_UNSUPPORTED)
+    {
+        DBG ("compressed or encrypted attribute\n");
+        return -1;
+    }
+    if (ntfs_u64 (attr + 0x10) != 0)
+        return -1;
+    file->len = ntfs_u64 (attr + 0x30);
+    file->valid = ntfs_u64 (attr + 0x38);
+
+    /* Decode runs */
+    run = (attr + ntfs_u16 (attr + 0x20));
+    end = (attr + attr_len);
+    while ((run < end) && *run)
+    {
+        len_size = (*run & 0x0f);
+        ofs_size = (*run >> 4);
+        if ((len_size == 0) || (len_size > 8) || (ofs_size > 8) ||
+            ((run + 1 + len_size + ofs_size) > end))
+            return -1;
+        run++;
+
+        for (length = 0, i = 0 ; i < len_size ; i++)
+            length |= (((uint64_t) run[i]) << (8 * i));
+        run += len_size;
+        if (ofs_size)
+        {
+            for (delta = 0, i = 0 ; i < ofs_size ; i++)
+                delta |= (((uint64_t) run[i]) << (8 * i));
+            /* Sign-extend relative LCN */
+            for ( ; (run[ofs_size - 1] & 0x80) && (i < 8) ; i++)
+                delta |= (0xffULL << (8 * i));
+            run += ofs_size;
+            lcn += delta;
+            if (diskfile_add_extent (file, (lcn * vol->spc),
+                                     (length * vol->spc)) != 0)
+                return -1;
+        }
+        else if (diskfile_add_extent (file, DISKFILE_HOLE,
+                                      (length * vol->spc)) != 0)
+        {
+            return -1;
+        }
+        vcn += length;
+    }
+
+    /* Check that the runs were complete */
+    if (vcn != (ntfs_u64 (attr + 0x18) + 1))
+    {
+        DBG ("incomplete run list\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Compare name against index key using NTFS collation
+ *
+ * @v name		Name
+ * @v len		Length of name
+ * @v key		Index key ($FILE_NAME)
+ * @ret diff		Difference
+ */
+static int ntfs_collate (const char *name, size_t len, const uint8_t *key)
+{
+    size_t key_len = key[0x40];
+    size_t i;
+    int c1;
+    int c2;
+
+    for (i = 0 ; (i < len) && (i < key_len) ; i++)
+    {
+        c1 = towupper ((unsigned char) name[i]);
+        c2 = towupper (ntfs_u16 (key + 0x42 + (2 * i)));
+        if (c1 != c2)
+            return (c1 - c2);
+    }
+    return ((int) len - (int) key_len);
+}
+
+/**
+ * Search index node
+ *
+ * @v header		Index header
+ * @v avail		Bytes available after index header
+ * @v name		Name
+ * @v len		Length of name
+ * @v ref		File reference to fill in (if found)
+ * @v dir		Directory flag to fill in (if found)
+ * @v vcn		Subnode VCN to fill in (if descending)
+ * @ret rc		0 if found, 1 to descend, or negative if not found
+ */
+static int ntfs_search_node (const uint8_t *header, size_t avail,
+                             const char *name, size_t len, uint64_t *ref,
+                             int *dir, uint64_t *vcn)
+{
+    const uint8_t *entry;
+    const uint8_t *end;
+    unsigned int entry_len;
+    unsigned int key_len;
+    unsigned int flags;
+    int diff = 0;
+
+    if ((ntfs_u32 (header) > avail) || (ntfs_u32 (header + 4) > avail))
+        return -1;
+    entry = (header + ntfs_u32 (header));
+    end = (header + ntfs_u32 (header + 4));
+
+    while ((entry + 16) <= end)
+    {
+        entry_len = ntfs_u16 (entry + 8);
+        key_len = ntfs_u16 (entry + 10);
+        flags = ntfs_u16 (entry + 12);
+        if ((entry_len < 16) || (entry_len > (size_t) (end - entry)))
+            return -1;
+
+        if (! (flags & NTFS_INDEX_LAST))
+        {
+            if ((key_len < 0x42) ||
+                ((0x42U + (2U * entry[16 + 0x40])) > key_len) ||
+                ((16 + key_len) > entry_len))
+                return -1;
+            diff = ntfs_collate (name, len, (entry + 16));
+            if (diff == 0)
+            {
+                *ref = (ntfs_u64 (entry) & 0x0000ffffffffffffULL);
+                *dir = !! (ntfs_u32 (entry + 16 + 0x38) &
+                           NTFS_FILE_NAME_DIRECTORY);
+                return 0;
+            }
+        }
+
+        /* Descend before the first greater entry, or after the last */
+        if ((flags & NTFS_INDEX_LAST) || (diff < 0))
+        {
+            if ((! (flags & NTFS_INDEX_SUBNODE)) || (entry_len < 24))
+                return -1;
+            *vcn = ntfs_u64 (entry + entry_len - 8);
+            return 1;
+        }
+        entry += entry_len;
+    }
+    return -1;
+}
+
+/**
+ * Find name within directory
+ *
+ * @v vol		Volume
+ * @v num		Directory record number (updated to found record)
+ * @v dir		Directory flag to fill in
+ * @v name		Name
+ * @v len		Length of name
+ * @ret rc		Return status code
+ */
+static int ntfs_lookup (struct ntfs_volume *vol, uint64_t *num, int *dir,
+                        const char *name, size_t len)
+{
+    struct diskfile alloc;
+    const uint8_t *root;
+    const uint8_t *value;
+    uint8_t *attr;
+    uint64_t vcn;
+    unsigned int depth;
+    int rc;
+
+    if (ntfs_read_record (vol, *num) != 0)
+        return -1;
+
+    /* Search index root */
+    root = ntfs_find_attr (vol, NTFS_AT_INDEX_ROOT, ntfs_i30,
+                           (sizeof (ntfs_i30) / sizeof (ntfs_i30[0])));
+    if ((! root) || root[8] ||
+        ((ntfs_u16 (root + 0x14) + ntfs_u32 (root + 0x10)) >
+         ntfs_u32 (root + 4)) || (ntfs_u32 (root + 0x10) < 0x20))
+        return -1;
+    value = (root + ntfs_u16 (root + 0x14));
+    rc = ntfs_search_node ((value + 0x10), (ntfs_u32 (root + 0x10) - 0x10),
+                           name, len, num, dir, &vcn);
+    if (rc <= 0)
+        return rc;
+
+    /* Descend through index allocation */
+    memset (&alloc, 0, sizeof (alloc));
+    attr = ntfs_find_attr (vol, NTFS_AT_INDEX_ALLOCATION, ntfs_i30,
+                           (sizeof (ntfs_i30) / sizeof (ntfs_i30[0])));
+    if ((! attr) || (ntfs_attr_extents (vol, attr, &alloc) != 0))
+    {
+        diskfile_free_extents (&alloc);
+        return -1;
+    }
+    for (depth = 0 ; ((rc > 0) && (depth < NTFS_MAX_DEPTH)) ; depth++)
+    {
+        rc = -1;
+        if (((vcn * vol->index_unit) + vol->index_size) > alloc.len)
+            break;
+        if ((diskfile_pread (&alloc, ntfs_index, (vcn * vol->index_unit),
+                             vol->index_size) != 0) ||
+            (ntfs_fixup (ntfs_index, vol->index_size, "INDX") != 0))
+            break;
+        rc = ntfs_search_node ((ntfs_index + 0x18),
+                               (vol->index_size - 0x18),
+                               name, len, num, dir, &vcn);
+    }
+    diskfile_free_extents (&alloc);
+    return ((rc == 0) ? 0 : -1);
+}
+
+/**
+ * Open file on NTFS volume
+ *
+ * @v file		File to fill in
+ * @v path		Path
+ * @v vbr		Volume boot record
+ * @ret rc		Return status code
+ */
+int ntfs_open (struct diskfile *file, const char *path,
+               const union volume_boot_record *vbr)
+{
+    struct ntfs_volume vol;
+    const char *name;
+    uint8_t *attr;
+    uint64_t num = NTFS_ROOT;
+    uint32_t cluster_size;
+    size_t len;
+    int dir = 1;
+    int rc = -1;
+
+    /* Parse boot record */
+    memset (&vol, 0, sizeof (vol));
+    if (vbr->ntfs.bytes_per_sector != DISKFILE_SECTOR_SIZE)
+        return -1;
+    vol.spc = vbr->ntfs.sectors_per_cluster;
+    if (vol.spc > 0x80)
+        vol.spc = (1U << (0x100 - vol.spc));
+    if (! vol.spc)
+        return -1;
+    cluster_size = (vol.spc * DISKFILE_SECTOR_SIZE);
+    vol.record_size = ntfs_block_size (vbr->ntfs.clusters_per_mft,
+                                       cluster_size);
+    vol.index_size = ntfs_block_size (vbr->ntfs.clusters_per_index,
+                                      cluster_size);
+    vol.index_unit = ((vol.index_size < cluster_size) ?
+                      DISKFILE_SECTOR_SIZE : cluster_size);
+    if ((vol.record_size < DISKFILE_SECTOR_SIZE) ||
+        (vol.record_size > NTFS_MAX_BLOCK) ||
+        (vol.index_size < DISKFILE_SECTOR_SIZE) ||
+        (vol.index_size > NTFS_MAX_BLOCK))
+    {
+        DBG ("unsupported NTFS record size %#x/%#x\n",
+             vol.record_size, vol.index_size);
+        return -1;
+    }
+
+    /* Describe $MFT, bootstrapping from its first record */
+    if (diskfile_add_extent (&vol.mft, (vbr->ntfs.mft_lcn * vol.spc),
+                             (vol.record_size / DISKFILE_SECTOR_SIZE)) != 0)
+        goto out;
+    vol.mft.len = vol.mft.valid = vol.record_size;
+    if (ntfs_read_record (&vol, NTFS_MFT) != 0)
+        goto out;
+    diskfile_free_extents (&vol.mft);
+    attr = ntfs_find_attr (&vol, NTFS_AT_DATA, NULL, 0);
+    if ((! attr) || (! attr[8]) ||
+        (ntfs_attr_extents (&vol, attr, &vol.mft) != 0))
+        goto out;
+
+    /* Walk path from root directory */
+    while ((name = diskfile_next_name (&path, &len)) != NULL)
+    {
+        if ((! dir) || (ntfs_lookup (&vol, &num, &dir, name, len) != 0))
+        {
+            DBG ("%.*s not found\n", ((int) len), name);
+            goto out;
+        }
+    }
+    if (dir)
+        goto out;
+
+    /* Describe unnamed data stream */
+    if (ntfs_read_record (&vol, num) != 0)
+        goto out;
+    attr = ntfs_find_attr (&vol, NTFS_AT_DATA, NULL, 0);
+    if ((! attr) || (ntfs_attr_extents (&vol, attr, file) != 0))
+        goto out;
+
+    rc = 0;
+ out:
+    diskfile_free_extents (&vol.mft);
+    return rc;
+}
@@ -0,0 +1,835 @@
+	.file	"ntfs.c"
+	.text
+	.type	ntfs_u32, @function
+ntfs_u32:
+	movl	(%rdi), %eax
+	ret
+	.size	ntfs_u32, .-ntfs_u32
+	.type	ntfs_u64, @function
+ntfs_u64:
+	call	ntfs_u32
+	addq	$4, %rdi
+	movl	%eax, %edx
+	call	ntfs_u32
+	salq	$32, %rax
+	orq	%rdx, %rax
+	ret
+	.size	ntfs_u64, .-ntfs_u64
+	.type	ntfs_fixup, @function
+ntfs_fixup:
+	pushq	%rbp
+	movq	%rsi, %rbp
+	movq	%rdx, %rsi
+	movl	$4, %edx
+	pushq	%rbx
+	movq	%rdi, %rbx
+	pushq	%rcx
+	call	memcmp
+	testl	%eax, %eax
+	je	.L4
+.L6:
+	orl	$-1, %ecx
+	jmp	.L3
+.L4:
+	movzwl	4(%rbx), %esi
+	movzwl	6(%rbx), %edi
+	movq	%rsi, %rdx
+	testl	%edi, %edi
+	je	.L6
+	movq	%rbp, %r8
+	movl	%eax, %ecx
+	leal	-1(%rdi), %eax
+	shrq	$9, %r8
+	cmpq	%r8, %rax
+	jne	.L6
+	leal	(%rsi,%rdi,2), %eax
+	cmpq	%rax, %rbp
+	jb	.L6
+	addq	%rbx, %rdx
+	leaq	510(%rbx), %rax
+	movl	$1, %esi
+.L7:
+	cmpl	%edi, %esi
+	jnb	.L3
+	movb	(%rdx), %bl
+	cmpb	%bl, (%rax)
+	jne	.L6
+	movb	1(%rdx), %bl
+	cmpb	%bl, 1(%rax)
+	jne	.L6
+	movb	(%rdx,%rsi,2), %r8b
+	addq	$512, %rax
+	movb	%r8b, -512(%rax)
+	movb	1(%rdx,%rsi,2), %r8b
+	incq	%rsi
+	movb	%r8b, -511(%rax)
+	jmp	.L7
+.L3:
+	popq	%rdx
+	movl	%ecx, %eax
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	ntfs_fixup, .-ntfs_fixup
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"bad file record %#llx\n"
+.LC1:
+	.string	"FILE"
+	.text
+	.type	ntfs_read_record, @function
+ntfs_read_record:
+	pushq	%r12
+	leaq	ntfs_record(%rip), %r12
+	pushq	%rbp
+	movq	%rsi, %rbp
+	pushq	%rbx
+	movl	4(%rdi), %ecx
+	movq	%rdi, %rbx
+	addq	$16, %rdi
+	movq	%rcx, %rdx
+	imulq	%rsi, %rdx
+	movq	%r12, %rsi
+	call	diskfile_pread
+	testl	%eax, %eax
+	je	.L15
+.L17:
+	movq	%rbp, %rsi
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	orl	$-1, %eax
+	jmp	.L14
+.L15:
+	movl	4(%rbx), %esi
+	leaq	.LC1(%rip), %rdx
+	movq	%r12, %rdi
+	call	ntfs_fixup
+	testl	%eax, %eax
+	jne	.L17
+	testb	$1, 22+ntfs_record(%rip)
+	je	.L17
+.L14:
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	ntfs_read_record, .-ntfs_read_record
+	.section	.rodata.str1.1
+.LC2:
+	.string	"compressed or encrypted attribute\n"
+.LC3:
+	.string	"incomplete run list\n"
+	.text
+	.type	ntfs_attr_extents, @function
+ntfs_attr_extents:
+	pushq	%r15
+	movq	%rdi, %r15
+	leaq	4(%rsi), %rdi
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	movq	%rdx, %rbp
+	pushq	%rbx
+	movq	%rsi, %rbx
+	subq	$24, %rsp
+	call	ntfs_u32
+	cmpb	$0, 8(%rsi)
+	movl	%eax, %ecx
+	jne	.L23
+	leaq	16(%rsi), %rdi
+	call	ntfs_u32
+	movl	%eax, %eax
+	movq	%rax, (%rdx)
+	movq	%rax, 8(%rdx)
+	movzwl	20(%rsi), %edx
+	addq	%rax, %rdx
+	cmpq	%rdx, %rcx
+	jb	.L25
+	leaq	1(%rax), %rdi
+	call	malloc
+	movq	%rax, 16(%rbp)
+	movq	%rax, %rdi
+	testq	%rax, %rax
+	je	.L25
+	movzwl	20(%rbx), %esi
+	movq	0(%rbp), %rdx
+	addq	%rbx, %rsi
+	call	memcpy
+	jmp	.L27
+.L23:
+	leaq	.LC2(%rip), %rdi
+	testw	$16639, 12(%rsi)
+	jne	.L51
+	leaq	16(%rsi), %rdi
+	call	ntfs_u64
+	testq	%rax, %rax
+	jne	.L25
+	leaq	48(%rsi), %rdi
+	xorl	%r14d, %r14d
+	xorl	%r13d, %r13d
+	call	ntfs_u64
+	leaq	56(%rsi), %rdi
+	movq	%rax, 0(%rbp)
+	call	ntfs_u64
+	movq	%rax, 8(%rbp)
+	leaq	(%rsi,%rcx), %rax
+	movzwl	32(%rsi), %r8d
+	movq	%rax, (%rsp)
+	addq	%rsi, %r8
+.L29:
+	movq	(%rsp), %rax
+	cmpq	%rax, %r8
+	jnb	.L37
+	movb	(%r8), %al
+	testb	%al, %al
+	je	.L37
+	movl	%eax, %r10d
+	movl	%eax, %esi
+	shrb	$4, %al
+	andl	$15, %r10d
+	andl	$15, %esi
+	leal	-1(%r10), %edx
+	cmpl	$7, %edx
+	ja	.L25
+	cmpb	$8, %al
+	ja	.L25
+	movzbl	%sil, %esi
+	movzbl	%al, %edx
+	leaq	1(%rsi,%rdx), %r9
+	addq	%r8, %r9
+	cmpq	%r9, (%rsp)
+	jb	.L25
+	xorl	%edx, %edx
+	xorl	%r12d, %r12d
+.L30:
+	movzbl	1(%r8,%rdx), %edi
+	leal	0(,%rdx,8), %ecx
+	incq	%rdx
+	salq	%cl, %rdi
+	orq	%rdi, %r12
+	cmpl	%r10d, %edx
+	jb	.L30
+	leaq	1(%r8,%rsi), %r8
+	movl	(%r15), %esi
+	movq	%r12, %r10
+	imulq	%rsi, %r10
+	testb	%al, %al
+	je	.L31
+	movzbl	%al, %eax
+	xorl	%edi, %edi
+	xorl	%edx, %edx
+.L32:
+	movzbl	(%r8,%rdi), %r11d
+	leal	0(,%rdi,8), %ecx
+	incq	%rdi
+	salq	%cl, %r11
+	orq	%r11, %rdx
+	cmpl	%eax, %edi
+	jb	.L32
+	leal	-1(%rax), %ecx
+	movb	(%r8,%rcx), %dil
+	shrb	$7, %dil
+.L33:
+	cmpl	$8, %eax
+	je	.L41
+	testb	%dil, %dil
+	je	.L41
+	leal	0(,%rax,8), %ecx
+	movl	$255, %r11d
+	incl	%eax
+	salq	%cl, %r11
+	orq	%r11, %rdx
+	jmp	.L33
+.L41:
+	addq	%rdx, %r14
+	movq	%rbp, %rdi
+	movq	%r10, %rdx
+	movq	%r9, 8(%rsp)
+	imulq	%r14, %rsi
+	call	diskfile_add_extent
+	testl	%eax, %eax
+	jne	.L25
+	movq	8(%rsp), %r8
+	jmp	.L36
+.L31:
+	orq	$-1, %rsi
+	movq	%r10, %rdx
+	movq	%rbp, %rdi
+	movq	%r8, 8(%rsp)
+	call	diskfile_add_extent
+	movq	8(%rsp), %r8
+	testl	%eax, %eax
+	jne	.L25
+.L36:
+	addq	%r12, %r13
+	jmp	.L29
+.L37:
+	leaq	24(%rbx), %rdi
+	call	ntfs_u64
+	incq	%rax
+	cmpq	%r13, %rax
+	jne	.L39
+.L27:
+	xorl	%eax, %eax
+	jmp	.L22
+.L39:
+	leaq	.LC3(%rip), %rdi
+.L51:
+	xorl	%eax, %eax
+	call	printf
+.L25:
+	orl	$-1, %eax
+.L22:
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	ntfs_attr_extents, .-ntfs_attr_extents
+	.section	.rodata.str1.1
+.LC4:
+	.string	"attribute %#x may be in $ATTRIBUTE_LIST (unsupported)\n"
+	.text
+	.type	ntfs_find_attr.isra.0, @function
+ntfs_find_attr.isra.0:
+	pushq	%r14
+	movq	%rdx, %r10
+	leaq	ntfs_record(%rip), %rax
+	movl	%esi, %r9d
+	pushq	%rbx
+	movq	%rcx, %rsi
+	movl	%edi, %ecx
+	xorl	%r11d, %r11d
+	pushq	%r8
+	movzwl	20+ntfs_record(%rip), %edx
+	addq	%rax, %rcx
+	leaq	(%rsi,%rsi), %rbx
+	addq	%rax, %rdx
+.L53:
+	leaq	16(%rdx), %rax
+	cmpq	%rax, %rcx
+	jb	.L54
+	movq	%rdx, %rdi
+	call	ntfs_u32
+	leaq	4(%rdx), %rdi
+	movl	%eax, %r8d
+	call	ntfs_u32
+	cmpl	$-1, %r8d
+	je	.L54
+	cmpl	$15, %eax
+	jbe	.L54
+	movq	%rcx, %rdi
+	movl	%eax, %eax
+	subq	%rdx, %rdi
+	cmpq	%rax, %rdi
+	jb	.L54
+	cmpl	$32, %r8d
+	je	.L61
+	cmpl	%r9d, %r8d
+	jne	.L55
+	movzbl	9(%rdx), %edi
+	cmpq	%rsi, %rdi
+	jne	.L55
+	movzwl	10(%rdx), %r8d
+	leaq	(%r8,%rbx), %rdi
+	cmpq	%rdi, %rax
+	jb	.L55
+	xorl	%edi, %edi
+	addq	%rdx, %r8
+.L56:
+	cmpq	%rdi, %rsi
+	je	.L52
+	movw	(%r8,%rdi,2), %r14w
+	cmpw	%r14w, (%r10,%rdi,2)
+	jne	.L55
+	incq	%rdi
+	jmp	.L56
+.L61:
+	movl	$1, %r11d
+.L55:
+	addq	%rax, %rdx
+	jmp	.L53
+.L54:
+	testl	%r11d, %r11d
+	je	.L60
+	movl	%r9d, %esi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L60:
+	xorl	%edx, %edx
+.L52:
+	movq	%rdx, %rax
+	popq	%rdx
+	popq	%rbx
+	popq	%r14
+	ret
+	.size	ntfs_find_attr.isra.0, .-ntfs_find_attr.isra.0
+	.type	ntfs_search_node, @function
+ntfs_search_node:
+	pushq	%r15
+	movq	%rcx, %r10
+	orl	$-1, %ecx
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	movq	%rsi, %rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	call	ntfs_u32
+	movl	%eax, %esi
+	cmpq	%rsi, %rbp
+	jb	.L67
+	leaq	4(%rdi), %rdi
+	call	ntfs_u32
+	movl	%eax, %eax
+	cmpq	%rax, %rbp
+	jb	.L67
+	addq	%rbx, %rsi
+	movq	%rdx, %r11
+	addq	%rax, %rbx
+.L69:
+	leaq	16(%rsi), %rax
+	cmpq	%rax, %rbx
+	jb	.L87
+	movzwl	8(%rsi), %r12d
+	movw	10(%rsi), %dx
+	movw	12(%rsi), %bp
+	movq	%r12, %rax
+	cmpw	$15, %r12w
+	jbe	.L87
+	movq	%rbx, %rcx
+	subq	%rsi, %rcx
+	cmpq	%r12, %rcx
+	jb	.L87
+	testb	$2, %bpl
+	jne	.L70
+	movzwl	%dx, %ecx
+	cmpw	$65, %dx
+	jbe	.L87
+	movzbl	80(%rsi), %edi
+	movl	%edi, %edx
+	leal	66(%rdi,%rdi), %edi
+	cmpl	%edi, %ecx
+	jb	.L87
+	addl	$16, %ecx
+	cmpl	%ecx, %r12d
+	jb	.L87
+	movzbl	%dl, %ecx
+	xorl	%r13d, %r13d
+	movq	%rcx, %rdi
+	cmpq	%rcx, %r10
+	cmovbe	%r10, %rdi
+.L71:
+	cmpq	%rdi, %r13
+	jnb	.L89
+	movzbl	(%r11,%r13), %ecx
+	leal	-97(%rcx), %r14d
+	cmpl	$25, %r14d
+	ja	.L72
+	subl	$32, %ecx
+.L72:
+	movzwl	82(%rsi,%r13,2), %r14d
+	leal	-97(%r14), %r15d
+	cmpl	$25, %r15d
+	ja	.L73
+	subl	$32, %r14d
+.L73:
+	cmpl	%ecx, %r14d
+	je	.L74
+	subl	%r14d, %ecx
+	jmp	.L75
+.L74:
+	incq	%r13
+	jmp	.L71
+.L89:
+	movl	%r10d, %ecx
+	subl	%edx, %ecx
+.L75:
+	testl	%ecx, %ecx
+	jne	.L77
+	movq	%rsi, %rdi
+	call	ntfs_u64
+	leaq	72(%rsi), %rdi
+	movabsq	$281474976710655, %rdx
+	andq	%rdx, %rax
+	movq	%rax, (%r8)
+	call	ntfs_u32
+	shrl	$28, %eax
+	andl	$1, %eax
+	movl	%eax, (%r9)
+	jmp	.L67
+.L77:
+	jns	.L78
+.L70:
+	cmpl	$23, %r12d
+	jbe	.L87
+	andb	$1, %bpl
+	je	.L87
+	leaq	-8(%rsi,%rax), %rdi
+	movl	$1, %ecx
+	call	ntfs_u64
+	movq	56(%rsp), %rdx
+	movq	%rax, (%rdx)
+	jmp	.L67
+.L78:
+	addq	%rax, %rsi
+	jmp	.L69
+.L87:
+	orl	$-1, %ecx
+.L67:
+	popq	%rbx
+	movl	%ecx, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	ntfs_search_node, .-ntfs_search_node
+	.section	.rodata.str1.1
+.LC5:
+	.string	"unsupported NTFS record size %#x/%#x\n"
+.LC6:
+	.string	"INDX"
+.LC7:
+	.string	"%.*s not found\n"
+	.text
+	.globl	ntfs_open
+	.hidden	ntfs_open
+	.type	ntfs_open, @function
+ntfs_open:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rdx, %rbx
+	movl	$56, %edx
+	subq	$200, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 184(%rsp)
+	xorl	%eax, %eax
+	movq	%rdi, 32(%rsp)
+	leaq	128(%rsp), %rax
+	movq	%rsi, 40(%rsp)
+	movq	%rax, %rdi
+	xorl	%esi, %esi
+	movq	$5, 64(%rsp)
+	movl	$1, 60(%rsp)
+	movq	%rax, (%rsp)
+	call	memset
+	cmpw	$512, 11(%rbx)
+	jne	.L92
+	movzbl	13(%rbx), %esi
+	cmpl	$128, %esi
+	jbe	.L93
+	negl	%esi
+	movl	$1, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	movl	%eax, %esi
+.L93:
+	movl	%esi, 128(%rsp)
+	testl	%esi, %esi
+	je	.L92
+	movsbl	64(%rbx), %ecx
+	movl	%esi, %edi
+	sall	$9, %edi
+	testb	%cl, %cl
+	jle	.L95
+	movl	%ecx, %eax
+	imull	%edi, %eax
+	jmp	.L96
+.L95:
+	xorl	%eax, %eax
+	cmpb	$-31, %cl
+	jl	.L96
+	negl	%ecx
+	movl	$1, %eax
+	sall	%cl, %eax
+.L96:
+	movb	68(%rbx), %cl
+	movl	%eax, 132(%rsp)
+	testb	%cl, %cl
+	jle	.L97
+	movsbl	%cl, %edx
+	imull	%edi, %edx
+	jmp	.L98
+.L97:
+	xorl	%edx, %edx
+	cmpb	$-31, %cl
+	jl	.L98
+	negl	%ecx
+	movl	$1, %edx
+	sall	%cl, %edx
+.L98:
+	movl	%edx, 136(%rsp)
+	cmpl	%edi, %edx
+	jnb	.L99
+	movl	$512, %edi
+.L99:
+	leal	-512(%rdx), %ecx
+	movl	%edi, 140(%rsp)
+	cmpl	$3584, %ecx
+	ja	.L126
+	leal	-512(%rax), %ecx
+	cmpl	$3584, %ecx
+	jbe	.L100
+.L126:
+	movl	%eax, %esi
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L92:
+	orl	$-1, %ebx
+	jmp	.L90
+.L100:
+	shrl	$9, %eax
+	imulq	48(%rbx), %rsi
+	movl	%eax, %edx
+	leaq	144(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	diskfile_add_extent
+	testl	%eax, %eax
+	jne	.L104
+	movl	132(%rsp), %eax
+	movq	(%rsp), %rdi
+	xorl	%esi, %esi
+	movq	%rax, 152(%rsp)
+	movq	%rax, 144(%rsp)
+	call	ntfs_read_record
+	testl	%eax, %eax
+	jne	.L104
+	movq	8(%rsp), %rdi
+	call	diskfile_free_extents
+	movl	132(%rsp), %edi
+	xorl	%ecx, %ecx
+	xorl	%edx, %edx
+	movl	$128, %esi
+	call	ntfs_find_attr.isra.0
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L104
+	cmpb	$0, 8(%rax)
+	je	.L104
+	movq	8(%rsp), %rdx
+	movq	(%rsp), %rdi
+	call	ntfs_attr_extents
+	testl	%eax, %eax
+	je	.L106
+	jmp	.L104
+.L148:
+	movq	64(%rsp), %rsi
+	movq	(%rsp), %rdi
+	call	ntfs_read_record
+	testl	%eax, %eax
+	jne	.L108
+	movl	132(%rsp), %edi
+	movl	$4, %ecx
+	movl	$144, %esi
+	leaq	ntfs_i30(%rip), %rdx
+	call	ntfs_find_attr.isra.0
+	movq	%rax, %rdx
+	testq	%rax, %rax
+	je	.L108
+	cmpb	$0, 8(%rax)
+	jne	.L108
+	movzwl	20(%rax), %r8d
+	leaq	16(%rax), %rdi
+	call	ntfs_u32
+	leaq	4(%rdx), %rdi
+	movq	%r8, %rsi
+	movl	%eax, %ecx
+	addl	%eax, %r8d
+	call	ntfs_u32
+	cmpl	%r8d, %eax
+	jb	.L108
+	cmpl	$31, %ecx
+	jbe	.L108
+	leaq	60(%rsp), %rax
+	leaq	64(%rsp), %r12
+	movq	%rax, 24(%rsp)
+	leaq	16(%rdx,%rsi), %rdi
+	leal	-16(%rcx), %eax
+	movq	%r12, %r8
+	pushq	%rsi
+	movq	%rbx, %rdx
+	movq	%rax, %rsi
+	leaq	88(%rsp), %r13
+	pushq	%r13
+	movq	40(%rsp), %r9
+	movq	32(%rsp), %rcx
+	call	ntfs_search_node
+	popq	%rdi
+	popq	%r8
+	testl	%eax, %eax
+	jle	.L111
+	leaq	88(%rsp), %rbp
+	movl	$40, %edx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	call	memset
+	movl	$160, %esi
+	movl	132(%rsp), %edi
+	movl	$4, %ecx
+	leaq	ntfs_i30(%rip), %rdx
+	call	ntfs_find_attr.isra.0
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L113
+	movq	(%rsp), %rdi
+	movq	%rbp, %rdx
+	call	ntfs_attr_extents
+	testl	%eax, %eax
+	jne	.L113
+	xorl	%ebp, %ebp
+	leaq	ntfs_index(%rip), %r14
+.L116:
+	movl	140(%rsp), %edx
+	imulq	80(%rsp), %rdx
+	leaq	88(%rsp), %r15
+	movl	136(%rsp), %ecx
+	leaq	(%rdx,%rcx), %rax
+	cmpq	%rax, 88(%rsp)
+	jb	.L115
+	movq	%r14, %rsi
+	movq	%r15, %rdi
+	call	diskfile_pread
+	testl	%eax, %eax
+	jne	.L115
+	movl	136(%rsp), %esi
+	leaq	.LC6(%rip), %rdx
+	movq	%r14, %rdi
+	call	ntfs_fixup
+	testl	%eax, %eax
+	jne	.L115
+	movl	136(%rsp), %eax
+	movq	%rbx, %rdx
+	movq	%r12, %r8
+	incl	%ebp
+	leaq	24+ntfs_index(%rip), %rdi
+	leal	-24(%rax), %esi
+	pushq	%rax
+	pushq	%r13
+	movq	40(%rsp), %r9
+	movq	32(%rsp), %rcx
+	call	ntfs_search_node
+	popq	%rdx
+	popq	%rcx
+	movl	%eax, %r15d
+	testl	%eax, %eax
+	jg	.L146
+.L127:
+	leaq	88(%rsp), %rdi
+	call	diskfile_free_extents
+	testl	%r15d, %r15d
+	jne	.L108
+.L106:
+	leaq	72(%rsp), %rsi
+	leaq	40(%rsp), %rdi
+	call	diskfile_next_name
+	movq	%rax, %rbx
+	movl	60(%rsp), %eax
+	testq	%rbx, %rbx
+	je	.L147
+	movq	72(%rsp), %rcx
+	movq	%rcx, 16(%rsp)
+	testl	%eax, %eax
+	jne	.L148
+.L108:
+	movl	72(%rsp), %esi
+	movq	%rbx, %rdx
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L104:
+	orl	$-1, %ebx
+	jmp	.L120
+.L113:
+	movq	%rbp, %rdi
+	jmp	.L145
+.L115:
+	movq	%r15, %rdi
+.L145:
+	call	diskfile_free_extents
+	jmp	.L108
+.L146:
+	cmpl	$31, %ebp
+	jbe	.L116
+	jmp	.L127
+.L111:
+	je	.L106
+	jmp	.L108
+.L147:
+	testl	%eax, %eax
+	jne	.L104
+	movq	64(%rsp), %rsi
+	movq	(%rsp), %rdi
+	call	ntfs_read_record
+	testl	%eax, %eax
+	jne	.L104
+	movl	132(%rsp), %edi
+	movl	$128, %esi
+	xorl	%ecx, %ecx
+	xorl	%edx, %edx
+	call	ntfs_find_attr.isra.0
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L104
+	movq	32(%rsp), %rdx
+	movq	(%rsp), %rdi
+	call	ntfs_attr_extents
+	negl	%eax
+	sbbl	%ebx, %ebx
+.L120:
+	movq	8(%rsp), %rdi
+	call	diskfile_free_extents
+.L90:
+	movq	184(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L122
+	call	__stack_chk_fail@PLT
+.L122:
+	addq	$200, %rsp
+	movl	%ebx, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	ntfs_open, .-ntfs_open
+	.local	ntfs_index
+	.comm	ntfs_index,4096,32
+	.local	ntfs_record
+	.comm	ntfs_record,4096,32
+	.section	.rodata
+	.align 8
+	.type	ntfs_i30, @object
+	.size	ntfs_i30, 8
+ntfs_i30:
+	.value	36
+	.value	73
+	.value	51
+	.value	48
+	.hidden	diskfile_next_name
+	.hidden	diskfile_free_extents
+	.hidden	memset
+	.hidden	diskfile_add_extent
+	.hidden	memcpy
+	.hidden	malloc
+	.hidden	printf
+	.hidden	diskfile_pread
+	.hidden	memcmp
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -19,7 +19,7 @@
 #ifndef _BCD_BOOT_H
 #define _BCD_BOOT_H 1
 
-#include <ntloader.h>
+#include "ntloader.h"
 #include <stdint.h>
 
 #define GUID_WIMB L"{19260817-6666-8888-abcd-000000000000}"
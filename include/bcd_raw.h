@@ -0,0 +1,2239 @@
+unsigned char bcd_raw[] __attribute__ ((section (".bcd"), aligned (512))) = {
+  0x72, 0x65, 0x67, 0x66, 0x76, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 
+  0x00, 0xf2, 0xcd, 0xad, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x01, 0x00, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x5c, 
+  0x00, 0x44, 0x00, 0x3a, 0x00, 0x5c, 0x00, 0x61, 0x00, 0x5c, 0x00, 
+  0x6e, 0x00, 0x74, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x5c, 
+  0x00, 0x6e, 0x00, 0x74, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 
+  0x5c, 0x00, 0x62, 0x00, 0x75, 0x00, 0x69, 0x00, 0x6c, 0x00, 0x64, 
+  0x00, 0x5c, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xd2, 0x39, 0xa4, 0xac, 0x41, 0xf2, 0xef, 0x11, 0x93, 
+  0x44, 0x7c, 0x1e, 0x52, 0x00, 0xb6, 0xb3, 0xd2, 0x39, 0xa4, 0xac, 
+  0x41, 0xf2, 0xef, 0x11, 0x93, 0x44, 0x7c, 0x1e, 0x52, 0x00, 0xb6, 
+  0xb3, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x39, 0xa4, 0xac, 0x41, 0xf2, 
+  0xef, 0x11, 0x93, 0x44, 0x7c, 0x1e, 0x52, 0x00, 0xb6, 0xb3, 0x72, 
+  0x6d, 0x74, 0x6d, 0xf2, 0xcd, 0xad, 0x43, 0x4f, 0x86, 0xdb, 0x01, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x70, 0xd7, 0xc3, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x68, 0x62, 0x69, 0x6e, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xf2, 0xcd, 0xad, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x00, 
+  0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x2c, 0x00, 
+  0xf2, 0xcd, 0xad, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0xd0, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x4e, 0x65, 0x77, 0x53, 0x74, 
+  0x6f, 0x72, 0x65, 0x52, 0x6f, 0x6f, 0x74, 0x00, 0x00, 0x00, 0x00, 
+  0x70, 0xff, 0xff, 0xff, 0x73, 0x6b, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0x48, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x74, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x58, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 
+  0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 
+  0x00, 0x3f, 0x00, 0x0f, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 
+  0x00, 0x14, 0x00, 0x3f, 0x00, 0x0f, 0x00, 0x01, 0x01, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 
+  0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 
+  0x00, 0x00, 0x00, 0xb3, 0xb3, 0x33, 0x07, 0x61, 0x88, 0x85, 0xbb, 
+  0x99, 0xc3, 0x24, 0x52, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xc0, 0xb3, 
+  0x35, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 
+  0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x31, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x07, 0x00, 0x00, 0x00, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73, 
+  0x00, 0xf8, 0xff, 0xff, 0xff, 0x80, 0x02, 0x00, 0x00, 0x88, 0xff, 
+  0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xc0, 0xb3, 0x35, 0x44, 0x4f, 
+  0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x16, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 
+  0x00, 0x7b, 0x39, 0x64, 0x65, 0x61, 0x38, 0x36, 0x32, 0x63, 0x2d, 
+  0x35, 0x63, 0x64, 0x64, 0x2d, 0x34, 0x65, 0x37, 0x30, 0x2d, 0x61, 
+  0x63, 0x63, 0x31, 0x2d, 0x66, 0x33, 0x32, 0x62, 0x33, 0x34, 0x34, 
+  0x64, 0x34, 0x37, 0x39, 0x35, 0x7d, 0x00, 0x00, 0xf0, 0xff, 0xff, 
+  0xff, 0x6c, 0x66, 0x01, 0x00, 0x20, 0x08, 0x00, 0x00, 0x31, 0x32, 
+  0x30, 0x30, 0xf0, 0xff, 0xff, 0xff, 0x65, 0x00, 0x6e, 0x00, 0x2d, 
+  0x00, 0x75, 0x00, 0x73, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0xc0, 0xb3, 0x35, 0x44, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 
+  0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x18, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 
+  0x00, 0x08, 0x02, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x10, 0x01, 
+  0x00, 0x00, 0x4f, 0x62, 0x6a, 0x65, 0xe0, 0xff, 0xff, 0xff, 0x76, 
+  0x6b, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4b, 0x65, 0x79, 
+  0x4e, 0x61, 0x6d, 0x65, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x42, 0x00, 
+  0x43, 0x00, 0x44, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x31, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0x66, 0x51, 0x33, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 
+  0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x04, 0x00, 0x04, 0x00, 
+  0x00, 0x80, 0x02, 0x00, 0x10, 0x10, 0x04, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x48, 0x00, 0x00, 0x00, 
+  0xf8, 0xff, 0xff, 0xff, 0x20, 0x03, 0x00, 0x00, 0x70, 0xff, 0xff, 
+  0xff, 0x73, 0x6b, 0x34, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 
+  0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x19, 0x00, 
+  0x06, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 
+  0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 
+  0x3f, 0x00, 0x0f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x05, 0x12, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x00, 
+  0xb3, 0xb3, 0x33, 0x07, 0x61, 0x88, 0x85, 0xbb, 0x99, 0xc3, 0x24, 
+  0x52, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 
+  0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xc0, 0xb3, 0x35, 0x44, 0x4f, 
+  0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x41, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x10, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+  0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0xe8, 0xff, 
+  0xff, 0xff, 0x6c, 0x66, 0x02, 0x00, 0xc0, 0x02, 0x00, 0x00, 0x44, 
+  0x65, 0x73, 0x63, 0xd8, 0x03, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x5e, 0x30, 0xb0, 
+  0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
+  0xd8, 0x04, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 
+  0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 
+  0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x12, 0x00, 0x00, 
+  0x00, 0xc0, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xe8, 
+  0xff, 0xff, 0xff, 0x4e, 0x00, 0x54, 0x00, 0x6c, 0x00, 0x6f, 0x00, 
+  0x61, 0x00, 0x64, 0x00, 0x65, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xf8, 0xff, 0xff, 0xff, 0xa0, 0x04, 0x00, 0x00, 0xa8, 0xff, 
+  0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xad, 0x92, 0xb2, 0x43, 0x4f, 
+  0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x70, 0x05, 
+  0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+  0x00, 0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x35, 0xf0, 0xff, 
+  0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 
+  0x32, 0x30, 0x30, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0x05, 0x00, 0x00, 
+  0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x0c, 0x00, 0x00, 
+  0x00, 0xf8, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xf8, 
+  0xff, 0xff, 0xff, 0x50, 0x05, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0x4c, 0x57, 0xb7, 0x43, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x48, 0x05, 0x00, 0x00, 
+  0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 
+  0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 0xf8, 0xff, 0xff, 0xff, 
+  0xe0, 0x3f, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 
+  0x00, 0x4e, 0x00, 0x00, 0x00, 0x18, 0x42, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x30, 0x30, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x30, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x99, 
+  0xb9, 0xb9, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 
+  0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 
+  0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0x30, 0x30, 
+  0x32, 0x30, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x01, 
+  0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+  0x00, 0xf8, 0xff, 0xff, 0xff, 0x70, 0x06, 0x00, 0x00, 0x88, 0xff, 
+  0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x46, 0x7e, 0xbe, 0x43, 0x4f, 
+  0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x16, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 
+  0x00, 0x7b, 0x37, 0x65, 0x61, 0x32, 0x65, 0x31, 0x61, 0x63, 0x2d, 
+  0x32, 0x65, 0x36, 0x31, 0x2d, 0x34, 0x37, 0x32, 0x38, 0x2d, 0x61, 
+  0x61, 0x61, 0x33, 0x2d, 0x38, 0x39, 0x36, 0x64, 0x39, 0x64, 0x30, 
+  0x61, 0x39, 0x66, 0x30, 0x65, 0x7d, 0x00, 0x00, 0xf8, 0xff, 0xff, 
+  0xff, 0xa0, 0x0c, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x40, 0x0d, 
+  0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xb0, 0x09, 0x00, 0x00, 0xa0, 
+  0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x46, 0x7e, 0xbe, 0x43, 
+  0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x98, 0x06, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xa8, 
+  0x07, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 
+  0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 
+  0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 
+  0x76, 0x6b, 0x04, 0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 
+  0x20, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x79, 
+  0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x88, 
+  0x07, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0x46, 0x7e, 0xbe, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x98, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xe8, 0x01, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x73, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 0x00, 
+  0x28, 0x07, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0xb0, 0x07, 0x00, 
+  0x00, 0x45, 0x6c, 0x65, 0x6d, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 
+  0x20, 0x00, 0x46, 0x7e, 0xbe, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 
+  0x00, 0x00, 0x00, 0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0x00, 0x00, 0x00, 0xa8, 0x08, 0x00, 0x00, 0x48, 0x03, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x32, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x35, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x98, 0x08, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x65, 0x00, 0x6e, 
+  0x00, 0x2d, 0x00, 0x75, 0x00, 0x73, 0x00, 0x00, 0x00, 0xf8, 0xff, 
+  0xff, 0xff, 0x78, 0x08, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0x6e, 
+  0x6b, 0x20, 0x00, 0xc5, 0xe0, 0xc0, 0x43, 0x4f, 0x86, 0xdb, 0x01, 
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0a, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7b, 0x36, 
+  0x65, 0x66, 0x62, 0x35, 0x32, 0x62, 0x66, 0x2d, 0x31, 0x37, 0x36, 
+  0x36, 0x2d, 0x34, 0x31, 0x64, 0x62, 0x2d, 0x61, 0x36, 0x62, 0x33, 
+  0x2d, 0x30, 0x65, 0x65, 0x35, 0x65, 0x66, 0x66, 0x37, 0x32, 0x62, 
+  0x64, 0x37, 0x7d, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x88, 0x18, 
+  0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xc8, 0x19, 0x00, 0x00, 0xf8, 
+  0xff, 0xff, 0xff, 0xb0, 0x16, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 
+  0x98, 0x17, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xd0, 0x1a, 0x00, 
+  0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xc5, 0xe0, 
+  0xc0, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xb0, 
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 
+  0x00, 0x20, 0x07, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0b, 0x00, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 
+  0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 
+  0xff, 0xff, 0x76, 0x6b, 0x04, 0x00, 0x04, 0x00, 0x00, 0x80, 0x03, 
+  0x00, 0x20, 0x20, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 
+  0xff, 0x6e, 0x6b, 0x20, 0x00, 0xc5, 0xe0, 0xc0, 0x43, 0x4f, 0x86, 
+  0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xb0, 0x08, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0xe8, 0xff, 0xff, 
+  0xff, 0x6c, 0x66, 0x02, 0x00, 0x50, 0x09, 0x00, 0x00, 0x44, 0x65, 
+  0x73, 0x63, 0xd0, 0x09, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x88, 
+  0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xdf, 0xa3, 0xe4, 0x43, 
+  0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x0b, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 
+  0x00, 0x00, 0x7b, 0x31, 0x39, 0x32, 0x36, 0x30, 0x38, 0x31, 0x37, 
+  0x2d, 0x36, 0x36, 0x36, 0x36, 0x2d, 0x38, 0x38, 0x38, 0x38, 0x2d, 
+  0x61, 0x62, 0x63, 0x64, 0x2d, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x00, 0x00, 0xa0, 0xff, 
+  0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xdf, 0xa3, 0xe4, 0x43, 0x4f, 
+  0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x40, 0x0a, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0b, 
+  0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 
+  0x00, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 
+  0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 
+  0x6b, 0x04, 0x00, 0x04, 0x00, 0x00, 0x80, 0x03, 0x00, 0x20, 0x20, 
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 
+  0x65, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x18, 0x0b, 
+  0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xdf, 
+  0xa3, 0xe4, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 
+  0x40, 0x0a, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x28, 0x13, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x73, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 0x00, 0xb8, 
+  0x0a, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x40, 0x0b, 0x00, 0x00, 
+  0x45, 0x6c, 0x65, 0x6d, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0x36, 0x43, 0xc3, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x0c, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 
+  0x30, 0x30, 0x34, 0x31, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 
+  0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x08, 0x0c, 0x00, 0x00, 
+  0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x52, 0xa5, 0xc5, 
+  0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x40, 0x0b, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
+  0x10, 0x07, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 0x30, 0x30, 0x34, 0x30, 
+  0xf8, 0xff, 0xff, 0xff, 0xb8, 0x0d, 0x00, 0x00, 0xf8, 0xff, 0xff, 
+  0xff, 0x18, 0x0d, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xc8, 0x0e, 
+  0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x01, 
+  0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+  0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x1b, 0x08, 
+  0xc8, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x40, 
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 
+  0x00, 0x18, 0x07, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0x30, 0x30, 0x31, 
+  0x30, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x01, 0x00, 
+  0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x30, 0x30, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x30, 
+  0xf8, 0xff, 0xff, 0xff, 0x50, 0x0f, 0x00, 0x00, 0xe0, 0xff, 0xff, 
+  0xff, 0x76, 0x6b, 0x07, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xa8, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0x6f, 0x6a, 0xca, 0x43, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x88, 0x0c, 0x00, 0x00, 
+  0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 
+  0x36, 0x30, 0x30, 0x30, 0x30, 0x32, 0x32, 0xe0, 0xff, 0xff, 0xff, 
+  0x76, 0x6b, 0x07, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 
+  0x6b, 0x20, 0x00, 0xde, 0xcc, 0xcc, 0x43, 0x4f, 0x86, 0xdb, 0x01, 
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x90, 0x0c, 0x00, 0x00, 0x48, 
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x36, 
+  0x30, 0x30, 0x30, 0x30, 0x34, 0x39, 0xe0, 0xff, 0xff, 0xff, 0x76, 
+  0x6b, 0x07, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x30, 0x45, 0x6c, 0x65, 
+  0x6d, 0x65, 0x6e, 0x74, 0x30, 0xf8, 0xff, 0xff, 0xff, 0x30, 0x0e, 
+  0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xd8, 0x0f, 0x00, 0x00, 0xf8, 
+  0xff, 0xff, 0xff, 0x30, 0x11, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 
+  0xa8, 0x11, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0xed, 0x2e, 0xcf, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0x98, 0x0c, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x35, 0x30, 0x30, 
+  0x30, 0x30, 0x32, 0x31, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0xe8, 0x0e, 0x00, 0x00, 0x03, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 
+  0xff, 0x6e, 0x6b, 0x20, 0x00, 0x1c, 0x91, 0xd1, 0x43, 0x4f, 0x86, 
+  0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x38, 0x0d, 0x00, 
+  0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x32, 0x35, 0x30, 0x30, 0x30, 0x30, 0x32, 0x30, 0xe0, 0xff, 0xff, 
+  0xff, 0x76, 0x6b, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x70, 0x0f, 
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xf0, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x7c, 0xf3, 
+  0xd3, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x40, 
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 
+  0x00, 0x50, 0x0e, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0x30, 0x30, 0x34, 
+  0x32, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x01, 0x00, 
+  0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 
+  0xf8, 0xff, 0xff, 0xff, 0x20, 0x10, 0x00, 0x00, 0x68, 0x62, 0x69, 
+  0x6e, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 
+  0x76, 0x6b, 0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x30, 0x45, 0x6c, 
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x30, 0xf0, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 
+  0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x01, 0x00, 0x00, 
+  0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x30, 0x30, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x30, 0xf8, 
+  0xff, 0xff, 0xff, 0x50, 0x10, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 
+  0x68, 0x14, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0xd6, 0x55, 0xd6, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0x58, 0x0e, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 
+  0x30, 0x30, 0x34, 0x33, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0x2c, 0xb8, 0xd8, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x0e, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 
+  0x30, 0x30, 0x34, 0x38, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 
+  0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0xb5, 0x1a, 0xdb, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x68, 0x0e, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0x30, 
+  0x30, 0x33, 0x30, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0xc8, 0x11, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x00, 0xf8, 0xfe, 0xff, 0xff, 0x44, 0x00, 0x44, 0x00, 0x49, 
+  0x00, 0x53, 0x00, 0x41, 0x00, 0x42, 0x00, 0x4c, 0x00, 0x45, 0x00, 
+  0x5f, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x54, 0x00, 0x45, 0x00, 0x47, 
+  0x00, 0x52, 0x00, 0x49, 0x00, 0x54, 0x00, 0x59, 0x00, 0x5f, 0x00, 
+  0x43, 0x00, 0x48, 0x00, 0x45, 0x00, 0x43, 0x00, 0x4b, 0x00, 0x53, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x09, 
+  0x7d, 0xdd, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 
+  0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 
+  0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x35, 0x30, 0x30, 0x30, 0x30, 
+  0x38, 0x30, 0x70, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x10, 0x00, 0x50, 
+  0x11, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0x10, 0x14, 0x00, 0x00, 
+  0x31, 0x35, 0x30, 0x30, 0x30, 0x0c, 0x00, 0x00, 0x31, 0x36, 0x30, 
+  0x30, 0xb0, 0x0b, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 0x18, 0x15, 
+  0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 0xd8, 0x10, 0x00, 0x00, 0x31, 
+  0x36, 0x30, 0x30, 0xd8, 0x0d, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 
+  0x98, 0x14, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 0xf8, 0x0e, 0x00, 
+  0x00, 0x32, 0x35, 0x30, 0x30, 0x70, 0x0e, 0x00, 0x00, 0x32, 0x35, 
+  0x30, 0x30, 0xd0, 0x12, 0x00, 0x00, 0x32, 0x35, 0x30, 0x30, 0xc0, 
+  0x0c, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0x60, 0x0d, 0x00, 0x00, 
+  0x32, 0x36, 0x30, 0x30, 0x80, 0x0f, 0x00, 0x00, 0x32, 0x36, 0x30, 
+  0x30, 0x80, 0x10, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0xb8, 0x13, 
+  0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0x29, 0xdf, 0xdf, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x70, 0x10, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0x30, 
+  0x30, 0x38, 0x31, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0x94, 0x41, 0xe2, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x78, 0x10, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x35, 0x30, 0x30, 0x30, 
+  0x30, 0x35, 0x32, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x88, 0x14, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0xdf, 0xa3, 0xe4, 0x43, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x10, 0x15, 0x00, 0x00, 
+  0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 
+  0x36, 0x30, 0x30, 0x30, 0x30, 0x35, 0x34, 0xe0, 0xff, 0xff, 0xff, 
+  0x76, 0x6b, 0x07, 0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xf0, 
+  0x14, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0xdf, 0xa3, 0xe4, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x90, 0x15, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x36, 0x30, 0x30, 0x30, 
+  0x30, 0x34, 0x36, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 
+  0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x70, 0x15, 0x00, 0x00, 0x88, 
+  0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xc2, 0x8f, 0xf0, 0x43, 
+  0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x17, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 
+  0x00, 0x00, 0x7b, 0x61, 0x65, 0x35, 0x35, 0x33, 0x34, 0x65, 0x30, 
+  0x2d, 0x61, 0x39, 0x32, 0x34, 0x2d, 0x34, 0x36, 0x36, 0x63, 0x2d, 
+  0x62, 0x38, 0x33, 0x36, 0x2d, 0x37, 0x35, 0x38, 0x35, 0x33, 0x39, 
+  0x61, 0x33, 0x65, 0x65, 0x33, 0x61, 0x7d, 0x00, 0x00, 0xf8, 0xff, 
+  0xff, 0xff, 0xa0, 0x34, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xa0, 
+  0x35, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x04, 0x00, 
+  0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x20, 0x20, 0x04, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x65, 0x66, 0x54, 0x79, 0x70, 0x65, 0x7b, 0x37, 
+  0x65, 0x61, 0xf8, 0xff, 0xff, 0xff, 0x08, 0x33, 0x00, 0x00, 0xf8, 
+  0xff, 0xff, 0xff, 0xf0, 0x33, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0xc2, 0x8f, 0xf0, 0x43, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x98, 0x15, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00, 
+  0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 
+  0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x04, 
+  0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x00, 
+  0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0xc2, 0x8f, 0xf0, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x98, 0x15, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x28, 0x19, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x73, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 0x00, 
+  0x50, 0x16, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0xd0, 0x16, 0x00, 
+  0x00, 0x45, 0x6c, 0x65, 0x6d, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 
+  0x20, 0x00, 0xcd, 0x68, 0xe9, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 
+  0x00, 0x00, 0x00, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0x00, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x48, 0x03, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x33, 0x31, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x33, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x58, 0x00, 0x00, 0x00, 0xb8, 0x17, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x38, 0xcb, 
+  0xeb, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xd0, 
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 
+  0x00, 0x28, 0x09, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 
+  0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x33, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 
+  0x34, 0xf0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x33, 0x31, 0x30, 0x30, 0xf8, 0xff, 0xff, 0xff, 0x50, 
+  0x19, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 
+  0x1e, 0x00, 0x00, 0x00, 0xa8, 0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x00, 0xd8, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x62, 0x00, 0x6f, 
+  0x00, 0x6f, 0x00, 0x74, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x6f, 0x00, 
+  0x6f, 0x00, 0x74, 0x00, 0x2e, 0x00, 0x73, 0x00, 0x64, 0x00, 0x69, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 
+  0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x9e, 0x2d, 0xee, 0x43, 0x4f, 
+  0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xd0, 0x16, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x80, 0x18, 
+  0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
+  0x00, 0x33, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0xd8, 0xff, 
+  0xff, 0xff, 0x6c, 0x66, 0x04, 0x00, 0x40, 0x17, 0x00, 0x00, 0x33, 
+  0x31, 0x30, 0x30, 0x18, 0x18, 0x00, 0x00, 0x33, 0x32, 0x30, 0x30, 
+  0xd0, 0x18, 0x00, 0x00, 0x33, 0x35, 0x30, 0x30, 0x70, 0x19, 0x00, 
+  0x00, 0x33, 0x36, 0x30, 0x30, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x08, 0x00, 0x00, 0x00, 0x70, 0x18, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0xc2, 0x8f, 0xf0, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0xd0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x33, 0x36, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x36, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 
+  0x00, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x00, 0x88, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0xe0, 0xdd, 0xfe, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x48, 0x1b, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7b, 0x31, 0x39, 0x32, 0x36, 
+  0x30, 0x38, 0x31, 0x37, 0x2d, 0x36, 0x36, 0x36, 0x36, 0x2d, 0x38, 
+  0x38, 0x38, 0x38, 0x2d, 0x61, 0x62, 0x63, 0x64, 0x2d, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x7d, 
+  0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xe0, 
+  0xdd, 0xfe, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 
+  0xe8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 
+  0x00, 0x00, 0x48, 0x09, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 
+  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 
+  0xff, 0xff, 0xff, 0x68, 0x1c, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 
+  0x98, 0x1f, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x04, 
+  0x00, 0x04, 0x00, 0x00, 0x80, 0x03, 0x00, 0x20, 0x10, 0x04, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x00, 
+  0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0xe0, 0xdd, 0xfe, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0xe8, 0x19, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xa8, 0x23, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x73, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 0x00, 
+  0x60, 0x1a, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0xf0, 0x1a, 0x00, 
+  0x00, 0x45, 0x6c, 0x65, 0x6d, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 
+  0x20, 0x00, 0x1f, 0xf2, 0xf2, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 
+  0x00, 0x00, 0x00, 0xf0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x1b, 0x00, 0x00, 0x48, 0x03, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x32, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x34, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0xd8, 0x1b, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0xe8, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x54, 
+  0x00, 0x36, 0x00, 0x2b, 0x00, 0x20, 0x00, 0x57, 0x00, 0x49, 0x00, 
+  0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xb8, 
+  0x1b, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0x66, 0x54, 0xf5, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0xf0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0xc0, 0x1a, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x31, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x31, 0xf8, 0xff, 0xff, 0xff, 0xb8, 0x1f, 0x00, 0x00, 
+  0xf8, 0xff, 0xff, 0xff, 0x70, 0x1f, 0x00, 0x00, 0xf8, 0xff, 0xff, 
+  0xff, 0xd8, 0x1f, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x88, 0x1c, 0x00, 0x00, 0x03, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0x70, 0xfd, 0xff, 0xff, 0xe0, 0x34, 0x55, 
+  0xae, 0x24, 0xa9, 0x6c, 0x46, 0xb8, 0x36, 0x75, 0x85, 0x39, 0xa3, 
+  0xee, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7a, 
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x52, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x1f, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x9a, 0xda, 0x43, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2e, 
+  0x00, 0x77, 0x00, 0x69, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xe3, 0xb6, 0xf7, 
+  0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xf0, 0x1a, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 
+  0xc8, 0x1a, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 
+  0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
+  0x00, 0x00, 0x00, 0x32, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 
+  0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x80, 0x00, 0x00, 
+  0x00, 0xe8, 0x23, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x30, 0x30, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x30, 0xf8, 
+  0xff, 0xff, 0xff, 0x08, 0x26, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 
+  0x76, 0x6b, 0x07, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x20, 0x20, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 
+  0x6b, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0x23, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 
+  0x6d, 0x65, 0x6e, 0x74, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 0xc8, 0x24, 0x00, 0x00, 0x07, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xf0, 0x26, 0x00, 
+  0x00, 0x68, 0x62, 0x69, 0x6e, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x70, 0xfd, 0xff, 0xff, 0xe0, 0x34, 0x55, 0xae, 0x24, 0xa9, 0x6c, 
+  0x46, 0xb8, 0x36, 0x75, 0x85, 0x39, 0xa3, 0xee, 0x3a, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7a, 0x02, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x52, 0x02, 
+  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0xb1, 0x9a, 0xda, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x5c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x77, 0x00, 0x69, 
+  0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0x2b, 0x19, 0xfa, 0x43, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0xf0, 0x1a, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x50, 0x1c, 0x00, 0x00, 
+  0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x40, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 
+  0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0xb8, 0xff, 0xff, 0xff, 
+  0x5c, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x49, 
+  0x00, 0x52, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xdb, 
+  0x7b, 0xfc, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 
+  0xf0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 
+  0x00, 0x00, 0x58, 0x1c, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 
+  0x30, 0x32, 0xc0, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x06, 0x00, 0xf8, 
+  0x1b, 0x00, 0x00, 0x31, 0x31, 0x30, 0x30, 0x50, 0x23, 0x00, 0x00, 
+  0x31, 0x32, 0x30, 0x30, 0x60, 0x1b, 0x00, 0x00, 0x31, 0x32, 0x30, 
+  0x30, 0x70, 0x24, 0x00, 0x00, 0x31, 0x34, 0x30, 0x30, 0x18, 0x1f, 
+  0x00, 0x00, 0x32, 0x31, 0x30, 0x30, 0xb0, 0x22, 0x00, 0x00, 0x32, 
+  0x32, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x78, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 
+  0x00, 0x4c, 0x00, 0x4f, 0x00, 0x41, 0x00, 0x44, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0xe0, 0xdd, 0xfe, 0x43, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0xf0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x1c, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x34, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x36, 0xa8, 0xff, 0xff, 0xff, 0x7b, 0x00, 0x31, 
+  0x00, 0x39, 0x00, 0x32, 0x00, 0x36, 0x00, 0x30, 0x00, 0x38, 0x00, 
+  0x31, 0x00, 0x37, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 
+  0x00, 0x36, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 
+  0x38, 0x00, 0x2d, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 
+  0x00, 0x2d, 0x00, 0x31, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0xfb, 0x2b, 0x0d, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x26, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7b, 0x31, 0x39, 0x32, 
+  0x36, 0x30, 0x38, 0x31, 0x37, 0x2d, 0x36, 0x36, 0x36, 0x36, 0x2d, 
+  0x38, 0x38, 0x38, 0x38, 0x2d, 0x61, 0x62, 0x63, 0x64, 0x2d, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 
+  0x7d, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0xfb, 0x2b, 0x0d, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x20, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x90, 0x1f, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x72, 
+  0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xf8, 0xff, 0xff, 0xff, 0x98, 0x27, 0x00, 0x00, 0xf8, 0xff, 0xff, 
+  0xff, 0xf8, 0x2a, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x80, 0x03, 0x00, 0x20, 0x10, 0x04, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0xfb, 0x2b, 0x0d, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x20, 0x25, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xf0, 0x2e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x73, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 
+  0x00, 0x98, 0x25, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x28, 0x26, 
+  0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0xa8, 0xff, 0xff, 0xff, 0x6e, 
+  0x6b, 0x20, 0x00, 0x98, 0x40, 0x01, 0x44, 0x4f, 0x86, 0xdb, 0x01, 
+  0x02, 0x00, 0x00, 0x00, 0x28, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x48, 
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x32, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 0xe0, 0xff, 0xff, 0xff, 0x76, 
+  0x6b, 0x07, 0x00, 0x12, 0x00, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 
+  0x6d, 0x65, 0x6e, 0x74, 0x00, 0xe8, 0xff, 0xff, 0xff, 0x4e, 0x00, 
+  0x54, 0x00, 0x36, 0x00, 0x2b, 0x00, 0x20, 0x00, 0x56, 0x00, 0x48, 
+  0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0xbd, 0xa2, 0x03, 0x44, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 0x26, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xf8, 0x25, 0x00, 0x00, 
+  0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xbc, 0x02, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 
+  0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0xf8, 0xff, 0xff, 0xff, 
+  0x30, 0x2e, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xd0, 0x2a, 0x00, 
+  0x00, 0xf8, 0xff, 0xff, 0xff, 0x10, 0x30, 0x00, 0x00, 0xe0, 0xff, 
+  0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xb8, 
+  0x27, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x40, 0xfd, 0xff, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xac, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x12, 0x1e, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x8e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x52, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x9a, 0xda, 0x43, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x2e, 0x00, 
+  0x76, 0x00, 0x68, 0x00, 0x64, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 
+  0xff, 0x6e, 0x6b, 0x20, 0x00, 0xe0, 0x04, 0x06, 0x44, 0x4f, 0x86, 
+  0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 0x26, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 
+  0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xbc, 
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x32, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0xe0, 0xff, 0xff, 
+  0xff, 0x76, 0x6b, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0x30, 0x2f, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x30, 0x45, 
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x30, 0xf8, 0xff, 0xff, 0xff, 
+  0x20, 0x16, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 
+  0x00, 0xbc, 0x02, 0x00, 0x00, 0x18, 0x2b, 0x00, 0x00, 0x03, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x00, 0x40, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x02, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0x00, 0x00, 0x22, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x66, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x52, 0x02, 0x00, 0x00, 
+  0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0xb1, 0x9a, 0xda, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x2e, 0x00, 0x76, 0x00, 0x68, 0x00, 0x64, 
+  0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0x18, 0x67, 0x08, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x28, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x80, 0x27, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x32, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x32, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 
+  0x40, 0x00, 0x00, 0x00, 0x50, 0x2e, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x00, 0xb8, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x57, 0x00, 0x49, 
+  0x00, 0x4e, 0x00, 0x44, 0x00, 0x49, 0x00, 0x52, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 
+  0xff, 0x6e, 0x6b, 0x20, 0x00, 0x85, 0xc9, 0x0a, 0x44, 0x4f, 0x86, 
+  0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 0x26, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x88, 0x27, 0x00, 
+  0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x80, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0xc0, 0xff, 0xff, 
+  0xff, 0x6c, 0x66, 0x06, 0x00, 0x28, 0x27, 0x00, 0x00, 0x31, 0x31, 
+  0x30, 0x30, 0x98, 0x2e, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0x98, 
+  0x26, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0xb8, 0x2f, 0x00, 0x00, 
+  0x31, 0x34, 0x30, 0x30, 0x78, 0x2a, 0x00, 0x00, 0x32, 0x31, 0x30, 
+  0x30, 0xd8, 0x2d, 0x00, 0x00, 0x32, 0x32, 0x30, 0x30, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0x5c, 
+  0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x4c, 0x00, 0x4f, 0x00, 
+  0x41, 0x00, 0x44, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 
+  0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xfb, 0x2b, 0x0d, 0x44, 
+  0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 0x26, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x90, 
+  0x27, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 
+  0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+  0x00, 0x00, 0x31, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x36, 0xe0, 
+  0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 
+  0x30, 0x30, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xa8, 0xff, 
+  0xff, 0xff, 0x7b, 0x00, 0x31, 0x00, 0x39, 0x00, 0x32, 0x00, 0x36, 
+  0x00, 0x30, 0x00, 0x38, 0x00, 0x31, 0x00, 0x37, 0x00, 0x2d, 0x00, 
+  0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x2d, 0x00, 0x38, 
+  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2d, 0x00, 0x61, 0x00, 
+  0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x7d, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 
+  0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x2a, 0x92, 0x0f, 0x44, 0x4f, 
+  0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x32, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x16, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 
+  0x00, 0x7b, 0x31, 0x61, 0x66, 0x61, 0x39, 0x63, 0x34, 0x39, 0x2d, 
+  0x31, 0x36, 0x61, 0x62, 0x2d, 0x34, 0x61, 0x35, 0x63, 0x2d, 0x39, 
+  0x30, 0x31, 0x62, 0x2d, 0x32, 0x31, 0x32, 0x38, 0x30, 0x32, 0x64, 
+  0x61, 0x39, 0x34, 0x36, 0x30, 0x7d, 0x00, 0x00, 0xa0, 0xff, 0xff, 
+  0xff, 0x6c, 0x66, 0x0a, 0x00, 0xe8, 0x19, 0x00, 0x00, 0x7b, 0x31, 
+  0x39, 0x32, 0x20, 0x25, 0x00, 0x00, 0x7b, 0x31, 0x39, 0x32, 0x10, 
+  0x39, 0x00, 0x00, 0x7b, 0x31, 0x39, 0x32, 0x30, 0x32, 0x00, 0x00, 
+  0x7b, 0x31, 0x39, 0x32, 0x40, 0x0a, 0x00, 0x00, 0x7b, 0x31, 0x39, 
+  0x32, 0x88, 0x30, 0x00, 0x00, 0x7b, 0x31, 0x61, 0x66, 0xb0, 0x08, 
+  0x00, 0x00, 0x7b, 0x36, 0x65, 0x66, 0x98, 0x06, 0x00, 0x00, 0x7b, 
+  0x37, 0x65, 0x61, 0x70, 0x01, 0x00, 0x00, 0x7b, 0x39, 0x64, 0x65, 
+  0x98, 0x15, 0x00, 0x00, 0x7b, 0x61, 0x65, 0x35, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 
+  0x20, 0x00, 0x2a, 0x92, 0x0f, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 
+  0x00, 0x00, 0x00, 0x88, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0x00, 0x00, 0x00, 0xf0, 0x2a, 0x00, 0x00, 0x48, 0x03, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 0x65, 0x73, 
+  0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x2a, 
+  0x92, 0x0f, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 
+  0x88, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+  0x74, 0x73, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 0x00, 0x60, 
+  0x31, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0xc0, 0x31, 0x00, 0x00, 
+  0x45, 0x6c, 0x65, 0x6d, 0x88, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0x26, 0xa1, 0x22, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x80, 0x33, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7b, 0x31, 0x39, 0x32, 
+  0x36, 0x30, 0x38, 0x31, 0x37, 0x2d, 0x36, 0x36, 0x36, 0x36, 0x2d, 
+  0x38, 0x38, 0x38, 0x38, 0x2d, 0x61, 0x62, 0x63, 0x64, 0x2d, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 
+  0x7d, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0x26, 0xa1, 0x22, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x30, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x40, 0x16, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x72, 
+  0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x04, 0x00, 0x04, 0x00, 0x00, 
+  0x80, 0x04, 0x00, 0x20, 0x10, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0xa8, 
+  0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x26, 0xa1, 0x22, 0x44, 
+  0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x30, 0x32, 0x00, 
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x37, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+  0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0xe8, 
+  0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 0x00, 0xa8, 0x32, 0x00, 0x00, 
+  0x44, 0x65, 0x73, 0x63, 0x28, 0x33, 0x00, 0x00, 0x45, 0x6c, 0x65, 
+  0x6d, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xa3, 0xf0, 
+  0x11, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 
+  0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 
+  0x00, 0x48, 0x16, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 
+  0x34, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x18, 0x00, 
+  0x00, 0x00, 0x10, 0x34, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 
+  0xe0, 0xff, 0xff, 0xff, 0x4e, 0x00, 0x54, 0x00, 0x36, 0x00, 0x2b, 
+  0x00, 0x20, 0x00, 0x52, 0x00, 0x65, 0x00, 0x73, 0x00, 0x75, 0x00, 
+  0x6d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 
+  0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x07, 0x53, 0x14, 0x44, 
+  0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 0x33, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x10, 
+  0x16, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 
+  0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+  0x00, 0x00, 0x31, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0xf8, 
+  0xff, 0xff, 0xff, 0xa0, 0x36, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 
+  0x78, 0x35, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0x98, 0x38, 0x00, 
+  0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x58, 0x00, 
+  0x00, 0x00, 0xc0, 0x34, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 
+  0xa0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x01, 0x00, 0x00, 0x00, 0xb1, 0x9a, 0xda, 0x43, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 
+  0xff, 0x6e, 0x6b, 0x20, 0x00, 0x9e, 0x7a, 0x1b, 0x44, 0x4f, 0x86, 
+  0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 0x33, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x18, 0x16, 0x00, 
+  0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x80, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0xe0, 0xff, 0xff, 
+  0xff, 0x76, 0x6b, 0x07, 0x00, 0x80, 0x00, 0x00, 0x00, 0xb8, 0x37, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x30, 0x45, 
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x30, 0xf8, 0xff, 0xff, 0xff, 
+  0xf8, 0x39, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 
+  0x00, 0x80, 0x00, 0x00, 0x00, 0xc0, 0x35, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+  0x6e, 0x74, 0x00, 0x78, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x57, 0x00, 
+  0x49, 0x00, 0x4e, 0x00, 0x52, 0x00, 0x45, 0x00, 0x53, 0x00, 0x55, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 
+  0x6e, 0x6b, 0x20, 0x00, 0x6b, 0xdc, 0x1d, 0x44, 0x4f, 0x86, 0xdb, 
+  0x01, 0x02, 0x00, 0x00, 0x00, 0x28, 0x33, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x88, 0x34, 0x00, 0x00, 
+  0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x58, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 
+  0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0xe0, 0xff, 0xff, 0xff, 
+  0x76, 0x6b, 0x07, 0x00, 0x58, 0x00, 0x00, 0x00, 0xc0, 0x36, 0x00, 
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 
+  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0xb1, 0x9a, 0xda, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0xcd, 0x3e, 0x20, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x28, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x90, 0x34, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x0e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x32, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x32, 0xc0, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x06, 0x00, 
+  0x30, 0x34, 0x00, 0x00, 0x31, 0x31, 0x30, 0x30, 0x20, 0x35, 0x00, 
+  0x00, 0x31, 0x32, 0x30, 0x30, 0x98, 0x33, 0x00, 0x00, 0x31, 0x32, 
+  0x30, 0x30, 0x40, 0x38, 0x00, 0x00, 0x31, 0x34, 0x30, 0x30, 0x48, 
+  0x36, 0x00, 0x00, 0x32, 0x31, 0x30, 0x30, 0x20, 0x37, 0x00, 0x00, 
+  0x32, 0x32, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x78, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x57, 0x00, 0x49, 0x00, 
+  0x4e, 0x00, 0x48, 0x00, 0x49, 0x00, 0x42, 0x00, 0x52, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 
+  0x20, 0x00, 0x26, 0xa1, 0x22, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 
+  0x00, 0x00, 0x00, 0x28, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0x00, 0x00, 0x00, 0x98, 0x34, 0x00, 0x00, 0x48, 0x03, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x34, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x36, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 0xb8, 0x38, 0x00, 0x00, 0x07, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x7b, 0x00, 0x31, 
+  0x00, 0x61, 0x00, 0x66, 0x00, 0x61, 0x00, 0x39, 0x00, 0x63, 0x00, 
+  0x34, 0x00, 0x39, 0x00, 0x2d, 0x00, 0x31, 0x00, 0x36, 0x00, 0x61, 
+  0x00, 0x62, 0x00, 0x2d, 0x00, 0x34, 0x00, 0x61, 0x00, 0x35, 0x00, 
+  0x63, 0x00, 0x2d, 0x00, 0x39, 0x00, 0x30, 0x00, 0x31, 0x00, 0x62, 
+  0x00, 0x2d, 0x00, 0x32, 0x00, 0x31, 0x00, 0x32, 0x00, 0x38, 0x00, 
+  0x30, 0x00, 0x32, 0x00, 0x64, 0x00, 0x61, 0x00, 0x39, 0x00, 0x34, 
+  0x00, 0x36, 0x00, 0x30, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0x1c, 0xef, 0x30, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x70, 0x3a, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x7b, 0x31, 0x39, 0x32, 
+  0x36, 0x30, 0x38, 0x31, 0x37, 0x2d, 0x36, 0x36, 0x36, 0x36, 0x2d, 
+  0x38, 0x38, 0x38, 0x38, 0x2d, 0x61, 0x62, 0x63, 0x64, 0x2d, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 
+  0x7d, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 
+  0x1c, 0xef, 0x30, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 
+  0x00, 0x10, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 
+  0x00, 0x00, 0x00, 0x98, 0x35, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x72, 
+  0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xf8, 0xff, 0xff, 0xff, 0x90, 0x3b, 0x00, 0x00, 0xf8, 0xff, 0xff, 
+  0xff, 0x90, 0x3c, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x04, 0x00, 0x04, 0x00, 0x00, 0x80, 0x03, 0x00, 0x20, 0x10, 0x04, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0x1c, 0xef, 0x30, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x10, 0x39, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x28, 0x3e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x73, 0xe8, 0xff, 0xff, 0xff, 0x6c, 0x66, 0x02, 
+  0x00, 0x88, 0x39, 0x00, 0x00, 0x44, 0x65, 0x73, 0x63, 0x18, 0x3a, 
+  0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0xa8, 0xff, 0xff, 0xff, 0x6e, 
+  0x6b, 0x20, 0x00, 0xcd, 0x03, 0x25, 0x44, 0x4f, 0x86, 0xdb, 0x01, 
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x18, 0x3b, 0x00, 0x00, 0x48, 
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x32, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x34, 0xe0, 0xff, 0xff, 0xff, 0x76, 
+  0x6b, 0x07, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 
+  0x6d, 0x65, 0x6e, 0x74, 0x00, 0xe8, 0xff, 0xff, 0xff, 0x4e, 0x00, 
+  0x54, 0x00, 0x36, 0x00, 0x2b, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x53, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 
+  0xe0, 0x3a, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 
+  0x00, 0x9d, 0x65, 0x27, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 
+  0x00, 0x00, 0x18, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x00, 0x00, 0x00, 0xe8, 0x39, 0x00, 0x00, 0x48, 0x03, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x31, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x31, 0xf8, 0xff, 0xff, 0xff, 0x68, 0x3d, 0x00, 
+  0x00, 0xf8, 0xff, 0xff, 0xff, 0x68, 0x3c, 0x00, 0x00, 0xf8, 0xff, 
+  0xff, 0xff, 0x48, 0x3f, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x76, 
+  0x6b, 0x07, 0x00, 0x58, 0x00, 0x00, 0x00, 0xb0, 0x3b, 0x00, 0x00, 
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 
+  0x6d, 0x65, 0x6e, 0x74, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xb1, 
+  0x9a, 0xda, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x9d, 
+  0x65, 0x27, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 
+  0x18, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 
+  0x00, 0x00, 0xf0, 0x39, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x0e, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x31, 0x30, 0x30, 0x30, 0x30, 
+  0x30, 0x31, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x80, 
+  0x00, 0x00, 0x00, 0x68, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x01, 0x00, 0x30, 0x30, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+  0x30, 0xf8, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0x00, 0x00, 0xe0, 0xff, 
+  0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x58, 0x00, 0x00, 0x00, 0xb0, 
+  0x3c, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+  0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xa0, 0xff, 0xff, 
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x50, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0xb1, 0x9a, 0xda, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 
+  0x20, 0x00, 0x78, 0xc8, 0x29, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 
+  0x00, 0x00, 0x00, 0x18, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0x01, 0x00, 0x00, 0x00, 0x78, 0x3b, 0x00, 0x00, 0x48, 0x03, 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x32, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x32, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 
+  0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x88, 0x3d, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 
+  0x65, 0x6e, 0x74, 0x00, 0xb8, 0xff, 0xff, 0xff, 0x5c, 0x00, 0x57, 
+  0x00, 0x49, 0x00, 0x4e, 0x00, 0x44, 0x00, 0x49, 0x00, 0x52, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 
+  0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0x98, 0x2a, 0x2c, 0x44, 
+  0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x18, 0x3a, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x80, 
+  0x3b, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 
+  0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 
+  0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x32, 0xc0, 
+  0xff, 0xff, 0xff, 0x6c, 0x66, 0x07, 0x00, 0x20, 0x3b, 0x00, 0x00, 
+  0x31, 0x31, 0x30, 0x30, 0xd0, 0x3d, 0x00, 0x00, 0x31, 0x32, 0x30, 
+  0x30, 0x88, 0x3a, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0xf0, 0x3e, 
+  0x00, 0x00, 0x31, 0x34, 0x30, 0x30, 0x10, 0x3c, 0x00, 0x00, 0x32, 
+  0x31, 0x30, 0x30, 0x10, 0x3d, 0x00, 0x00, 0x32, 0x32, 0x30, 0x30, 
+  0x20, 0x40, 0x00, 0x00, 0x32, 0x33, 0x30, 0x30, 0x78, 0xff, 0xff, 
+  0xff, 0x5c, 0x00, 0x57, 0x00, 0x49, 0x00, 0x4e, 0x00, 0x4c, 0x00, 
+  0x4f, 0x00, 0x41, 0x00, 0x44, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 0x6b, 0x20, 0x00, 0xf6, 0x8c, 
+  0x2e, 0x44, 0x4f, 0x86, 0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x18, 
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 
+  0x00, 0x88, 0x3b, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 
+  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 
+  0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x08, 0x00, 0x00, 0x00, 0x31, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 
+  0x36, 0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x50, 0x00, 
+  0x00, 0x00, 0x68, 0x3f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 
+  0x00, 0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 
+  0xa8, 0xff, 0xff, 0xff, 0x7b, 0x00, 0x31, 0x00, 0x39, 0x00, 0x32, 
+  0x00, 0x36, 0x00, 0x30, 0x00, 0x38, 0x00, 0x31, 0x00, 0x37, 0x00, 
+  0x2d, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x2d, 
+  0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2d, 0x00, 
+  0x61, 0x00, 0x62, 0x00, 0x63, 0x00, 0x64, 0x00, 0x2d, 0x00, 0x31, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xe0, 0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x4e, 0x00, 0x00, 
+  0x00, 0x78, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
+  0x00, 0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0xe0, 
+  0xff, 0xff, 0xff, 0x76, 0x6b, 0x07, 0x00, 0x50, 0x00, 0x00, 0x00, 
+  0x68, 0x41, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+  0x00, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x00, 0x68, 0x62, 
+  0x69, 0x6e, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 
+  0xff, 0x6e, 0x6b, 0x20, 0x00, 0x1c, 0xef, 0x30, 0x44, 0x4f, 0x86, 
+  0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0x18, 0x3a, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x88, 0x3c, 0x00, 
+  0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4e, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x32, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0xa8, 0xff, 0xff, 
+  0xff, 0x7b, 0x00, 0x31, 0x00, 0x39, 0x00, 0x32, 0x00, 0x36, 0x00, 
+  0x30, 0x00, 0x38, 0x00, 0x31, 0x00, 0x37, 0x00, 0x2d, 0x00, 0x36, 
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x36, 0x00, 0x2d, 0x00, 0x38, 0x00, 
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x2d, 0x00, 0x61, 0x00, 0x62, 
+  0x00, 0x63, 0x00, 0x64, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x33, 0x00, 0x7d, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 
+  0xff, 0x6e, 0x6b, 0x20, 0x00, 0x66, 0x51, 0x33, 0x44, 0x4f, 0x86, 
+  0xdb, 0x01, 0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xd0, 0x05, 0x00, 
+  0x00, 0x48, 0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x50, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 
+  0x32, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x31, 0xc0, 0xff, 0xff, 
+  0xff, 0x6c, 0x66, 0x06, 0x00, 0x48, 0x04, 0x00, 0x00, 0x31, 0x32, 
+  0x30, 0x30, 0xe0, 0x04, 0x00, 0x00, 0x31, 0x32, 0x30, 0x30, 0xc0, 
+  0x41, 0x00, 0x00, 0x32, 0x33, 0x30, 0x30, 0xd0, 0x40, 0x00, 0x00, 
+  0x32, 0x34, 0x30, 0x30, 0x78, 0x05, 0x00, 0x00, 0x32, 0x35, 0x30, 
+  0x30, 0x18, 0x06, 0x00, 0x00, 0x32, 0x36, 0x30, 0x30, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x7b, 
+  0x00, 0x31, 0x00, 0x39, 0x00, 0x32, 0x00, 0x36, 0x00, 0x30, 0x00, 
+  0x38, 0x00, 0x31, 0x00, 0x37, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x36, 
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x38, 0x00, 
+  0x38, 0x00, 0x38, 0x00, 0x2d, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 
+  0x00, 0x64, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x7d, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0xff, 0x6e, 
+  0x6b, 0x20, 0x00, 0xc0, 0xb3, 0x35, 0x44, 0x4f, 0x86, 0xdb, 0x01, 
+  0x02, 0x00, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x48, 
+  0x03, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x33, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0xa8, 0xff, 0xff, 0xff, 0x7b, 
+  0x00, 0x31, 0x00, 0x39, 0x00, 0x32, 0x00, 0x36, 0x00, 0x30, 0x00, 
+  0x38, 0x00, 0x31, 0x00, 0x37, 0x00, 0x2d, 0x00, 0x36, 0x00, 0x36, 
+  0x00, 0x36, 0x00, 0x36, 0x00, 0x2d, 0x00, 0x38, 0x00, 0x38, 0x00, 
+  0x38, 0x00, 0x38, 0x00, 0x2d, 0x00, 0x61, 0x00, 0x62, 0x00, 0x63, 
+  0x00, 0x64, 0x00, 0x2d, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x7d, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xd8, 
+  0x05, 0x00, 0x00, 0x88, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00
+};
+
+unsigned int bcd_raw_len = 24576;
@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #define MAX_PATH 255
+#define MAX_DISKFILES 4
 
 #define NTBOOT_WIM 0x00
 #define NTBOOT_VHD 0x01
@@ -72,6 +73,9 @@ struct nt_args
     char filepath[MAX_PATH + 1];
 
     char initrd_path[MAX_PATH + 1];
+    char diskfiles[MAX_DISKFILES][MAX_PATH + 1];
+    uint32_t num_diskfiles;
+    uint8_t trace;
     void *bcd;
     uint32_t bcd_length;
     void *bootmgr;
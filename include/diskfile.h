@@ -0,0 +1,88 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DISKFILE_H
+#define _DISKFILE_H
+
+/**
+ * @file
+ *
+ * Files on the physical partition
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "fsuuid.h"
+
+/** Sector size used for all partition accesses */
+#define DISKFILE_SECTOR_SIZE 512
+
+/** Partition sector marking a sparse (all-zero) extent */
+#define DISKFILE_HOLE (~0ULL)
+
+/** A contiguous run of file sectors on the partition */
+struct diskfile_extent
+{
+    /** Starting sector within file */
+    uint64_t start;
+    /** Starting sector within partition (or DISKFILE_HOLE) */
+    uint64_t lba;
+    /** Number of sectors */
+    uint64_t count;
+};
+
+/** A file on the physical partition */
+struct diskfile
+{
+    /** Length */
+    uint64_t len;
+    /** Initialised length (data beyond this reads as zero) */
+    uint64_t valid;
+    /** Resident data (or NULL if held in extents) */
+    void *data;
+    /** Number of extents */
+    unsigned int count;
+    /** Number of allocated extents */
+    unsigned int max;
+    /** Extents (sorted by starting sector) */
+    struct diskfile_extent *extents;
+};
+
+extern void diskfile_set_partition (void *disk, uint64_t lba,
+                                    int (*disk_read) (void *disk,
+                                                      uint64_t sector,
+                                                      size_t len, void *buf));
+extern int diskfile_read_sectors (uint64_t sector, unsigned int count,
+                                  void *data);
+extern int diskfile_add_extent (struct diskfile *file, uint64_t lba,
+                                uint64_t count);
+extern void diskfile_free_extents (struct diskfile *file);
+extern int diskfile_match (const char *name, size_t len,
+                           const uint16_t *wname, size_t wlen);
+extern const char *diskfile_next_name (const char **path, size_t *len);
+extern int diskfile_pread (struct diskfile *file, void *data,
+                           uint64_t offset, size_t len);
+extern struct diskfile *diskfile_open (const char *path);
+
+extern int fat_open (struct diskfile *file, const char *path,
+                     const union volume_boot_record *vbr);
+extern int ntfs_open (struct diskfile *file, const char *path,
+                      const union volume_boot_record *vbr);
+
+#endif /* _DISKFILE_H */
@@ -0,0 +1,96 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LZFILE_H
+#define _LZFILE_H
+
+/**
+ * @file
+ *
+ * Block-compressed files
+ *
+ * A block-compressed file is split into fixed-size chunks, each of
+ * which is compressed independently as an LZNT1 stream.  A table of
+ * chunk offsets follows the header, so that any part of the file can
+ * be decompressed without touching the rest of it.
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** Block-compressed file magic */
+#define LZFILE_MAGIC "NTLZNT1\x1a"
+
+/** Default chunk size (log2 of bytes) */
+#define LZFILE_CHUNK_SHIFT 16
+
+/** Maximum chunk size (log2 of bytes) */
+#define LZFILE_MAX_CHUNK_SHIFT 24
+
+/** LZNT1 block size (log2 of bytes)
+ *
+ * Every LZNT1 block within a chunk, except possibly the last,
+ * decompresses to exactly this many bytes.
+ */
+#define LZFILE_BLOCK_SHIFT 12
+
+/** LZNT1 block size */
+#define LZFILE_BLOCK_SIZE (1 << LZFILE_BLOCK_SHIFT)
+
+/** LZNT1 compressed block header signature */
+#define LZFILE_BLOCK_COMPRESSED 0xb000
+
+/** LZNT1 uncompressed block header signature */
+#define LZFILE_BLOCK_UNCOMPRESSED 0x3000
+
+/** Block-compressed file header
+ *
+ * The header is followed by (chunks + 1) little-endian 32-bit chunk
+ * offsets, relative to the start of the header.  Chunk i occupies
+ * [offset[i], offset[i+1]).
+ */
+struct lzfile_header
+{
+    /** Magic */
+    char magic[8];
+    /** Chunk size (log2 of bytes) */
+    uint32_t chunk_shift;
+    /** Number of chunks */
+    uint32_t chunks;
+    /** Uncompressed length */
+    uint64_t len;
+} __attribute__ ((packed));
+
+/**
+ * Get chunk offset table
+ *
+ * @v header		Block-compressed file header
+ * @ret offsets		Chunk offset table
+ */
+static inline const uint32_t *
+lzfile_offsets (const struct lzfile_header *header)
+{
+    return ((const uint32_t *) (header + 1));
+}
+
+extern int lzfile_check (const void *data, size_t len, size_t *file_len);
+extern int lzfile_pread (const void *data, void *buf,
+                         size_t offset, size_t len);
+
+#endif /* _LZFILE_H */
@@ -52,7 +52,7 @@
 #ifndef ASSEMBLY
 
 #include <stdint.h>
-#include <bootapp.h>
+#include "bootapp.h"
 
 /** Construct wide-character version of a string constant */
 #define L(x) _L (x)
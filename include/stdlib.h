@@ -27,6 +27,12 @@
  *
  */
 
+#include <stdint.h>
+
 extern unsigned long strtoul (const char *nptr, char **endptr, int base);
 
+extern void *malloc (size_t len);
+extern void free (void *ptr);
+extern void *realloc (void *ptr, size_t len);
+
 #endif /* _STDLIB_H */
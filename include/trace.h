@@ -0,0 +1,114 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TRACE_H
+#define _TRACE_H
+
+/**
+ * @file
+ *
+ * Virtual disk read tracing
+ *
+ * Tracing is compiled in only when VDISK_TRACE is defined (as the
+ * number of records to buffer), e.g. by building with "make TRACE=128".
+ * Otherwise every hook below compiles away to nothing.
+ *
+ */
+
+#include <stdint.h>
+
+/** Trace line prefix */
+#define TRACE_PREFIX "VTRACE"
+
+/** Trace record kinds */
+enum trace_kind
+{
+    /** Unused space */
+    TRACE_EMPTY = 'E',
+    /** Metadata region */
+    TRACE_REGION = 'R',
+    /** Virtual file */
+    TRACE_FILE = 'F',
+};
+
+/** Trace output sinks */
+enum trace_sink
+{
+    /** Debug port 0xe9 (or console, where there is no such port) */
+    TRACE_SINK_PORT = 0,
+    /** Console */
+    TRACE_SINK_CONSOLE,
+    /** File on the boot partition (UEFI only) */
+    TRACE_SINK_FILE,
+};
+
+/** Trace file name on the boot partition */
+#define TRACE_FILE_NAME L"\\ntloader.trc"
+
+#ifdef VDISK_TRACE
+
+/**
+ * Read timestamp counter
+ *
+ * @ret timestamp	Timestamp
+ */
+static inline uint64_t trace_timestamp (void)
+{
+    uint64_t timestamp;
+#if defined(__i386__) || defined(__x86_64__)
+    uint32_t lo;
+    uint32_t hi;
+
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    timestamp = ((((uint64_t) hi) << 32) | lo);
+#elif defined(__aarch64__)
+    __asm__ __volatile__ ("mrs %0, CNTVCT_EL0" : "=r" (timestamp));
+#else
+    timestamp = 0;
+#endif
+    return timestamp;
+}
+
+extern void trace_record (enum trace_kind kind, const char *name,
+                          uint64_t lba, unsigned int count,
+                          uint64_t offset, uint64_t start);
+extern void trace_flush (void);
+
+#else /* VDISK_TRACE */
+
+static inline uint64_t trace_timestamp (void)
+{
+    return 0;
+}
+
+static inline void trace_record (enum trace_kind kind __attribute__ ((unused)),
+                                 const char *name __attribute__ ((unused)),
+                                 uint64_t lba __attribute__ ((unused)),
+                                 unsigned int count __attribute__ ((unused)),
+                                 uint64_t offset __attribute__ ((unused)),
+                                 uint64_t start __attribute__ ((unused)))
+{
+}
+
+static inline void trace_flush (void)
+{
+}
+
+#endif /* VDISK_TRACE */
+
+#endif /* _TRACE_H */
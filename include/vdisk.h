@@ -53,31 +53,23 @@
 /** Number of clusters */
 #define VDISK_CLUSTERS 0x03ffc000ULL /* Fill 2TB disk */
 
-/** Maximum number of virtual files
- *
- * The total number of files must be strictly less than the number of
- * sectors per cluster.
- */
-#define VDISK_MAX_FILES (VDISK_CLUSTER_COUNT - 1)
-
 /** Maximum file size (in sectors) */
 #define VDISK_FILE_COUNT 0x800000UL /* max for 32-bit address space */
 
-/** Maximum file size (in clusters) */
-#define VDISK_FILE_CLUSTERS (VDISK_FILE_COUNT / VDISK_CLUSTER_COUNT)
-
-/** File starting LBA */
-#define VDISK_FILE_LBA(idx) (((idx) + 1) * VDISK_FILE_COUNT)
-
-/** File index from LBA */
-#define VDISK_FILE_IDX(lba) (((lba) / VDISK_FILE_COUNT) - 1)
+/** Minimum file slot size (log2 of sectors, i.e. one cluster) */
+#define VDISK_MIN_FILE_SHIFT 6
 
-/** File offset (in bytes) from LBA */
-#define VDISK_FILE_OFFSET(lba)					\
-	(((lba) % VDISK_FILE_COUNT) * VDISK_SECTOR_SIZE)
+/** Maximum file slot size (log2 of sectors, i.e. VDISK_FILE_COUNT) */
+#define VDISK_MAX_FILE_SHIFT 23
 
-/** File index from directory entry LBA */
-#define VDISK_FILE_DIRENT_IDX(lba) (((lba) - 1) % VDISK_CLUSTER_COUNT)
+/** First file starting LBA
+ *
+ * Files occupy consecutive, equally-sized, power-of-two slots from
+ * here onwards, so that the file containing any LBA can be found
+ * with a single shift.  The slot size is chosen to fit the largest
+ * file.
+ */
+#define VDISK_FILE_LBA VDISK_FILE_COUNT
 
 /** Number of sectors allocated for FAT */
 #define VDISK_SECTORS_PER_FAT \
@@ -87,12 +79,11 @@
 /** Number of reserved sectors */
 #define VDISK_RESERVED_COUNT VDISK_CLUSTER_COUNT
 
-/** Starting cluster number for file */
-#define VDISK_FILE_CLUSTER(idx) \
-    ((((VDISK_FILE_COUNT - VDISK_PARTITION_LBA - \
-        VDISK_RESERVED_COUNT - VDISK_SECTORS_PER_FAT) \
-      / VDISK_CLUSTER_COUNT) + 2) + \
-      ((idx) * VDISK_FILE_CLUSTERS))
+/** First file starting cluster */
+#define VDISK_FILE_CLUSTER \
+    (((VDISK_FILE_LBA - VDISK_PARTITION_LBA - \
+       VDISK_RESERVED_COUNT - VDISK_SECTORS_PER_FAT) \
+      / VDISK_CLUSTER_COUNT) + 2)
 
 /** Total number of sectors within partition */
 #define VDISK_PARTITION_COUNT \
@@ -468,7 +459,7 @@ struct vdisk_directory
 
 /*****************************************************************************
  *
- * Root directory
+ * Directories
  *
  *****************************************************************************
  */
@@ -482,101 +473,23 @@ struct vdisk_directory
 /** Root directory LBA */
 #define VDISK_ROOT_LBA (VDISK_VBR_LBA + VDISK_ROOT_SECTOR)
 
-/*****************************************************************************
- *
- * Boot directory
+/** Virtual directories
  *
- *****************************************************************************
+ * Every directory occupies the same number of consecutive clusters
+ * (enough for one sector of subdirectories followed by one sector
+ * per file), in this order starting from the root directory.
  */
-
-/** Boot directory cluster */
-#define VDISK_BOOT_CLUSTER 3
-
-/** Boot directory sector */
-#define VDISK_BOOT_SECTOR VDISK_CLUSTER_SECTOR (VDISK_BOOT_CLUSTER)
-
-/** Boot directory LBA */
-#define VDISK_BOOT_LBA (VDISK_VBR_LBA + VDISK_BOOT_SECTOR)
-
-/*****************************************************************************
- *
- * Sources directory
- *
- *****************************************************************************
- */
-
-/** Sources directory cluster */
-#define VDISK_SOURCES_CLUSTER 4
-
-/** Sources directory sector */
-#define VDISK_SOURCES_SECTOR VDISK_CLUSTER_SECTOR (VDISK_SOURCES_CLUSTER)
-
-/** Sources directory LBA */
-#define VDISK_SOURCES_LBA (VDISK_VBR_LBA + VDISK_SOURCES_SECTOR)
-
-/*****************************************************************************
- *
- * Fonts directory
- *
- *****************************************************************************
- */
-
-/** Fonts directory cluster */
-#define VDISK_FONTS_CLUSTER 5
-
-/** Fonts directory sector */
-#define VDISK_FONTS_SECTOR VDISK_CLUSTER_SECTOR (VDISK_FONTS_CLUSTER)
-
-/** Fonts directory LBA */
-#define VDISK_FONTS_LBA (VDISK_VBR_LBA + VDISK_FONTS_SECTOR)
-
-/*****************************************************************************
- *
- * Resources directory
- *
- *****************************************************************************
- */
-
-/** Resources directory cluster */
-#define VDISK_RESOURCES_CLUSTER 6
-
-/** Resources directory sector */
-#define VDISK_RESOURCES_SECTOR VDISK_CLUSTER_SECTOR (VDISK_RESOURCES_CLUSTER)
-
-/** Resources directory LBA */
-#define VDISK_RESOURCES_LBA (VDISK_VBR_LBA + VDISK_RESOURCES_SECTOR)
-
-/*****************************************************************************
- *
- * EFI directory
- *
- *****************************************************************************
- */
-
-/** EFI directory cluster */
-#define VDISK_EFI_CLUSTER 7
-
-/** EFI directory sector */
-#define VDISK_EFI_SECTOR VDISK_CLUSTER_SECTOR (VDISK_EFI_CLUSTER)
-
-/** EFI directory LBA */
-#define VDISK_EFI_LBA (VDISK_VBR_LBA + VDISK_EFI_SECTOR)
-
-/*****************************************************************************
- *
- * Microsoft directory
- *
- *****************************************************************************
- */
-
-/** Microsoft directory cluster */
-#define VDISK_MICROSOFT_CLUSTER 8
-
-/** Microsoft directory sector */
-#define VDISK_MICROSOFT_SECTOR VDISK_CLUSTER_SECTOR (VDISK_MICROSOFT_CLUSTER)
-
-/** Microsoft directory LBA */
-#define VDISK_MICROSOFT_LBA (VDISK_VBR_LBA + VDISK_MICROSOFT_SECTOR)
+enum vdisk_directory_index
+{
+    VDISK_ROOT_DIR = 0,
+    VDISK_BOOT_DIR,
+    VDISK_SOURCES_DIR,
+    VDISK_FONTS_DIR,
+    VDISK_RESOURCES_DIR,
+    VDISK_EFI_DIR,
+    VDISK_MICROSOFT_DIR,
+    VDISK_NUM_DIRS
+};
 
 /*****************************************************************************
  *
@@ -588,6 +501,18 @@ struct vdisk_directory
 /** Maximum virtual filename length (excluding NUL) */
 #define VDISK_NAME_LEN 31
 
+/** Maximum number of patched ranges recorded per virtual file */
+#define VDISK_MAX_PATCH_RANGES 4
+
+/** A patched byte range within a virtual file */
+struct vdisk_patch_range
+{
+    /** Starting offset */
+    size_t start;
+    /** Ending offset (exclusive) */
+    size_t end;
+};
+
 /** A virtual file */
 struct vdisk_file
 {
@@ -617,11 +542,16 @@ struct vdisk_file
      */
     void (* patch) (struct vdisk_file *file, void *data, size_t offset,
                        size_t len);
+    /** Patched ranges, sorted and non-overlapping */
+    struct vdisk_patch_range patch_ranges[VDISK_MAX_PATCH_RANGES];
+    /** Number of patched ranges (0 to patch every read) */
+    unsigned int patch_count;
 };
 
-extern struct vdisk_file vdisk_files[VDISK_MAX_FILES];
-
 extern void vdisk_read (uint64_t lba, unsigned int count, void *data);
+extern void vdisk_finalise (void);
+extern struct vdisk_file *vdisk_get_file (unsigned int idx);
+extern uint64_t vdisk_used_count (void);
 
 extern struct vdisk_file *
 vdisk_add_file (const char *name, void *opaque, size_t len,
@@ -631,5 +561,7 @@ extern void
 vdisk_patch_file (struct vdisk_file *file,
                    void (* patch) (struct vdisk_file *file, void *data,
                                       size_t offset, size_t len));
+extern void vdisk_patch_range (struct vdisk_file *file, size_t offset,
+                               size_t len);
 
 #endif /* _VDISK_H */
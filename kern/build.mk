@@ -9,6 +9,7 @@ OBJECTS += kern/efifile.o
 OBJECTS += kern/efimain.o
 OBJECTS += kern/efiterm.o
 OBJECTS += kern/payload.o
+OBJECTS += kern/trace.o
 
 OBJECTS += kern/callback.o
 OBJECTS += kern/e820.o
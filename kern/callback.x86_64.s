@@ -0,0 +1,192 @@
+# 0 "kern/callback.S"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "include/compiler.h" 1
+# 0 "<command-line>" 2
+# 1 "kern/callback.S"
+# 27 "kern/callback.S"
+# 1 "include/ntloader.h" 1
+# 28 "kern/callback.S" 2
+# 50 "kern/callback.S"
+ .section ".note.GNU-stack", "", @progbits
+
+
+
+ .code32
+ .arch i386
+
+
+ .section ".text", "ax", @progbits
+ .globl call_real
+call_real:
+
+ pushl %ebp
+ pushl %ebx
+ pushl %esi
+ pushl %edi
+
+
+
+
+
+ movl 20(%esp), %esi
+ movl %esp, %ebp
+ movl $_ermstack, %esp
+ pushl %ebp
+ subl $0x40, %esp
+ movl %esp, %edi
+ movl $( 0x40 / 4 ), %ecx
+ cld
+ rep movsl
+ movl %esp, %ebp
+ subl $0x40, %esi
+ pushl %esi
+
+
+ ljmp $0x50, $( 1f - (0x2000 << 4) )
+1: .code16
+ movw $0x60, %ax
+ movw %ax, %ds
+ movw %ax, %es
+ movw %ax, %fs
+ movw %ax, %gs
+ movw %ax, %ss
+ subl $(0x2000 << 4), %esp
+ subl $(0x2000 << 4), %ebp
+
+
+ movl %cr0, %eax
+ pushl %eax
+ andl $~( 0x80000000 | 0x00000001 ), %eax
+ movl %eax, %cr0
+ data32 ljmp $0x2000, $( 1f - (0x2000 << 4) )
+1: movw $0x2000, %ax
+ movw %ax, %ds
+ movw %ax, %es
+ movw %ax, %fs
+ movw %ax, %gs
+ movw %ax, %ss
+ addr32 data32 lidt %cs:( rm_idtr - (0x2000 << 4) )
+
+
+ movl 0x04(%bp), %eax
+ movl 0x08(%bp), %ebx
+ movl 0x0c(%bp), %ecx
+ movl 0x10(%bp), %edx
+ movl 0x1c(%bp), %esi
+ movl 0x20(%bp), %edi
+ movw 0x28(%bp), %ds
+ movw 0x30(%bp), %es
+ movw 0x34(%bp), %fs
+ movw 0x38(%bp), %gs
+
+
+ pushw %bp
+ sti
+ lcall *0x00(%bp)
+ cli
+ popw %bp
+
+
+ pushfl
+ popl 0x3c(%bp)
+ movl %eax, 0x04(%bp)
+ movl %ebx, 0x08(%bp)
+ movl %ecx, 0x0c(%bp)
+ movl %edx, 0x10(%bp)
+ movl %esi, 0x1c(%bp)
+ movl %edi, 0x20(%bp)
+ movw %ds, 0x28(%bp)
+ movw %es, 0x30(%bp)
+ movw %fs, 0x34(%bp)
+ movw %gs, 0x38(%bp)
+
+
+ addr32 data32 lgdt %cs:( gdtr - (0x2000 << 4) )
+ addr32 data32 lidt %cs:( idtr - (0x2000 << 4) )
+ popl %eax
+ movl %eax, %cr0
+ data32 ljmp $0x20, $1f
+1: .code32
+ movw $0x30, %ax
+ movw %ax, %ds
+ movw %ax, %es
+ movw %ax, %fs
+ movw %ax, %gs
+ movw %ax, %ss
+ addl $(0x2000 << 4), %esp
+
+
+
+
+ popl %edi
+ movl %esp, %esi
+ movl $( 0x40 / 4 ), %ecx
+ cld
+ rep movsl
+ movl 0(%esi), %esp
+
+
+ popl %edi
+ popl %esi
+ popl %ebx
+ popl %ebp
+ ret
+ .size call_real, . - call_real
+
+
+ .section ".text", "ax", @progbits
+ .globl call_interrupt
+call_interrupt:
+
+ pushl %ebp
+ movl %esp, %ebp
+ pushl %ebx
+ pushl %esi
+
+
+ movl 8(%ebp), %esi
+ movl 0x00(%esi), %ebx
+ movb %bl, ( dynamic_int + 1 )
+
+
+ movw $0x2000, (0x00 + 2)(%esi)
+ movl $( dynamic_int - (0x2000 << 4) ), %eax
+ movw %ax, 0x00(%esi)
+
+
+ pushl %esi
+ call call_real
+ popl %esi
+
+
+ movl %ebx, 0x00(%esi)
+
+
+ popl %esi
+ popl %ebx
+ popl %ebp
+ ret
+ .size call_interrupt, . - call_interrupt
+
+
+ .section ".text16", "ax", @progbits
+dynamic_int:
+ int $0x00
+ lret
+ .size dynamic_int, . - dynamic_int
+
+
+ .section ".data16", "ax", @progbits
+rm_idtr:
+ .word ( ( 256 * 4 ) - 1 )
+ .long 0
+ .size rm_idtr, . - rm_idtr
+
+
+ .section ".stack16", "aw", @nobits
+ .balign 8
+_rmstack:
+ .space 8192
+ .size _rmstack, . - _rmstack
+_ermstack:
@@ -26,6 +26,7 @@
 #include "ntloader.h"
 #include "cmdline.h"
 #include "bcd.h"
+#include "trace.h"
 
 static struct nt_args args =
 {
@@ -60,6 +61,8 @@ static struct nt_args args =
     .partmap = 0x01,
 
     .initrd_path = "\\initrd.cpio",
+    .num_diskfiles = 0,
+    .trace = TRACE_SINK_PORT,
     .bcd = NULL,
     .bcd_length = 0,
     .bootmgr = NULL,
@@ -314,6 +317,25 @@ void process_cmdline (char *cmdline)
             snprintf (args.initrd_path, MAX_PATH + 1, "%s", value);
             convert_path (args.initrd_path, 1);
         }
+        else if (strcmp (key, "diskfile") == 0)
+        {
+            if (! value || ! value[0])
+                die ("Argument \"%s\" needs a value\n", "diskfile");
+            if (args.num_diskfiles >= MAX_DISKFILES)
+                die ("Too many disk files\n");
+            snprintf (args.diskfiles[args.num_diskfiles], MAX_PATH + 1,
+                      "%s", value);
+            convert_path (args.diskfiles[args.num_diskfiles++], 1);
+        }
+        else if (strcmp (key, "trace") == 0)
+        {
+            if (! value || strcasecmp (value, "port") == 0)
+                args.trace = TRACE_SINK_PORT;
+            else if (strcasecmp (value, "console") == 0)
+                args.trace = TRACE_SINK_CONSOLE;
+            else if (strcasecmp (value, "file") == 0)
+                args.trace = TRACE_SINK_FILE;
+        }
         else
         {
             /* Ignore unknown arguments */
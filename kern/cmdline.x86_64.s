@@ -0,0 +1,960 @@
+	.file	"cmdline.c"
+	.text
+	.type	convert_path, @function
+convert_path:
+	andl	$1, %esi
+.L2:
+	movb	(%rdi), %al
+	testb	%al, %al
+	je	.L19
+	cmpb	$47, %al
+	jne	.L3
+	testb	%sil, %sil
+	je	.L3
+	movb	$92, (%rdi)
+	jmp	.L4
+.L3:
+	cmpb	$58, %al
+	jne	.L5
+	movb	$32, (%rdi)
+	jmp	.L4
+.L5:
+	cmpb	$13, %al
+	je	.L8
+	cmpb	$10, %al
+	jne	.L4
+.L8:
+	movb	$0, (%rdi)
+.L4:
+	incq	%rdi
+	jmp	.L2
+.L19:
+	ret
+	.size	convert_path, .-convert_path
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"yes"
+.LC1:
+	.string	"on"
+.LC2:
+	.string	"true"
+.LC3:
+	.string	"1"
+	.text
+	.type	convert_bool, @function
+convert_bool:
+	testq	%rdi, %rdi
+	je	.L36
+	pushq	%rbx
+	leaq	.LC0(%rip), %rsi
+	movq	%rdi, %rbx
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L37
+.L23:
+	movb	$1, %al
+	jmp	.L20
+.L37:
+	leaq	.LC1(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	je	.L23
+	leaq	.LC2(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	je	.L23
+	leaq	.LC3(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	sete	%al
+.L20:
+	popq	%rbx
+	ret
+.L36:
+	movb	$1, %al
+	ret
+	.size	convert_bool, .-convert_bool
+	.section	.rodata.str1.1
+.LC4:
+	.string	"Command line: \"%s\"\n"
+.LC5:
+	.string	"uuid"
+.LC6:
+	.string	"Argument \"%s\" needs a value\n"
+.LC7:
+	.string	"%s"
+.LC8:
+	.string	"wim"
+.LC9:
+	.string	"vhd"
+.LC10:
+	.string	"ram"
+.LC11:
+	.string	"file"
+.LC12:
+	.string	".wim"
+.LC13:
+	.string	"text"
+.LC14:
+	.string	"testmode"
+.LC15:
+	.string	"hires"
+.LC16:
+	.string	"detecthal"
+.LC17:
+	.string	"minint"
+.LC18:
+	.string	"novga"
+.LC19:
+	.string	"novesa"
+.LC20:
+	.string	"altshell"
+.LC21:
+	.string	"exportascd"
+.LC22:
+	.string	"f8"
+.LC23:
+	.string	"edit"
+.LC24:
+	.string	"nx"
+.LC25:
+	.string	"OptIn"
+.LC26:
+	.string	"OptOut"
+.LC27:
+	.string	"AlwaysOff"
+.LC28:
+	.string	"AlwaysOn"
+.LC29:
+	.string	"pae"
+.LC30:
+	.string	"Default"
+.LC31:
+	.string	"Enable"
+.LC32:
+	.string	"Disable"
+.LC33:
+	.string	"safemode"
+.LC34:
+	.string	"Minimal"
+.LC35:
+	.string	"Network"
+.LC36:
+	.string	"DsRepair"
+.LC37:
+	.string	"gfxmode"
+.LC38:
+	.string	"1024x768"
+.LC39:
+	.string	"800x600"
+.LC40:
+	.string	"1024x600"
+.LC41:
+	.string	"imgofs"
+.LC42:
+	.string	"Invalid imgofs \"%s\"\n"
+.LC43:
+	.string	"loadopt"
+.LC44:
+	.string	"winload"
+.LC45:
+	.string	"sysroot"
+.LC46:
+	.string	"initrdfile"
+.LC47:
+	.string	"initrd"
+.LC48:
+	.string	"diskfile"
+.LC49:
+	.string	"Too many disk files\n"
+.LC50:
+	.string	"trace"
+.LC51:
+	.string	"port"
+.LC52:
+	.string	"console"
+.LC53:
+	.string	"\\Windows\\System32\\boot\\winload.efi"
+.LC54:
+	.string	"\\Windows\\System32\\winload.efi"
+	.text
+	.globl	process_cmdline
+	.hidden	process_cmdline
+	.type	process_cmdline, @function
+process_cmdline:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$24, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 8(%rsp)
+	leaq	args(%rip), %rax
+	movq	%rax, nt_cmdline(%rip)
+	testq	%rdi, %rdi
+	je	.L38
+	cmpb	$0, (%rdi)
+	movq	%rdi, %r13
+	je	.L38
+	movq	%rdi, %rsi
+	xorl	%eax, %eax
+	leaq	.LC4(%rip), %rdi
+	call	printf
+	leaq	.LC5(%rip), %r14
+.L42:
+	cmpb	$0, 0(%r13)
+	je	.L287
+.L153:
+	movsbl	0(%r13), %edi
+	call	isspace
+	testl	%eax, %eax
+	je	.L288
+	incq	%r13
+	jmp	.L153
+.L288:
+	movq	%r13, %r12
+	xorl	%ebp, %ebp
+.L44:
+	movb	(%r12), %bl
+	testb	%bl, %bl
+	je	.L46
+	movsbl	%bl, %edi
+	call	isspace
+	movl	%eax, %edx
+	leaq	1(%r12), %rax
+	testl	%edx, %edx
+	je	.L45
+	movb	$0, (%r12)
+	movq	%rax, %r12
+	jmp	.L46
+.L45:
+	cmpb	$61, %bl
+	jne	.L47
+	testq	%rbp, %rbp
+	jne	.L47
+	movb	$0, -1(%rax)
+	movq	%rax, %rbp
+.L47:
+	movq	%rax, %r12
+	jmp	.L44
+.L46:
+	movq	%r14, %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L49
+	testq	%rbp, %rbp
+	je	.L50
+	cmpb	$0, 0(%rbp)
+	jne	.L51
+.L50:
+	movq	%r14, %rsi
+	jmp	.L264
+.L51:
+	movq	%rbp, %rcx
+	leaq	.LC7(%rip), %rdx
+	movl	$17, %esi
+	xorl	%eax, %eax
+	leaq	292+args(%rip), %rdi
+	call	snprintf
+	jmp	.L94
+.L49:
+	leaq	.LC8(%rip), %r15
+	movq	%r13, %rdi
+	movq	%r15, %rsi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L54
+	testq	%rbp, %rbp
+	je	.L55
+	cmpb	$0, 0(%rbp)
+	jne	.L56
+.L55:
+	movq	%r15, %rsi
+.L264:
+	leaq	.LC6(%rip), %rdi
+.L266:
+	xorl	%eax, %eax
+	call	die
+.L56:
+	leaq	342+args(%rip), %r13
+	movq	%rbp, %rcx
+	movl	$256, %esi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	leaq	.LC7(%rip), %rdx
+	call	snprintf
+	movl	$1, %esi
+	movq	%r13, %rdi
+	call	convert_path
+	jmp	.L283
+.L54:
+	leaq	.LC9(%rip), %r15
+	movq	%r13, %rdi
+	movq	%r15, %rsi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L59
+	testq	%rbp, %rbp
+	je	.L55
+	cmpb	$0, 0(%rbp)
+	je	.L55
+	leaq	342+args(%rip), %r13
+	movq	%rbp, %rcx
+	movl	$256, %esi
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	leaq	.LC7(%rip), %rdx
+	call	snprintf
+	movl	$1, %esi
+	movq	%r13, %rdi
+	call	convert_path
+	jmp	.L70
+.L59:
+	leaq	.LC10(%rip), %r15
+	movq	%r13, %rdi
+	movq	%r15, %rsi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L63
+	testq	%rbp, %rbp
+	je	.L55
+	cmpb	$0, 0(%rbp)
+	je	.L55
+	leaq	342+args(%rip), %r13
+	movl	$256, %esi
+	movq	%rbp, %rcx
+	xorl	%eax, %eax
+	movq	%r13, %rdi
+	leaq	.LC7(%rip), %rdx
+	call	snprintf
+	movl	$1, %esi
+	movq	%r13, %rdi
+	call	convert_path
+	movl	$4, 288+args(%rip)
+	jmp	.L94
+.L63:
+	leaq	.LC11(%rip), %r15
+	movq	%r13, %rdi
+	movq	%r15, %rsi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L67
+	testq	%rbp, %rbp
+	je	.L55
+	cmpb	$0, 0(%rbp)
+	je	.L55
+	leaq	342+args(%rip), %r13
+	movq	%rbp, %rcx
+	movl	$256, %esi
+	xorl	%eax, %eax
+	leaq	.LC7(%rip), %rdx
+	movq	%r13, %rdi
+	call	snprintf
+	movl	$1, %esi
+	movq	%r13, %rdi
+	call	convert_path
+	movq	%rbp, %rdi
+	movl	$46, %esi
+	call	strrchr
+	movq	%rax, %rdi
+	testq	%rax, %rax
+	je	.L70
+	leaq	.LC12(%rip), %rsi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L70
+.L283:
+	xorl	%r11d, %r11d
+	movl	%r11d, 288+args(%rip)
+	jmp	.L94
+.L70:
+	movl	$1, 288+args(%rip)
+	jmp	.L94
+.L67:
+	leaq	.LC13(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	je	.L259
+	leaq	.LC14(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L75
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	%al, 1+args(%rip)
+	jmp	.L74
+.L75:
+	leaq	.LC15(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L76
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	%al, 2+args(%rip)
+	jmp	.L74
+.L76:
+	leaq	.LC16(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L77
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	%al, 3+args(%rip)
+	jmp	.L74
+.L77:
+	leaq	.LC17(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L78
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	%al, 4+args(%rip)
+	jmp	.L74
+.L78:
+	leaq	.LC18(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L79
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	%al, 5+args(%rip)
+	jmp	.L74
+.L79:
+	leaq	.LC19(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L80
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	%al, 6+args(%rip)
+	jmp	.L74
+.L80:
+	leaq	.LC20(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L81
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	$1, 7+args(%rip)
+	movb	%al, 8+args(%rip)
+	jmp	.L74
+.L81:
+	leaq	.LC21(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L82
+	movq	%rbp, %rdi
+	call	convert_bool
+	movb	%al, 9+args(%rip)
+	jmp	.L74
+.L82:
+	leaq	.LC22(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L83
+	movb	$1, 10+args(%rip)
+	jmp	.L259
+.L83:
+	leaq	.LC23(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L84
+	movb	$1, 11+args(%rip)
+.L259:
+	movb	$1, args(%rip)
+	jmp	.L74
+.L84:
+	leaq	.LC24(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L85
+	testq	%rbp, %rbp
+	je	.L86
+	leaq	.LC25(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L87
+	xorl	%r10d, %r10d
+	movq	%r10, 16+args(%rip)
+	jmp	.L94
+.L86:
+	xorl	%r9d, %r9d
+	movq	%r9, 16+args(%rip)
+	jmp	.L268
+.L87:
+	leaq	.LC26(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L90
+	movq	$1, 16+args(%rip)
+	jmp	.L94
+.L90:
+	leaq	.LC27(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L92
+	movq	$2, 16+args(%rip)
+	jmp	.L94
+.L92:
+	leaq	.LC28(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L94
+	movq	$3, 16+args(%rip)
+	jmp	.L94
+.L85:
+	leaq	.LC29(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L96
+	testq	%rbp, %rbp
+	je	.L97
+	leaq	.LC30(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L98
+	xorl	%r8d, %r8d
+	movq	%r8, 24+args(%rip)
+	jmp	.L94
+.L97:
+	xorl	%edi, %edi
+	movq	%rdi, 24+args(%rip)
+	jmp	.L268
+.L98:
+	leaq	.LC31(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L100
+	movq	$1, 24+args(%rip)
+	jmp	.L94
+.L100:
+	leaq	.LC32(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L94
+	movq	$2, 24+args(%rip)
+	jmp	.L94
+.L96:
+	leaq	.LC33(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L104
+	movb	$1, 7+args(%rip)
+	testq	%rbp, %rbp
+	je	.L105
+	leaq	.LC34(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L106
+	xorl	%esi, %esi
+	movq	%rsi, 40+args(%rip)
+	jmp	.L94
+.L105:
+	xorl	%ecx, %ecx
+	movq	%rcx, 40+args(%rip)
+	jmp	.L268
+.L106:
+	leaq	.LC35(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L107
+	movq	$1, 40+args(%rip)
+	jmp	.L94
+.L107:
+	leaq	.LC36(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L94
+	movq	$2, 40+args(%rip)
+	jmp	.L94
+.L104:
+	leaq	.LC37(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L111
+	movb	$15, 2+args(%rip)
+	testq	%rbp, %rbp
+	je	.L112
+	leaq	.LC38(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L113
+	xorl	%edx, %edx
+	movq	%rdx, 48+args(%rip)
+	jmp	.L94
+.L112:
+	xorl	%eax, %eax
+	movq	%rax, 48+args(%rip)
+	jmp	.L268
+.L113:
+	leaq	.LC39(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L114
+	movq	$1, 48+args(%rip)
+	jmp	.L94
+.L114:
+	leaq	.LC40(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L94
+	movq	$2, 48+args(%rip)
+	jmp	.L94
+.L111:
+	leaq	.LC41(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L118
+	testq	%rbp, %rbp
+	leaq	.LC41(%rip), %rsi
+	je	.L264
+	cmpb	$0, 0(%rbp)
+	je	.L264
+	xorl	%edx, %edx
+	movq	%rsp, %rsi
+	movq	%rbp, %rdi
+	call	strtoul
+	movq	%rax, 56+args(%rip)
+	movq	(%rsp), %rax
+	cmpb	$0, (%rax)
+	je	.L94
+	movq	%rbp, %rsi
+	leaq	.LC42(%rip), %rdi
+	jmp	.L266
+.L118:
+	leaq	.LC43(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L123
+	testq	%rbp, %rbp
+	leaq	.LC43(%rip), %rsi
+	je	.L264
+	cmpb	$0, 0(%rbp)
+	je	.L264
+	leaq	64+args(%rip), %r13
+	movl	$128, %esi
+	movq	%rbp, %rcx
+	xorl	%eax, %eax
+	leaq	.LC7(%rip), %rdx
+	movq	%r13, %rdi
+	call	snprintf
+	xorl	%esi, %esi
+	jmp	.L285
+.L123:
+	leaq	.LC44(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L127
+	testq	%rbp, %rbp
+	leaq	.LC44(%rip), %rsi
+	je	.L264
+	cmpb	$0, 0(%rbp)
+	je	.L264
+	movq	%rbp, %rcx
+	leaq	.LC7(%rip), %rdx
+	movl	$64, %esi
+	leaq	192+args(%rip), %r13
+	jmp	.L286
+.L127:
+	leaq	.LC45(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L131
+	testq	%rbp, %rbp
+	leaq	.LC45(%rip), %rsi
+	je	.L264
+	cmpb	$0, 0(%rbp)
+	je	.L264
+	movq	%rbp, %rcx
+	leaq	.LC7(%rip), %rdx
+	movl	$32, %esi
+	leaq	256+args(%rip), %r13
+	jmp	.L286
+.L131:
+	leaq	.LC46(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L135
+.L138:
+	testq	%rbp, %rbp
+	jne	.L256
+	jmp	.L136
+.L135:
+	leaq	.LC47(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	je	.L138
+	jmp	.L289
+.L256:
+	cmpb	$0, 0(%rbp)
+	jne	.L140
+.L136:
+	leaq	.LC47(%rip), %rsi
+	jmp	.L264
+.L140:
+	movq	%rbp, %rcx
+	leaq	.LC7(%rip), %rdx
+	movl	$256, %esi
+	leaq	598+args(%rip), %r13
+.L286:
+	movq	%r13, %rdi
+	xorl	%eax, %eax
+	call	snprintf
+	movl	$1, %esi
+.L285:
+	movq	%r13, %rdi
+	jmp	.L284
+.L289:
+	leaq	.LC48(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L142
+	testq	%rbp, %rbp
+	leaq	.LC48(%rip), %rsi
+	je	.L264
+	cmpb	$0, 0(%rbp)
+	je	.L264
+	movl	1880+args(%rip), %eax
+	cmpl	$3, %eax
+	jbe	.L145
+	leaq	.LC49(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L145:
+	salq	$8, %rax
+	leaq	args(%rip), %r13
+	movl	$256, %esi
+	movq	%rbp, %rcx
+	leaq	854(%r13,%rax), %rdi
+	leaq	.LC7(%rip), %rdx
+	xorl	%eax, %eax
+	call	snprintf
+	movl	1880+args(%rip), %eax
+	movl	$1, %esi
+	leal	1(%rax), %edx
+	salq	$8, %rax
+	movl	%edx, 1880+args(%rip)
+	leaq	854(%r13,%rax), %rdi
+.L284:
+	call	convert_path
+	jmp	.L94
+.L142:
+	leaq	.LC50(%rip), %rsi
+	movq	%r13, %rdi
+	call	strcmp
+	testl	%eax, %eax
+	jne	.L74
+	testq	%rbp, %rbp
+	je	.L147
+	leaq	.LC51(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L148
+	movb	$0, 1884+args(%rip)
+	jmp	.L94
+.L147:
+	movb	$0, 1884+args(%rip)
+.L268:
+	testb	%bl, %bl
+	je	.L89
+	movb	%bl, -1(%r12)
+	jmp	.L89
+.L148:
+	leaq	.LC52(%rip), %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L149
+	movb	$1, 1884+args(%rip)
+	jmp	.L94
+.L149:
+	movq	%r15, %rsi
+	movq	%rbp, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L94
+	movb	$2, 1884+args(%rip)
+.L94:
+	testb	%bl, %bl
+	je	.L53
+	movb	%bl, -1(%r12)
+	jmp	.L53
+.L74:
+	testb	%bl, %bl
+	je	.L152
+	movb	%bl, -1(%r12)
+.L152:
+	testq	%rbp, %rbp
+	je	.L89
+.L53:
+	movb	$61, -1(%rbp)
+.L89:
+	movq	%r12, %r13
+	jmp	.L42
+.L287:
+	cmpb	$-1, 2+args(%rip)
+	jne	.L154
+	cmpl	$0, 288+args(%rip)
+	sete	2+args(%rip)
+.L154:
+	cmpb	$-1, 4+args(%rip)
+	jne	.L156
+	cmpl	$0, 288+args(%rip)
+	sete	4+args(%rip)
+.L156:
+	cmpb	$0, 192+args(%rip)
+	jne	.L38
+	cmpl	$0, 288+args(%rip)
+	leaq	.LC7(%rip), %rdx
+	leaq	192+args(%rip), %rdi
+	jne	.L158
+	movq	8(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	leaq	.LC53(%rip), %rcx
+	je	.L263
+	jmp	.L265
+.L158:
+	movq	8(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	leaq	.LC54(%rip), %rcx
+	jne	.L265
+.L263:
+	addq	$24, %rsp
+	movl	$64, %esi
+	xorl	%eax, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	jmp	snprintf
+.L38:
+	movq	8(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L161
+.L265:
+	call	__stack_chk_fail@PLT
+.L161:
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	process_cmdline, .-process_cmdline
+	.hidden	nt_cmdline
+	.globl	nt_cmdline
+	.bss
+	.align 8
+	.type	nt_cmdline, @object
+	.size	nt_cmdline, 8
+nt_cmdline:
+	.zero	8
+	.data
+	.align 32
+	.type	args, @object
+	.size	args, 1920
+args:
+	.byte	0
+	.byte	0
+	.byte	-1
+	.byte	1
+	.byte	-1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.zero	4
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	0
+	.quad	65536
+	.string	"/DISABLE_INTEGRITY_CHECKS"
+	.zero	102
+	.string	""
+	.zero	63
+	.string	"\\Windows"
+	.zero	23
+	.long	2
+	.string	""
+	.zero	16
+	.string	""
+	.string	""
+	.zero	14
+	.string	""
+	.string	""
+	.zero	14
+	.byte	1
+	.zero	256
+	.string	"\\initrd.cpio"
+	.zero	243
+	.zero	1026
+	.long	0
+	.byte	0
+	.zero	3
+	.quad	0
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.hidden	strtoul
+	.hidden	strrchr
+	.hidden	die
+	.hidden	snprintf
+	.hidden	strcmp
+	.hidden	isspace
+	.hidden	printf
+	.hidden	strcasecmp
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
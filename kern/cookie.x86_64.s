@@ -0,0 +1,47 @@
+	.file	"cookie.c"
+	.text
+	.type	make_cookie, @function
+make_cookie:
+#APP
+# 54 "kern/cookie.c" 1
+	rdtsc
+# 0 "" 2
+#NO_APP
+	salq	$32, %rdx
+	movl	%eax, %eax
+	orq	%rdx, %rax
+	salq	$8, %rax
+	ret
+	.size	make_cookie, .-make_cookie
+	.globl	init_cookie
+	.hidden	init_cookie
+	.type	init_cookie, @function
+init_cookie:
+	call	make_cookie
+	movq	%rax, __stack_chk_guard(%rip)
+	ret
+	.size	init_cookie, .-init_cookie
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Stack check failed\n"
+	.text
+	.globl	__stack_chk_fail
+	.hidden	__stack_chk_fail
+	.type	__stack_chk_fail, @function
+__stack_chk_fail:
+	pushq	%rax
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+	.size	__stack_chk_fail, .-__stack_chk_fail
+	.hidden	__stack_chk_guard
+	.globl	__stack_chk_guard
+	.bss
+	.align 8
+	.type	__stack_chk_guard, @object
+	.size	__stack_chk_guard, 8
+__stack_chk_guard:
+	.zero	8
+	.hidden	die
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
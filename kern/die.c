@@ -28,6 +28,7 @@
 #include <stdio.h>
 #include "ntloader.h"
 #include "efi.h"
+#include "trace.h"
 
 /**
  * Handle fatal errors
@@ -45,6 +46,9 @@ void die (const char *fmt, ...)
     vprintf (fmt, args);
     va_end (args);
 
+    /* Write out any pending trace records */
+    trace_flush ();
+
     /* Wait for keypress */
     printf ("Press a key to reboot...");
     getchar();
@@ -0,0 +1,68 @@
+	.file	"die.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Press a key to reboot..."
+.LC1:
+	.string	"\n"
+.LC2:
+	.string	"Failed to reboot\n"
+	.text
+	.globl	die
+	.hidden	die
+	.type	die, @function
+die:
+	subq	$216, %rsp
+	movq	%rsi, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L2
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L2:
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	224(%rsp), %rax
+	movq	%rsp, %rsi
+	movl	$8, (%rsp)
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movl	$48, 4(%rsp)
+	movq	%rax, 16(%rsp)
+	call	vprintf
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	call	getchar
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	subq	$32, %rsp
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	movq	efi_systab(%rip), %rax
+	xorl	%edx, %edx
+	movl	$1, %ecx
+	movq	88(%rax), %rax
+	call	*104(%rax)
+	addq	$32, %rsp
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	.size	die, .-die
+	.hidden	efi_systab
+	.hidden	getchar
+	.hidden	printf
+	.hidden	vprintf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
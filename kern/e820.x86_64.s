@@ -0,0 +1,73 @@
+	.file	"e820.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"INT 15,e820 failed: error %02x\n"
+.LC1:
+	.string	"INT 15,e820 invalid SMAP signature %08x\n"
+	.text
+	.globl	memmap_next
+	.hidden	memmap_next
+	.type	memmap_next, @function
+memmap_next:
+	subq	$88, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 72(%rsp)
+	xorl	%eax, %eax
+	testq	%rdi, %rdi
+	jne	.L2
+	movl	$24, %edx
+	xorl	%esi, %esi
+	leaq	e820_buf(%rip), %rdi
+	call	memset
+	xorl	%eax, %eax
+	movl	%eax, e820_ebx(%rip)
+	jmp	.L3
+.L2:
+	cmpl	$0, e820_ebx(%rip)
+	je	.L4
+.L3:
+	leaq	8(%rsp), %rdi
+	xorl	%esi, %esi
+	movl	$64, %edx
+	call	memset
+	movl	$8192, 56(%rsp)
+	movabsq	$255224136597525, %rax
+	movl	$232, %esi
+	movq	%rax, 8(%rsp)
+	movl	e820_ebx(%rip), %eax
+	leaq	.LC0(%rip), %rdi
+	movl	%eax, 16(%rsp)
+	movabsq	$6002525690207928344, %rax
+	movq	%rax, 20(%rsp)
+	leaq	-131072+e820_buf(%rip), %rax
+	movl	%eax, 40(%rsp)
+	testb	$1, 68(%rsp)
+	jne	.L8
+	movl	$59424, %esi
+	leaq	.LC1(%rip), %rdi
+.L8:
+	xorl	%eax, %eax
+	call	printf
+.L4:
+	movq	72(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L6
+	call	__stack_chk_fail@PLT
+.L6:
+	xorl	%eax, %eax
+	addq	$88, %rsp
+	ret
+	.size	memmap_next, .-memmap_next
+	.local	e820_ebx
+	.comm	e820_ebx,4,4
+	.section	.bss16,"aw"
+	.align 16
+	.type	e820_buf, @object
+	.size	e820_buf, 24
+e820_buf:
+	.zero	24
+	.hidden	printf
+	.hidden	memset
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
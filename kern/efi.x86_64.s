@@ -0,0 +1,180 @@
+	.file	"efi.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Could not allocate memory.\n"
+	.text
+	.globl	efi_malloc
+	.hidden	efi_malloc
+	.type	efi_malloc, @function
+efi_malloc:
+	subq	$56, %rsp
+	xorl	%ecx, %ecx
+	movq	%rdi, %rdx
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	movq	efi_systab(%rip), %rax
+	movq	%rcx, 32(%rsp)
+	leaq	32(%rsp), %r8
+	movl	$2, %ecx
+	movq	96(%rax), %rax
+	call	*64(%rax)
+	addq	$32, %rsp
+	testq	%rax, %rax
+	jne	.L2
+	movq	(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L1
+.L2:
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L1:
+	movq	8(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L4
+	call	__stack_chk_fail@PLT
+.L4:
+	addq	$24, %rsp
+	ret
+	.size	efi_malloc, .-efi_malloc
+	.globl	efi_free
+	.hidden	efi_free
+	.type	efi_free, @function
+efi_free:
+	subq	$40, %rsp
+	movq	efi_systab(%rip), %rax
+	movq	%rdi, %rcx
+	movq	96(%rax), %rax
+	call	*72(%rax)
+	addq	$40, %rsp
+	ret
+	.size	efi_free, .-efi_free
+	.globl	efi_free_pages
+	.hidden	efi_free_pages
+	.type	efi_free_pages, @function
+efi_free_pages:
+	subq	$40, %rsp
+	movq	efi_systab(%rip), %rax
+	movq	%rdi, %rcx
+	movq	%rsi, %rdx
+	movq	96(%rax), %rax
+	call	*48(%rax)
+	addq	$40, %rsp
+	ret
+	.size	efi_free_pages, .-efi_free_pages
+	.globl	efi_allocate_pages
+	.hidden	efi_allocate_pages
+	.type	efi_allocate_pages, @function
+efi_allocate_pages:
+	subq	$56, %rsp
+	xorl	%ecx, %ecx
+	movq	%rdi, %r8
+	movl	%esi, %edx
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	movq	efi_systab(%rip), %rax
+	movq	%rcx, 32(%rsp)
+	leaq	32(%rsp), %r9
+	xorl	%ecx, %ecx
+	movq	96(%rax), %rax
+	call	*40(%rax)
+	addq	$32, %rsp
+	testq	%rax, %rax
+	je	.L12
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L12:
+	movq	(%rsp), %rax
+	movq	8(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L13
+	call	__stack_chk_fail@PLT
+.L13:
+	addq	$24, %rsp
+	ret
+	.size	efi_allocate_pages, .-efi_allocate_pages
+	.hidden	efi_gop_guid
+	.globl	efi_gop_guid
+	.data
+	.align 16
+	.type	efi_gop_guid, @object
+	.size	efi_gop_guid, 16
+efi_gop_guid:
+	.long	-1874679330
+	.value	9180
+	.value	19000
+	.ascii	"\226\373z\336\320\200Qj"
+	.hidden	efi_load_file2_protocol_guid
+	.globl	efi_load_file2_protocol_guid
+	.align 16
+	.type	efi_load_file2_protocol_guid, @object
+	.size	efi_load_file2_protocol_guid, 16
+efi_load_file2_protocol_guid:
+	.long	1074184385
+	.value	-845
+	.value	16446
+	.ascii	"\231mJl\207$\340m"
+	.hidden	efi_simple_file_system_protocol_guid
+	.globl	efi_simple_file_system_protocol_guid
+	.align 16
+	.type	efi_simple_file_system_protocol_guid, @object
+	.size	efi_simple_file_system_protocol_guid, 16
+efi_simple_file_system_protocol_guid:
+	.long	-1773249758
+	.value	25689
+	.value	4562
+	.string	"\2169"
+	.ascii	"\240\311ir;"
+	.hidden	efi_loaded_image_protocol_guid
+	.globl	efi_loaded_image_protocol_guid
+	.align 16
+	.type	efi_loaded_image_protocol_guid, @object
+	.size	efi_loaded_image_protocol_guid, 16
+efi_loaded_image_protocol_guid:
+	.long	1528508833
+	.value	-27294
+	.value	4562
+	.string	"\216?"
+	.ascii	"\240\311ir;"
+	.hidden	efi_device_path_protocol_guid
+	.globl	efi_device_path_protocol_guid
+	.align 16
+	.type	efi_device_path_protocol_guid, @object
+	.size	efi_device_path_protocol_guid, 16
+efi_device_path_protocol_guid:
+	.long	156724881
+	.value	27967
+	.value	4562
+	.string	"\2169"
+	.ascii	"\240\311ir;"
+	.hidden	efi_block_io_protocol_guid
+	.globl	efi_block_io_protocol_guid
+	.align 16
+	.type	efi_block_io_protocol_guid, @object
+	.size	efi_block_io_protocol_guid, 16
+efi_block_io_protocol_guid:
+	.long	-1773249759
+	.value	25689
+	.value	4562
+	.string	"\2169"
+	.ascii	"\240\311ir;"
+	.hidden	efi_image_handle
+	.globl	efi_image_handle
+	.bss
+	.align 8
+	.type	efi_image_handle, @object
+	.size	efi_image_handle, 8
+efi_image_handle:
+	.zero	8
+	.hidden	efi_systab
+	.globl	efi_systab
+	.align 8
+	.type	efi_systab, @object
+	.size	efi_systab, 8
+efi_systab:
+	.zero	8
+	.hidden	die
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,292 @@
+	.file	"efiblock.c"
+	.text
+	.type	efi_flush_blocks, @function
+efi_flush_blocks:
+	xorl	%eax, %eax
+	ret
+	.size	efi_flush_blocks, .-efi_flush_blocks
+	.type	efi_write_blocks, @function
+efi_write_blocks:
+	movabsq	$-9223372036854775800, %rax
+	ret
+	.size	efi_write_blocks, .-efi_write_blocks
+	.type	efi_reset_blocks, @function
+efi_reset_blocks:
+	xorl	%eax, %eax
+	ret
+	.size	efi_reset_blocks, .-efi_reset_blocks
+	.type	efi_read_blocks, @function
+efi_read_blocks:
+	pushq	%rdi
+	shrq	$9, %r9
+	pushq	%rsi
+	movl	%r9d, %esi
+	subq	$168, %rsp
+	movq	56(%rcx), %rdi
+	movq	224(%rsp), %rdx
+	movaps	%xmm6, (%rsp)
+	addq	%r8, %rdi
+	movaps	%xmm7, 16(%rsp)
+	movaps	%xmm8, 32(%rsp)
+	movaps	%xmm9, 48(%rsp)
+	movaps	%xmm10, 64(%rsp)
+	movaps	%xmm11, 80(%rsp)
+	movaps	%xmm12, 96(%rsp)
+	movaps	%xmm13, 112(%rsp)
+	movaps	%xmm14, 128(%rsp)
+	movaps	%xmm15, 144(%rsp)
+	call	vdisk_read
+	movaps	(%rsp), %xmm6
+	movaps	16(%rsp), %xmm7
+	xorl	%eax, %eax
+	movaps	32(%rsp), %xmm8
+	movaps	48(%rsp), %xmm9
+	movaps	64(%rsp), %xmm10
+	movaps	80(%rsp), %xmm11
+	movaps	96(%rsp), %xmm12
+	movaps	112(%rsp), %xmm13
+	movaps	128(%rsp), %xmm14
+	movaps	144(%rsp), %xmm15
+	addq	$168, %rsp
+	popq	%rsi
+	popq	%rdi
+	ret
+	.size	efi_read_blocks, .-efi_read_blocks
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Could not install disk block I/O protocols: %#lx\n"
+.LC1:
+	.string	"Could not install partition block I/O protocols: %#lx\n"
+	.text
+	.globl	efi_install
+	.hidden	efi_install
+	.type	efi_install, @function
+efi_install:
+	movq	efi_systab(%rip), %rax
+	pushq	%r12
+	leaq	efi_block_io_protocol_guid(%rip), %r12
+	movq	%rdi, %rcx
+	pushq	%rbp
+	leaq	efi_device_path_protocol_guid(%rip), %r9
+	leaq	efi_vdisk(%rip), %r8
+	movq	%r12, %rdx
+	pushq	%rbx
+	movq	96(%rax), %rbp
+	movq	%rsi, %rbx
+	pushq	$0
+	pushq	48+efi_vdisk(%rip)
+	subq	$32, %rsp
+	call	*328(%rbp)
+	addq	$48, %rsp
+	leaq	.LC0(%rip), %rdi
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	jne	.L10
+	pushq	$0
+	leaq	efi_device_path_protocol_guid(%rip), %r9
+	movq	%r12, %rdx
+	movq	%rbx, %rcx
+	pushq	48+efi_vpartition(%rip)
+	leaq	efi_vpartition(%rip), %r8
+	subq	$32, %rsp
+	call	*328(%rbp)
+	addq	$48, %rsp
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L6
+	leaq	.LC1(%rip), %rdi
+.L10:
+	xorl	%eax, %eax
+	call	die
+.L6:
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	efi_install, .-efi_install
+	.hidden	bootmgfw_path
+	.globl	bootmgfw_path
+	.section	.data.rel.local,"aw"
+	.align 8
+	.type	bootmgfw_path, @object
+	.size	bootmgfw_path, 8
+bootmgfw_path:
+	.quad	efi_bootmgfw_path
+	.data
+	.align 32
+	.type	efi_bootmgfw_path, @object
+	.size	efi_bootmgfw_path, 122
+efi_bootmgfw_path:
+	.byte	1
+	.byte	4
+	.string	"\024"
+	.long	321048983
+	.value	5596
+	.value	19013
+	.ascii	"\246\244\372W\005N\246\024"
+	.byte	3
+	.byte	1
+	.string	"\b"
+	.byte	0
+	.byte	0
+	.value	0
+	.byte	4
+	.byte	1
+	.string	"*"
+	.long	1
+	.quad	128
+	.quad	4294442944
+	.string	")\005S\024"
+	.zero	11
+	.byte	1
+	.byte	1
+	.byte	4
+	.byte	4
+	.string	"0"
+	.string	"\\"
+	.string	"E"
+	.string	"F"
+	.string	"I"
+	.string	"\\"
+	.string	"B"
+	.string	"O"
+	.string	"O"
+	.string	"T"
+	.string	"\\"
+	.string	"B"
+	.string	"O"
+	.string	"O"
+	.string	"T"
+	.string	"X"
+	.string	"6"
+	.string	"4"
+	.string	"."
+	.string	"E"
+	.string	"F"
+	.string	"I"
+	.string	""
+	.string	""
+	.byte	127
+	.byte	-1
+	.string	"\004"
+	.section	.rodata.str1.1
+.LC2:
+	.string	"vpartition"
+	.section	.data.rel.local
+	.align 32
+	.type	efi_vpartition, @object
+	.size	efi_vpartition, 72
+efi_vpartition:
+	.quad	65536
+	.quad	efi_vpartition_media
+	.quad	efi_reset_blocks
+	.quad	efi_read_blocks
+	.quad	efi_write_blocks
+	.quad	efi_flush_blocks
+	.quad	efi_vpartition_path
+	.quad	128
+	.quad	.LC2
+	.data
+	.align 32
+	.type	efi_vpartition_path, @object
+	.size	efi_vpartition_path, 74
+efi_vpartition_path:
+	.byte	1
+	.byte	4
+	.string	"\024"
+	.long	321048983
+	.value	5596
+	.value	19013
+	.ascii	"\246\244\372W\005N\246\024"
+	.byte	3
+	.byte	1
+	.string	"\b"
+	.byte	0
+	.byte	0
+	.value	0
+	.byte	4
+	.byte	1
+	.string	"*"
+	.long	1
+	.quad	128
+	.quad	4294442944
+	.string	")\005S\024"
+	.zero	11
+	.byte	1
+	.byte	1
+	.byte	127
+	.byte	-1
+	.string	"\004"
+	.align 32
+	.type	efi_vpartition_media, @object
+	.size	efi_vpartition_media, 48
+efi_vpartition_media:
+	.long	340985129
+	.zero	1
+	.byte	1
+	.byte	1
+	.byte	1
+	.zero	4
+	.long	512
+	.zero	8
+	.quad	4294442943
+	.zero	16
+	.section	.rodata.str1.1
+.LC3:
+	.string	"vdisk"
+	.section	.data.rel.local
+	.align 32
+	.type	efi_vdisk, @object
+	.size	efi_vdisk, 72
+efi_vdisk:
+	.quad	65536
+	.quad	efi_vdisk_media
+	.quad	efi_reset_blocks
+	.quad	efi_read_blocks
+	.quad	efi_write_blocks
+	.quad	efi_flush_blocks
+	.quad	efi_vdisk_path
+	.quad	0
+	.quad	.LC3
+	.data
+	.align 32
+	.type	efi_vdisk_path, @object
+	.size	efi_vdisk_path, 32
+efi_vdisk_path:
+	.byte	1
+	.byte	4
+	.string	"\024"
+	.long	321048983
+	.value	5596
+	.value	19013
+	.ascii	"\246\244\372W\005N\246\024"
+	.byte	3
+	.byte	1
+	.string	"\b"
+	.byte	0
+	.byte	0
+	.value	0
+	.byte	127
+	.byte	-1
+	.string	"\004"
+	.align 32
+	.type	efi_vdisk_media, @object
+	.size	efi_vdisk_media, 48
+efi_vdisk_media:
+	.long	340985129
+	.zero	1
+	.byte	1
+	.byte	0
+	.byte	1
+	.zero	4
+	.long	512
+	.zero	8
+	.quad	4294443071
+	.zero	16
+	.hidden	die
+	.hidden	efi_device_path_protocol_guid
+	.hidden	efi_block_io_protocol_guid
+	.hidden	efi_systab
+	.hidden	vdisk_read
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
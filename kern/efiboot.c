@@ -31,8 +31,41 @@
 #include "vdisk.h"
 #include "efi.h"
 #include "efiboot.h"
+#include "trace.h"
 #include "efi/Protocol/GraphicsOutput.h"
 
+#ifdef VDISK_TRACE
+
+/** Original ExitBootServices() method */
+static EFI_EXIT_BOOT_SERVICES orig_exit_boot_services;
+
+/**
+ * Intercept ExitBootServices()
+ *
+ * @v image_handle	Image handle
+ * @v map_key		Memory map key
+ * @ret efirc		EFI status code
+ */
+static EFI_STATUS EFIAPI
+efi_exit_boot_services_wrapper (EFI_HANDLE image_handle, UINTN map_key)
+{
+    EFI_BOOT_SERVICES *bs = efi_systab->BootServices;
+    EFI_STATUS efirc;
+
+    /* Write out trace while boot services are still available.
+     * Writing to a file may change the memory map, in which case
+     * this attempt fails (as the UEFI specification permits) and
+     * the caller must retry with a fresh memory map key.
+     */
+    trace_flush ();
+    efirc = orig_exit_boot_services (image_handle, map_key);
+    if (efirc == 0)
+        bs->ExitBootServices = orig_exit_boot_services;
+    return efirc;
+}
+
+#endif
+
 #ifdef ENABLE_TEXT_DEBUG
 
 /** Original OpenProtocol() method */
@@ -161,6 +194,14 @@ void efi_boot (EFI_DEVICE_PATH_PROTOCOL *path,
         efi_open_protocol_wrapper;
 #endif
 
+#ifdef VDISK_TRACE
+    /* Intercept calls to ExitBootServices() */
+    orig_exit_boot_services =
+        loaded.image->SystemTable->BootServices->ExitBootServices;
+    loaded.image->SystemTable->BootServices->ExitBootServices =
+        efi_exit_boot_services_wrapper;
+#endif
+
     if (! nt_cmdline->textmode)
         efi_set_text_mode (0);
 
@@ -0,0 +1,120 @@
+	.file	"efiboot.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Could not load bootmgfw.efi: %#lx\n"
+.LC1:
+	.string	"Loaded bootmgfw.efi\n"
+.LC2:
+	.string	"Could not get loaded image protocol: %#lx\n"
+.LC3:
+	.string	"Forcing correct DeviceHandle (%p->%p)\n"
+.LC4:
+	.string	"Could not start bootmgfw.efi: %#lx\n"
+.LC5:
+	.string	"bootmgfw.efi returned\n"
+	.text
+	.globl	efi_boot
+	.hidden	efi_boot
+	.type	efi_boot, @function
+efi_boot:
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rsi, %rbx
+	movl	$1, %esi
+	subq	$56, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	movq	efi_systab(%rip), %rax
+	movq	%rdi, 8(%rsp)
+	movq	96(%rax), %rbp
+	movq	nt_cmdline(%rip), %rax
+	movl	1912(%rax), %edi
+	addl	$4095, %edi
+	shrl	$12, %edi
+	call	efi_allocate_pages
+	movq	%rax, %r9
+	movq	nt_cmdline(%rip), %rax
+	movq	%r9, %rdi
+	movq	%r9, (%rsp)
+	movq	1904(%rax), %rsi
+	movl	1912(%rax), %edx
+	call	memcpy
+	leaq	32(%rsp), %rax
+	movq	efi_image_handle(%rip), %rdx
+	xorl	%ecx, %ecx
+	pushq	%rax
+	movq	nt_cmdline(%rip), %rax
+	movl	1912(%rax), %eax
+	pushq	%rax
+	subq	$32, %rsp
+	movq	48(%rsp), %r9
+	movq	56(%rsp), %r8
+	call	*200(%rbp)
+	addq	$48, %rsp
+	leaq	.LC0(%rip), %rdi
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	jne	.L9
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	pushq	$2
+	movq	efi_image_handle(%rip), %r9
+	leaq	efi_loaded_image_protocol_guid(%rip), %rdx
+	pushq	$0
+	subq	$32, %rsp
+	movq	80(%rsp), %rcx
+	leaq	72(%rsp), %r8
+	call	*280(%rbp)
+	addq	$48, %rsp
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	je	.L3
+	leaq	.LC2(%rip), %rdi
+.L9:
+	xorl	%eax, %eax
+	call	die
+.L3:
+	movq	24(%rsp), %rax
+	movq	24(%rax), %rsi
+	cmpq	%rbx, %rsi
+	je	.L4
+	movq	%rbx, %rdx
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	24(%rsp), %rax
+	movq	%rbx, 24(%rax)
+.L4:
+	movq	nt_cmdline(%rip), %rax
+	cmpb	$0, (%rax)
+	jne	.L5
+	xorl	%edi, %edi
+	call	efi_set_text_mode
+.L5:
+	subq	$32, %rsp
+	xorl	%r8d, %r8d
+	xorl	%edx, %edx
+	movq	64(%rsp), %rcx
+	call	*208(%rbp)
+	addq	$32, %rsp
+	leaq	.LC4(%rip), %rdi
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	jne	.L9
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+	.size	efi_boot, .-efi_boot
+	.hidden	efi_set_text_mode
+	.hidden	die
+	.hidden	efi_loaded_image_protocol_guid
+	.hidden	printf
+	.hidden	efi_image_handle
+	.hidden	memcpy
+	.hidden	efi_allocate_pages
+	.hidden	nt_cmdline
+	.hidden	efi_systab
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,283 @@
+	.file	"efifile.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Could not open simple file system.\n"
+.LC1:
+	.string	"Could not open root directory.\n"
+.LC2:
+	.string	"Could not open %ls.\n"
+.LC3:
+	.string	"Could not get file size\n"
+.LC4:
+	.string	"...found %ls size 0x%llx\n"
+.LC5:
+	.string	"Could not read from file.\n"
+	.text
+	.type	efi_load_sfs_initrd, @function
+efi_load_sfs_initrd:
+	pushq	%r14
+	leaq	efi_simple_file_system_protocol_guid(%rip), %r14
+	pushq	%r13
+	pushq	%r12
+	movq	%rsi, %r12
+	movl	$256, %esi
+	pushq	%rbp
+	movq	%rdi, %rbp
+	pushq	%rbx
+	subq	$560, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 552(%rsp)
+	movq	efi_systab(%rip), %rax
+	leaq	40(%rsp), %rbx
+	movq	%rbx, %rdi
+	movq	96(%rax), %r13
+	movq	nt_cmdline(%rip), %rax
+	leaq	598(%rax), %rdx
+	call	utf8_to_ucs2
+	movq	efi_image_handle(%rip), %r9
+	movq	%r14, %rdx
+	movq	%r12, %rcx
+	movw	$0, (%rax)
+	pushq	$2
+	pushq	$0
+	subq	$32, %rsp
+	leaq	56(%rsp), %r8
+	call	*280(%r13)
+	addq	$48, %rsp
+	leaq	.LC0(%rip), %rdi
+	testq	%rax, %rax
+	jne	.L9
+	movq	8(%rsp), %rax
+	leaq	16(%rsp), %rdx
+	subq	$32, %rsp
+	movq	%rax, %rcx
+	call	*8(%rax)
+	addq	$32, %rsp
+	testq	%rax, %rax
+	je	.L3
+	leaq	.LC1(%rip), %rdi
+.L9:
+	xorl	%eax, %eax
+	call	die
+.L3:
+	subq	$32, %rsp
+	movq	%r12, %rcx
+	xorl	%r9d, %r9d
+	movq	%r14, %rdx
+	movq	efi_image_handle(%rip), %r8
+	call	*288(%r13)
+	movq	48(%rsp), %rax
+	addq	$32, %rsp
+	movq	%rbx, %r8
+	leaq	24(%rsp), %rdx
+	pushq	%rcx
+	movl	$1, %r9d
+	pushq	$0
+	movq	%rax, %rcx
+	subq	$32, %rsp
+	call	*8(%rax)
+	addq	$48, %rsp
+	testq	%rax, %rax
+	je	.L4
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L4:
+	movq	24(%rsp), %rax
+	subq	$32, %rsp
+	orq	$-1, %rdx
+	movq	%rax, %rcx
+	call	*56(%rax)
+	movq	56(%rsp), %rax
+	addq	$32, %rsp
+	leaq	32(%rsp), %rdx
+	subq	$32, %rsp
+	movq	%rax, %rcx
+	call	*48(%rax)
+	movq	56(%rsp), %rax
+	xorl	%edx, %edx
+	movq	%rax, %rcx
+	call	*56(%rax)
+	movq	64(%rsp), %rdx
+	leaq	.LC3(%rip), %rdi
+	addq	$32, %rsp
+	testq	%rdx, %rdx
+	je	.L9
+	movq	%rbx, %rsi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	32(%rsp), %rdi
+	movl	$2, %esi
+	movq	%rdi, 0(%rbp)
+	addq	$4095, %rdi
+	shrq	$12, %rdi
+	call	efi_allocate_pages
+	subq	$32, %rsp
+	movq	%rbp, %rdx
+	movq	%rax, %rbx
+	movq	56(%rsp), %rax
+	movq	%rbx, %r8
+	movq	%rax, %rcx
+	call	*32(%rax)
+	addq	$32, %rsp
+	leaq	.LC5(%rip), %rdi
+	testq	%rax, %rax
+	jne	.L9
+	movq	552(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L7
+	call	__stack_chk_fail@PLT
+.L7:
+	addq	$560, %rsp
+	movq	%rbx, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	efi_load_sfs_initrd, .-efi_load_sfs_initrd
+	.section	.rodata.str1.1
+.LC6:
+	.string	"...found initrd media device\n"
+.LC7:
+	.string	"Could not get LoadFile2 protocol.\n"
+.LC8:
+	.string	"Could not get initrd size\n"
+.LC9:
+	.string	"Could not read initrd.\n"
+.LC10:
+	.string	"Could not load initrd\n"
+	.text
+	.globl	efi_extract
+	.hidden	efi_extract
+	.type	efi_extract, @function
+efi_extract:
+	pushq	%r13
+	xorl	%esi, %esi
+	leaq	efi_load_file2_protocol_guid(%rip), %r13
+	pushq	%r12
+	movq	%r13, %rcx
+	movq	%rdi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$56, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	xorl	%eax, %eax
+	movq	%rsi, 8(%rsp)
+	leaq	32(%rsp), %rdx
+	movq	efi_systab(%rip), %rax
+	subq	$32, %rsp
+	movq	96(%rax), %rbx
+	leaq	efi_initrd_path(%rip), %rax
+	movq	%rax, 64(%rsp)
+	leaq	48(%rsp), %r8
+	call	*184(%rbx)
+	addq	$32, %rsp
+	testq	%rax, %rax
+	leaq	8(%rsp), %rbp
+	jne	.L16
+	leaq	.LC6(%rip), %rdi
+	call	printf
+	subq	$32, %rsp
+	movq	%r13, %rdx
+	movq	48(%rsp), %rcx
+	leaq	56(%rsp), %r8
+	call	*152(%rbx)
+	addq	$32, %rsp
+	leaq	.LC7(%rip), %rdi
+	testq	%rax, %rax
+	jne	.L20
+	movq	24(%rsp), %rax
+	pushq	%rcx
+	movq	%rbp, %r9
+	xorl	%r8d, %r8d
+	pushq	$0
+	movq	%rax, %rcx
+	subq	$32, %rsp
+	movq	80(%rsp), %rdx
+	call	*(%rax)
+	movq	56(%rsp), %rdi
+	addq	$48, %rsp
+	testq	%rdi, %rdi
+	jne	.L14
+	leaq	.LC8(%rip), %rdi
+.L20:
+	xorl	%eax, %eax
+	call	die
+.L14:
+	addq	$4095, %rdi
+	movl	$2, %esi
+	shrq	$12, %rdi
+	call	efi_allocate_pages
+	movq	%rbp, %r9
+	xorl	%r8d, %r8d
+	movq	%rax, %rbx
+	movq	24(%rsp), %rax
+	pushq	%rdx
+	pushq	%rbx
+	movq	%rax, %rcx
+	subq	$32, %rsp
+	movq	80(%rsp), %rdx
+	call	*(%rax)
+	addq	$48, %rsp
+	leaq	.LC9(%rip), %rdi
+	testq	%rax, %rax
+	jne	.L20
+	testq	%rbx, %rbx
+	jne	.L17
+.L16:
+	movq	%rbp, %rdi
+	movq	%r12, %rsi
+	call	efi_load_sfs_initrd
+	leaq	.LC10(%rip), %rdi
+	movq	%rax, %rbx
+	testq	%rax, %rax
+	je	.L20
+.L17:
+	movq	8(%rsp), %rsi
+	movq	%rbx, %rdi
+	call	extract_initrd
+	movq	40(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L18
+	call	__stack_chk_fail@PLT
+.L18:
+	addq	$56, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	efi_extract, .-efi_extract
+	.data
+	.align 16
+	.type	efi_initrd_path, @object
+	.size	efi_initrd_path, 24
+efi_initrd_path:
+	.byte	4
+	.byte	3
+	.string	"\024"
+	.long	1432937511
+	.value	26876
+	.value	20285
+	.ascii	"\254t\312UR1\314h"
+	.byte	127
+	.byte	-1
+	.string	"\004"
+	.hidden	extract_initrd
+	.hidden	efi_load_file2_protocol_guid
+	.hidden	efi_allocate_pages
+	.hidden	printf
+	.hidden	die
+	.hidden	efi_image_handle
+	.hidden	utf8_to_ucs2
+	.hidden	nt_cmdline
+	.hidden	efi_systab
+	.hidden	efi_simple_file_system_protocol_guid
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
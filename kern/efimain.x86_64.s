@@ -0,0 +1,139 @@
+	.file	"efimain.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"\n\nntloader v3.0.7\n\n"
+.LC1:
+	.string	"Could not open loaded image protocol: %#lx\n"
+	.text
+	.globl	efi_main
+	.hidden	efi_main
+	.type	efi_main, @function
+efi_main:
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rdi
+	pushq	%rsi
+	pushq	%rbx
+	subq	$256, %rsp
+	movq	%rcx, efi_image_handle(%rip)
+	movq	96(%rdx), %rbp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 88(%rsp)
+	xorl	%eax, %eax
+	xorl	%eax, %eax
+	movq	%rcx, 56(%rsp)
+	movq	%rdx, efi_systab(%rip)
+	movaps	%xmm6, 96(%rsp)
+	movaps	%xmm7, 112(%rsp)
+	movaps	%xmm8, 128(%rsp)
+	movaps	%xmm9, 144(%rsp)
+	movaps	%xmm10, 160(%rsp)
+	movaps	%xmm11, 176(%rsp)
+	movaps	%xmm12, 192(%rsp)
+	movaps	%xmm13, 208(%rsp)
+	movaps	%xmm14, 224(%rsp)
+	movaps	%xmm15, 240(%rsp)
+	movq	%rax, 72(%rsp)
+	movq	%rax, 80(%rsp)
+	call	init_cookie
+	movl	$1, %edi
+	call	efi_set_text_mode
+	xorl	%eax, %eax
+	leaq	.LC0(%rip), %rdi
+	call	printf
+	movq	56(%rsp), %rcx
+	xorl	%edx, %edx
+	movl	$2, 40(%rsp)
+	movq	%rdx, 32(%rsp)
+	leaq	64(%rsp), %r8
+	leaq	efi_loaded_image_protocol_guid(%rip), %rdx
+	movq	%rcx, %r9
+	call	*280(%rbp)
+	testq	%rax, %rax
+	je	.L2
+	movq	%rax, %rsi
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L2:
+	movq	64(%rsp), %r12
+	movl	48(%r12), %ebx
+	shrl	%ebx
+	leaq	1(,%rbx,4), %rdi
+	call	efi_malloc
+	movq	56(%r12), %rsi
+	movq	%rbx, %rdx
+	movq	%rax, %rdi
+	movq	%rax, %rbp
+	call	ucs2_to_utf8
+	movq	%rbp, %rdi
+	movb	$0, (%rax)
+	call	process_cmdline
+	movq	%rbp, %rdi
+	call	efi_free
+	call	efidisk_init
+	call	efidisk_iterate
+	movq	64(%rsp), %rax
+	movq	24(%rax), %rdi
+	call	efi_extract
+	leaq	80(%rsp), %rsi
+	leaq	72(%rsp), %rdi
+	call	efi_install
+	movq	80(%rsp), %rsi
+	movq	bootmgfw_path(%rip), %rdi
+	call	efi_boot
+	movq	88(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L3
+	call	__stack_chk_fail@PLT
+.L3:
+	movaps	96(%rsp), %xmm6
+	movaps	112(%rsp), %xmm7
+	xorl	%eax, %eax
+	movaps	128(%rsp), %xmm8
+	movaps	144(%rsp), %xmm9
+	movaps	160(%rsp), %xmm10
+	movaps	176(%rsp), %xmm11
+	movaps	192(%rsp), %xmm12
+	movaps	208(%rsp), %xmm13
+	movaps	224(%rsp), %xmm14
+	movaps	240(%rsp), %xmm15
+	addq	$256, %rsp
+	popq	%rbx
+	popq	%rsi
+	popq	%rdi
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	efi_main, .-efi_main
+	.hidden	sbat
+	.globl	sbat
+	.section	.sbat,"a"
+	.align 512
+	.type	sbat, @object
+	.size	sbat, 201
+sbat:
+	.ascii	"sbat,1,SBAT Version,sbat,1,https://github.com/rhboot/shim/bl"
+	.ascii	"ob/main/SBAT.md\nwimboot,1,iPXE,wimboot,v2.8.0,https://ipxe."
+	.ascii	"org/wimboot\nntloader,1,a1ive,ntloader,v3.0.7,https://github"
+	.ascii	".com/grub4dos/ntloader\n"
+	.hidden	efi_boot
+	.hidden	bootmgfw_path
+	.hidden	efi_install
+	.hidden	efi_extract
+	.hidden	efidisk_iterate
+	.hidden	efidisk_init
+	.hidden	efi_free
+	.hidden	process_cmdline
+	.hidden	ucs2_to_utf8
+	.hidden	efi_malloc
+	.hidden	die
+	.hidden	efi_loaded_image_protocol_guid
+	.hidden	printf
+	.hidden	efi_set_text_mode
+	.hidden	init_cookie
+	.hidden	efi_systab
+	.hidden	efi_image_handle
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
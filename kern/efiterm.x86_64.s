@@ -0,0 +1,103 @@
+	.file	"efiterm.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Console control protocol not found, assume text mode.\n"
+	.text
+	.globl	efi_set_text_mode
+	.hidden	efi_set_text_mode
+	.type	efi_set_text_mode, @function
+efi_set_text_mode:
+	pushq	%rbx
+	xorl	%edx, %edx
+	movl	%edi, %ebx
+	leaq	efi_console_ctrl_guid(%rip), %rcx
+	subq	$64, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 56(%rsp)
+	movq	efi_systab(%rip), %rax
+	leaq	48(%rsp), %r8
+	movq	96(%rax), %rax
+	call	*320(%rax)
+	addq	$32, %rsp
+	testq	%rax, %rax
+	je	.L2
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L4:
+	movl	$1, %eax
+	jmp	.L1
+.L2:
+	movq	16(%rsp), %rax
+	leaq	12(%rsp), %rdx
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	subq	$32, %rsp
+	movq	%rax, %rcx
+	call	*(%rax)
+	addq	$32, %rsp
+	movq	%rax, %rdx
+	xorl	%eax, %eax
+	testq	%rdx, %rdx
+	jne	.L1
+	xorl	%edx, %edx
+	testl	%ebx, %ebx
+	sete	%dl
+	cmpl	%edx, 12(%rsp)
+	je	.L4
+	movq	16(%rsp), %rax
+	subq	$32, %rsp
+	movq	%rax, %rcx
+	call	*8(%rax)
+	addq	$32, %rsp
+	testq	%rax, %rax
+	sete	%al
+	movzbl	%al, %eax
+.L1:
+	movq	24(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L5
+	call	__stack_chk_fail@PLT
+.L5:
+	addq	$32, %rsp
+	popq	%rbx
+	ret
+	.size	efi_set_text_mode, .-efi_set_text_mode
+	.globl	efi_cls
+	.hidden	efi_cls
+	.type	efi_cls, @function
+efi_cls:
+	pushq	%rbp
+	xorl	%edx, %edx
+	pushq	%rbx
+	subq	$40, %rsp
+	movq	efi_systab(%rip), %rax
+	movq	64(%rax), %rbx
+	movq	72(%rbx), %rax
+	movq	%rbx, %rcx
+	movl	8(%rax), %ebp
+	call	*40(%rbx)
+	movq	%rbx, %rcx
+	call	*48(%rbx)
+	movslq	%ebp, %rdx
+	movq	%rbx, %rcx
+	call	*40(%rbx)
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	efi_cls, .-efi_cls
+	.data
+	.align 16
+	.type	efi_console_ctrl_guid, @object
+	.size	efi_console_ctrl_guid, 16
+efi_console_ctrl_guid:
+	.long	-198215806
+	.value	302
+	.value	19474
+	.ascii	"\231VI\371C\004\367!"
+	.hidden	printf
+	.hidden	efi_systab
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,146 @@
+	.file	"int13.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Emulating drive %#02x\n"
+	.text
+	.globl	initialise_int13
+	.hidden	initialise_int13
+	.type	initialise_int13, @function
+initialise_int13:
+	pushq	%rax
+	movl	$1141, %eax
+	leaq	.LC0(%rip), %rdi
+	movb	(%rax), %sil
+	leal	1(%rsi), %edx
+	orl	$-128, %esi
+	movb	%dl, (%rax)
+	movzbl	%sil, %esi
+	xorl	%eax, %eax
+	movl	%esi, vdisk_drive(%rip)
+	call	printf
+	movl	vdisk_drive(%rip), %eax
+	popq	%rdx
+	ret
+	.size	initialise_int13, .-initialise_int13
+	.section	.rodata.str1.1
+.LC1:
+	.string	"Unrecognised INT 13,%02x\n"
+	.text
+	.globl	emulate_int13
+	.hidden	emulate_int13
+	.type	emulate_int13, @function
+emulate_int13:
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	pushq	%rdx
+	movzbl	16(%rbx), %esi
+	movl	vdisk_drive(%rip), %edx
+	movzbl	5(%rdi), %edi
+	cmpl	%esi, %edx
+	jne	.L4
+#APP
+# 195 "kern/int13.c" 1
+	pushf
+	pop %rdx
+	
+# 0 "" 2
+#NO_APP
+	andl	$-2, %edx
+	movl	%edx, 60(%rbx)
+	cmpb	$65, %dil
+	je	.L5
+	ja	.L6
+	cmpb	$8, %dil
+	je	.L7
+	cmpb	$21, %dil
+	jne	.L9
+	movw	$-8, 12(%rbx)
+	movw	$64, 16(%rbx)
+	movb	$3, 5(%rbx)
+	jmp	.L3
+.L6:
+	cmpb	$66, %dil
+	je	.L10
+	cmpb	$72, %dil
+	jne	.L9
+	movl	40(%rbx), %eax
+	movzwl	28(%rbx), %edx
+	xorl	%esi, %esi
+	sall	$4, %eax
+	leal	(%rax,%rdx), %ebp
+	movl	$26, %edx
+	movq	%rbp, %rdi
+	call	memset
+	movw	$512, 24(%rbp)
+	movabsq	$4398046576666, %rax
+	movq	%rax, 0(%rbp)
+	movabsq	$270582939903, %rax
+	movq	%rax, 8(%rbp)
+	movl	$4294443072, %eax
+	movq	%rax, 16(%rbp)
+	jmp	.L14
+.L7:
+	movl	%esi, %eax
+	movl	$1141, %edx
+	andl	$127, %eax
+	incl	%eax
+	movzbl	(%rdx), %edx
+	movzbl	%al, %eax
+	movw	$-1, 12(%rbx)
+	movb	$-2, 17(%rbx)
+	cmpl	%edx, %eax
+	cmovb	%edx, %eax
+	movb	%al, 16(%rbx)
+	jmp	.L14
+.L5:
+	movw	$-21931, 8(%rbx)
+	movw	$1, 12(%rbx)
+	movb	$1, 5(%rbx)
+	jmp	.L3
+.L10:
+	movl	40(%rbx), %eax
+	movzwl	28(%rbx), %edx
+	sall	$4, %eax
+	addl	%edx, %eax
+	movl	%eax, %eax
+	movzwl	6(%rax), %edx
+	movzwl	4(%rax), %ecx
+	movzbl	2(%rax), %esi
+	movq	8(%rax), %rdi
+	sall	$4, %edx
+	addl	%ecx, %edx
+	movslq	%edx, %rdx
+	call	vdisk_read
+.L14:
+	movb	$0, 5(%rbx)
+	jmp	.L3
+.L9:
+	movl	%edi, %esi
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	call	printf
+	orl	$1, 60(%rbx)
+	jmp	.L3
+.L4:
+	cmpl	$8, %edi
+	jne	.L3
+	andl	$127, %edx
+	incl	%edx
+	cmpl	%edx, %esi
+	jge	.L3
+	movb	%dl, 16(%rbx)
+.L3:
+	popq	%rax
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	emulate_int13, .-emulate_int13
+	.local	vdisk_drive
+	.comm	vdisk_drive,4,4
+	.hidden	vdisk_read
+	.hidden	memset
+	.hidden	printf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,311 @@
+	.file	"main.c"
+	.text
+	.type	call_real, @function
+call_real:
+	ret
+	.size	call_real, .-call_real
+	.type	call_interrupt_wrapper, @function
+call_interrupt_wrapper:
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	movl	(%rdi), %eax
+	cmpl	$19, %eax
+	jne	.L3
+	movq	%rsp, %rbp
+	movq	%rbp, %rdi
+	call	enable_paging
+	movq	%rbx, %rdi
+	call	emulate_int13
+	movq	%rbp, %rdi
+	call	disable_paging
+	jmp	.L2
+.L3:
+	cmpl	$16, %eax
+	jne	.L2
+	cmpw	$20225, 4(%rdi)
+	jne	.L2
+	movq	nt_cmdline(%rip), %rax
+	cmpb	$0, (%rax)
+	je	.L2
+	movl	48(%rdi), %eax
+	movzwl	32(%rdi), %edx
+	sall	$4, %eax
+	addl	%edx, %eax
+	movl	%eax, %eax
+	andw	$-2, (%rax)
+.L2:
+	movq	24(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L5
+	call	__stack_chk_fail@PLT
+.L5:
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	call_interrupt_wrapper, .-call_interrupt_wrapper
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"\n\nntloader v3.0.7\n\n"
+.LC1:
+	.string	"Found initrd at [%p,%p)\n"
+.LC2:
+	.string	"Placing initrd at [%p,%p)\n"
+.LC3:
+	.string	"FATAL: Could not load bootmgr.exe\n"
+.LC4:
+	.string	"Placing initrd at physical [%#llx,%#llx)\n"
+.LC5:
+	.string	"Entering bootmgr.exe with parameters at %p\n"
+.LC6:
+	.string	"FATAL: bootmgr.exe returned\n"
+	.section	.text.startup,"ax",@progbits
+	.globl	main
+	.hidden	main
+	.type	main, @function
+main:
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$80, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 72(%rsp)
+	xorl	%eax, %eax
+	leaq	48(%rsp), %rbp
+	call	init_cookie
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	cmdline(%rip), %rdi
+	call	process_cmdline
+	call	biosdisk_init
+	call	biosdisk_iterate
+	call	init_paging
+	movq	%rbp, %rdi
+	call	enable_paging
+	movq	initrd(%rip), %rsi
+	movq	initrd_len(%rip), %rdx
+	xorl	%eax, %eax
+	leaq	.LC1(%rip), %rdi
+	addq	%rsi, %rdx
+	call	printf
+	movq	initrd_len(%rip), %r12
+	movq	initrd(%rip), %rsi
+	xorl	%edi, %edi
+.L15:
+	movq	%rsi, 8(%rsp)
+	call	memmap_next
+	movq	8(%rsp), %rsi
+	testq	%rax, %rax
+	movq	%rax, %rdi
+	je	.L10
+	movq	(%rdi), %rax
+	movq	8(%rdi), %rdx
+	movl	$2147483648, %ecx
+	addq	%rax, %rdx
+	cmpq	%rcx, %rdx
+	cmova	%rcx, %rdx
+	cmpq	%r12, %rdx
+	jb	.L15
+	subq	%r12, %rdx
+	movq	%rdx, %rbx
+	andq	$-4096, %rbx
+	cmpq	$1048575, %rbx
+	jbe	.L15
+	cmpq	%rax, %rbx
+	jb	.L15
+	movq	%r12, %rdx
+	movq	%rbx, %rdi
+	call	memmove
+	movq	%rbx, %rsi
+.L10:
+	movq	initrd_len(%rip), %rdx
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	movq	%rsi, initrd(%rip)
+	addq	%rsi, %rdx
+	call	printf
+	movq	initrd_len(%rip), %rsi
+	movq	initrd(%rip), %rdi
+	call	extract_initrd
+	call	initialise_int13
+	leaq	24(%rsp), %rdx
+	movl	%eax, 8+callback(%rip)
+	movq	nt_cmdline(%rip), %rax
+	movq	1904(%rax), %rdi
+	movl	1912(%rax), %esi
+	call	load_pe
+	leaq	.LC3(%rip), %rdi
+	testl	%eax, %eax
+	jne	.L17
+	movq	initrd_len(%rip), %rsi
+	movq	initrd(%rip), %rdi
+	call	relocate_memory_high
+	movq	initrd_len(%rip), %rdx
+	leaq	.LC4(%rip), %rdi
+	movq	%rax, %rsi
+	movq	%rax, %rbx
+	addq	%rax, %rdx
+	xorl	%eax, %eax
+	call	printf
+	movq	24(%rsp), %rcx
+	movq	32(%rsp), %rsi
+	leaq	_start(%rip), %rdx
+	shrq	$12, %rdx
+	movl	%edx, %eax
+	movq	%rcx, 24+bootapps(%rip)
+	movq	%rax, 92+bootapps(%rip)
+	leaq	4095+_end(%rip), %rax
+	shrq	$12, %rax
+	movl	%esi, 36+bootapps(%rip)
+	subl	%edx, %eax
+	movq	%rcx, %rdx
+	shrq	$12, %rdx
+	movq	%rax, 108+bootapps(%rip)
+	movl	%edx, %eax
+	movq	%rax, 132+bootapps(%rip)
+	leaq	4095(%rcx,%rsi), %rax
+	shrq	$12, %rax
+	subl	%edx, %eax
+	movq	initrd(%rip), %rdx
+	movq	%rax, 148+bootapps(%rip)
+	movq	%rbx, %rax
+	shrq	$12, %rax
+	movq	%rax, 172+bootapps(%rip)
+	movq	initrd_len(%rip), %rax
+	addq	%rdx, %rax
+	shrq	$12, %rdx
+	addq	$4095, %rax
+	shrq	$12, %rax
+	subl	%edx, %eax
+	movq	%rax, 188+bootapps(%rip)
+	movl	$4294967295, %eax
+	cmpq	%rbx, %rax
+	jnb	.L13
+	decl	72+bootapps(%rip)
+.L13:
+	movq	%rbp, %rdi
+	leaq	bootapps(%rip), %rbx
+	call	disable_paging
+	movq	%rbx, %rsi
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	%rbx, %rdi
+	call	*40(%rsp)
+	leaq	.LC6(%rip), %rdi
+.L17:
+	xorl	%eax, %eax
+	call	die
+	.size	main, .-main
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	bootapps, @object
+	.size	bootapps, 468
+bootapps:
+	.ascii	"BOOT APP"
+	.long	2
+	.long	468
+	.long	332
+	.zero	20
+	.long	64
+	.long	204
+	.long	358
+	.long	428
+	.long	440
+	.zero	4
+	.long	1
+	.long	20
+	.long	3
+	.long	40
+	.long	8
+	.zero	120
+	.string	"BTAPENT"
+	.long	33
+	.zero	32
+	.long	285212673
+	.long	24
+	.long	86
+	.zero	12
+	.zero	16
+	.long	6
+	.zero	4
+	.long	70
+	.zero	4
+	.long	65536
+	.zero	16
+	.long	1
+	.long	340985129
+	.zero	26
+	.long	6
+	.zero	4
+	.long	70
+	.zero	4
+	.long	65536
+	.zero	16
+	.long	1
+	.long	340985129
+	.zero	26
+	.quad	callback
+	.zero	4
+	.long	1
+	.zero	24
+	.align 8
+	.type	callback, @object
+	.size	callback, 12
+callback:
+	.quad	callback_fns
+	.zero	4
+	.align 16
+	.type	callback_fns, @object
+	.size	callback_fns, 16
+callback_fns:
+	.quad	call_interrupt_wrapper
+	.quad	call_real
+	.hidden	initrd_len
+	.globl	initrd_len
+	.bss
+	.align 8
+	.type	initrd_len, @object
+	.size	initrd_len, 8
+initrd_len:
+	.zero	8
+	.hidden	initrd
+	.globl	initrd
+	.align 8
+	.type	initrd, @object
+	.size	initrd, 8
+initrd:
+	.zero	8
+	.hidden	cmdline
+	.globl	cmdline
+	.align 8
+	.type	cmdline, @object
+	.size	cmdline, 8
+cmdline:
+	.zero	8
+	.hidden	die
+	.hidden	_end
+	.hidden	_start
+	.hidden	relocate_memory_high
+	.hidden	load_pe
+	.hidden	initialise_int13
+	.hidden	extract_initrd
+	.hidden	memmove
+	.hidden	memmap_next
+	.hidden	init_paging
+	.hidden	biosdisk_iterate
+	.hidden	biosdisk_init
+	.hidden	process_cmdline
+	.hidden	printf
+	.hidden	init_cookie
+	.hidden	nt_cmdline
+	.hidden	disable_paging
+	.hidden	emulate_int13
+	.hidden	enable_paging
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,251 @@
+	.file	"paging.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"(vaddr & (PAGE_SIZE_2MB - 1)) == 0"
+.LC1:
+	.string	"kern/paging.c"
+.LC2:
+	.string	"Assertion failed at %s line %d: %s\n"
+	.text
+	.type	map_page, @function
+map_page:
+	testl	$2097151, %edi
+	je	.L2
+	pushq	%rax
+	leaq	.LC0(%rip), %rcx
+	xorl	%eax, %eax
+	movl	$81, %edx
+	leaq	.LC1(%rip), %rsi
+	leaq	.LC2(%rip), %rdi
+	call	die
+.L2:
+	movl	%edi, %eax
+	orb	$-121, %sil
+	shrl	$21, %edi
+	leaq	pd(%rip), %rdx
+	movq	%rsi, (%rdx,%rdi,8)
+#APP
+# 89 "kern/paging.c" 1
+	invlpg (%rax)
+# 0 "" 2
+#NO_APP
+	ret
+	.size	map_page, .-map_page
+	.section	.rodata.str1.1
+.LC3:
+	.string	"Paging not possible on this CPU\n"
+	.text
+	.globl	init_paging
+	.hidden	init_paging
+	.type	init_paging, @function
+init_paging:
+	pushq	%rbx
+	movl	$1, %eax
+#APP
+# 62 "kern/paging.c" 1
+	cpuid
+# 0 "" 2
+#NO_APP
+	andb	$64, %dl
+	movl	$2048, %ebx
+	jne	.L8
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	popq	%rbx
+	jmp	printf
+.L8:
+	imull	$-2097152, %ebx, %esi
+	movq	%rsi, %rdi
+	call	map_page
+	decl	%ebx
+	jne	.L8
+	leaq	pd(%rip), %rax
+	popq	%rbx
+	movl	$1, paging(%rip)
+	orl	$1, %eax
+	movq	%rax, pdpt(%rip)
+	leaq	4096+pd(%rip), %rax
+	orl	$1, %eax
+	movq	%rax, 8+pdpt(%rip)
+	leaq	8192+pd(%rip), %rax
+	orl	$1, %eax
+	movq	%rax, 16+pdpt(%rip)
+	leaq	12288+pd(%rip), %rax
+	orl	$1, %eax
+	movq	%rax, 24+pdpt(%rip)
+	ret
+	.size	init_paging, .-init_paging
+	.globl	enable_paging
+	.hidden	enable_paging
+	.type	enable_paging, @function
+enable_paging:
+	cmpl	$0, paging(%rip)
+	je	.L14
+#APP
+# 143 "kern/paging.c" 1
+	mov %cr0, %rax
+	mov %cr3, %rcx
+	mov %cr4, %rdx
+	
+# 0 "" 2
+#NO_APP
+	movq	%rcx, 8(%rdi)
+	movq	%rax, %rcx
+	movq	%rax, (%rdi)
+	andl	$2147483647, %ecx
+	movq	%rdx, 16(%rdi)
+#APP
+# 152 "kern/paging.c" 1
+	mov %rcx, %cr0
+# 0 "" 2
+#NO_APP
+	orq	$32, %rdx
+#APP
+# 155 "kern/paging.c" 1
+	mov %rdx, %cr4
+# 0 "" 2
+#NO_APP
+	leaq	pdpt(%rip), %rdx
+#APP
+# 158 "kern/paging.c" 1
+	mov %rdx, %cr3
+# 0 "" 2
+#NO_APP
+	btsq	$31, %rax
+#APP
+# 161 "kern/paging.c" 1
+	mov %rax, %cr0
+# 0 "" 2
+#NO_APP
+.L14:
+	ret
+	.size	enable_paging, .-enable_paging
+	.globl	disable_paging
+	.hidden	disable_paging
+	.type	disable_paging, @function
+disable_paging:
+	cmpl	$0, paging(%rip)
+	je	.L16
+	movq	(%rdi), %rax
+	movq	%rax, %rdx
+	andl	$2147483647, %edx
+#APP
+# 180 "kern/paging.c" 1
+	mov %rdx, %cr0
+# 0 "" 2
+#NO_APP
+	movq	8(%rdi), %rdx
+	movq	16(%rdi), %rcx
+#APP
+# 183 "kern/paging.c" 1
+	mov %rcx, %cr4
+	mov %rdx, %cr3
+	mov %rax, %cr0
+	
+# 0 "" 2
+#NO_APP
+.L16:
+	ret
+	.size	disable_paging, .-disable_paging
+	.globl	relocate_memory_high
+	.hidden	relocate_memory_high
+	.type	relocate_memory_high, @function
+relocate_memory_high:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	movq	%rdi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$24, %rsp
+	cmpl	$0, paging(%rip)
+	je	.L18
+	movq	%rdi, %rbp
+	leaq	(%rdi,%rsi), %r14
+	movq	%rsi, %r15
+	xorl	%edi, %edi
+	movl	$4294967295, %r13d
+.L25:
+	call	memmap_next
+	movq	%rax, %rdi
+	testq	%rax, %rax
+	je	.L18
+	movq	(%rdi), %rax
+	movq	8(%rdi), %rbx
+	addq	%rax, %rbx
+	cmpq	%rbx, %r13
+	jnb	.L25
+	subq	%r14, %rbx
+	andq	$-2097152, %rbx
+	addq	%rbp, %rbx
+	cmpq	%rbx, %r13
+	jnb	.L25
+	cmpq	%rax, %rbx
+	jb	.L25
+	movq	%rbx, %r14
+.L21:
+	testq	%r15, %r15
+	je	.L27
+	movq	%rbp, %r13
+	movl	$2097152, %r12d
+	movq	%r14, %rax
+	movl	$2097152, %edi
+	andl	$2097151, %r13d
+	subq	%r13, %r12
+	cmpq	%r15, %r12
+	cmova	%r15, %r12
+	andq	$-2097152, %rax
+	movq	%rax, %rsi
+	movq	%rax, 8(%rsp)
+	call	map_page
+	movq	%rbp, %rsi
+	movq	%r12, %rdx
+	addq	%r12, %r14
+	leaq	2097152(%r13), %rdi
+	subq	%r12, %r15
+	call	memcpy
+	movl	%ebp, %edi
+	movq	8(%rsp), %rsi
+	addq	%r12, %rbp
+	subl	%r13d, %edi
+	call	map_page
+	jmp	.L21
+.L27:
+	movq	$2097287, 8+pd(%rip)
+#APP
+# 89 "kern/paging.c" 1
+	invlpg 2097152
+# 0 "" 2
+#NO_APP
+	movq	%rbx, %r12
+.L18:
+	addq	$24, %rsp
+	movq	%r12, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	relocate_memory_high, .-relocate_memory_high
+	.local	pd
+	.comm	pd,16384,4096
+	.local	pdpt
+	.comm	pdpt,32,4096
+	.hidden	paging
+	.globl	paging
+	.bss
+	.align 4
+	.type	paging, @object
+	.size	paging, 4
+paging:
+	.zero	4
+	.hidden	memcpy
+	.hidden	memmap_next
+	.hidden	printf
+	.hidden	die
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -29,6 +29,8 @@
 #include "bcd.h"
 #include "cmdline.h"
 #include "efi.h"
+#include "diskfile.h"
+#include "lzfile.h"
 
 #ifdef __x86_64__
 extern unsigned char
@@ -56,6 +58,61 @@ static void read_mem_file (struct vdisk_file *file, void *data,
     memcpy (data, (file->opaque + offset), len);
 }
 
+/**
+ * Read virtual file from block-compressed memory
+ *
+ * @v file		Virtual file
+ * @v data		Data buffer
+ * @v offset		Offset
+ * @v len		Length
+ */
+static void read_lz_file (struct vdisk_file *file, void *data,
+                          size_t offset, size_t len)
+{
+    if (lzfile_pread (file->opaque, data, offset, len) != 0)
+        die ("FATAL: could not decompress %s\n", file->name);
+}
+
+/**
+ * Read virtual file from physical partition
+ *
+ * @v file		Virtual file
+ * @v data		Data buffer
+ * @v offset		Offset
+ * @v len		Length
+ */
+static void read_disk_file (struct vdisk_file *file, void *data,
+                            size_t offset, size_t len)
+{
+    if (diskfile_pread (file->opaque, data, offset, len) != 0)
+        die ("FATAL: could not read %s from disk\n", file->name);
+}
+
+/**
+ * Add files from physical partition
+ *
+ */
+static void add_disk_files (void)
+{
+    struct diskfile *file;
+    const char *path;
+    const char *name;
+    unsigned int i;
+
+    for (i = 0 ; i < nt_cmdline->num_diskfiles ; i++)
+    {
+        path = nt_cmdline->diskfiles[i];
+        name = strrchr (path, '\\');
+        name = (name ? (name + 1) : path);
+        file = diskfile_open (path);
+        if (! file)
+            die ("FATAL: could not open %s on disk\n", path);
+        if ((file->len / VDISK_SECTOR_SIZE) >= VDISK_FILE_COUNT)
+            die ("FATAL: %s is too large\n", path);
+        vdisk_add_file (name, file, file->len, read_disk_file);
+    }
+}
+
 /**
  * Get architecture-specific boot filename
  *
@@ -86,15 +143,23 @@ static const CHAR16 *efi_bootarch (void)
 static int add_file (const char *name, void *data, size_t len)
 {
     char bootarch[32];
+    size_t file_len;
+    int compressed;
 
     snprintf (bootarch, sizeof (bootarch), "%ls", efi_bootarch());
 
-    vdisk_add_file (name, data, len, read_mem_file);
+    compressed = (lzfile_check (data, len, &file_len) == 0);
+    if (compressed)
+        vdisk_add_file (name, data, file_len, read_lz_file);
+    else
+        vdisk_add_file (name, data, len, read_mem_file);
 
     /* Check for special-case files */
     if ((efi_systab && strcasecmp (name, bootarch) == 0) ||
         (!efi_systab && strcasecmp (name, "bootmgr.exe") == 0))
     {
+        if (compressed)
+            die ("FATAL: bootmgr file %s is compressed\n", name);
         DBG ("...found bootmgr file %s\n", name);
         nt_cmdline->bootmgr_length = len;
         nt_cmdline->bootmgr = data;
@@ -120,8 +185,12 @@ void extract_initrd (void *ptr, size_t len)
     if (cpio_extract (ptr, len, add_file) != 0)
         die ("FATAL: could not extract initrd files\n");
 
+    add_disk_files ();
+
     if (!nt_cmdline->bootmgr)
         die ("FATAL: no bootmgr\n");
 
     bcd_patch_data ();
+
+    vdisk_finalise ();
 }
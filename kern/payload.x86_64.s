@@ -0,0 +1,313 @@
+	.file	"payload.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"%ls"
+.LC1:
+	.string	"bootmgr.exe"
+.LC2:
+	.string	"FATAL: bootmgr file %s is compressed\n"
+.LC3:
+	.string	"...found bootmgr file %s\n"
+	.text
+	.type	add_file, @function
+add_file:
+	pushq	%r14
+	leaq	bootarch_full.0(%rip), %rcx
+	pushq	%r13
+	pushq	%r12
+	movq	%rdx, %r12
+	pushq	%rbp
+	movq	%rsi, %rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	subq	$48, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	xorl	%eax, %eax
+	movq	%rcx, %rax
+.L2:
+	movw	(%rax), %dx
+	testw	%dx, %dx
+	je	.L24
+	addq	$2, %rax
+	cmpw	$92, %dx
+	cmove	%rax, %rcx
+	jmp	.L2
+.L24:
+	leaq	8(%rsp), %r14
+	leaq	.LC0(%rip), %rdx
+	movl	$32, %esi
+	xorl	%eax, %eax
+	movq	%r14, %rdi
+	call	snprintf
+	movq	%rsp, %rdx
+	movq	%r12, %rsi
+	movq	%rbp, %rdi
+	call	lzfile_check
+	movq	(%rsp), %rdx
+	leaq	read_lz_file(%rip), %rcx
+	movl	%eax, %r13d
+	testl	%eax, %eax
+	je	.L22
+	leaq	read_mem_file(%rip), %rcx
+	movq	%r12, %rdx
+.L22:
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	call	vdisk_add_file
+	cmpq	$0, efi_systab(%rip)
+	jne	.L7
+.L13:
+	leaq	.LC1(%rip), %rsi
+	movq	%rbx, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	je	.L8
+	jmp	.L14
+.L7:
+	movq	%r14, %rsi
+	movq	%rbx, %rdi
+	call	strcasecmp
+	testl	%eax, %eax
+	jne	.L10
+.L8:
+	testl	%r13d, %r13d
+	jne	.L20
+	movq	%rbx, %rsi
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L10:
+	cmpq	$0, efi_systab(%rip)
+	jne	.L14
+	jmp	.L13
+.L20:
+	movq	%rbx, %rsi
+	leaq	.LC3(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movq	nt_cmdline(%rip), %rax
+	movl	%r12d, 1912(%rax)
+	movq	%rbp, 1904(%rax)
+.L14:
+	movq	40(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L15
+	call	__stack_chk_fail@PLT
+.L15:
+	addq	$48, %rsp
+	xorl	%eax, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	add_file, .-add_file
+	.type	read_mem_file, @function
+read_mem_file:
+	movq	%rdi, %rax
+	movq	%rsi, %rdi
+	addq	32(%rax), %rdx
+	movq	%rdx, %rsi
+	movq	%rcx, %rdx
+	jmp	memcpy
+	.size	read_mem_file, .-read_mem_file
+	.section	.rodata.str1.1
+.LC4:
+	.string	"FATAL: could not decompress %s\n"
+	.text
+	.type	read_lz_file, @function
+read_lz_file:
+	pushq	%rbx
+	movq	%rdi, %rbx
+	movq	32(%rdi), %rdi
+	call	lzfile_pread
+	testl	%eax, %eax
+	je	.L26
+	movq	%rbx, %rsi
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L26:
+	popq	%rbx
+	ret
+	.size	read_lz_file, .-read_lz_file
+	.section	.rodata.str1.1
+.LC5:
+	.string	"FATAL: could not read %s from disk\n"
+	.text
+	.type	read_disk_file, @function
+read_disk_file:
+	pushq	%rbx
+	movq	%rdi, %rbx
+	movq	32(%rdi), %rdi
+	call	diskfile_pread
+	testl	%eax, %eax
+	je	.L29
+	movq	%rbx, %rsi
+	leaq	.LC5(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L29:
+	popq	%rbx
+	ret
+	.size	read_disk_file, .-read_disk_file
+	.section	.rodata.str1.1
+.LC6:
+	.string	"...load BCD @%p %c%c%c%c [%x]\n"
+.LC7:
+	.string	"BCD"
+.LC8:
+	.string	"FATAL: could not extract initrd files\n"
+.LC9:
+	.string	"FATAL: could not open %s on disk\n"
+.LC10:
+	.string	"FATAL: %s is too large\n"
+.LC11:
+	.string	"FATAL: no bootmgr\n"
+	.text
+	.globl	extract_initrd
+	.hidden	extract_initrd
+	.type	extract_initrd, @function
+extract_initrd:
+	pushq	%r13
+	pushq	%r12
+	leaq	__i386_bcd_raw(%rip), %r12
+	pushq	%rbp
+	movq	%rsi, %rbp
+	movq	%r12, %rsi
+	pushq	%rbx
+	movq	%rdi, %rbx
+	leaq	.LC6(%rip), %rdi
+	subq	$16, %rsp
+	movq	nt_cmdline(%rip), %rdx
+	movl	__i386_bcd_raw_len(%rip), %eax
+	movq	%r12, 1888(%rdx)
+	movl	%eax, 1896(%rdx)
+	movzbl	3+__i386_bcd_raw(%rip), %r9d
+	movzbl	2+__i386_bcd_raw(%rip), %r8d
+	movzbl	1+__i386_bcd_raw(%rip), %ecx
+	pushq	%rax
+	xorl	%eax, %eax
+	movzbl	__i386_bcd_raw(%rip), %edx
+	call	printf
+	movl	__i386_bcd_raw_len(%rip), %edx
+	movq	%r12, %rsi
+	leaq	read_mem_file(%rip), %rcx
+	leaq	.LC7(%rip), %rdi
+	call	vdisk_add_file
+	movq	%rbp, %rsi
+	movq	%rbx, %rdi
+	leaq	add_file(%rip), %rdx
+	call	cpio_extract
+	popq	%rcx
+	leaq	.LC8(%rip), %rdi
+	popq	%rsi
+	testl	%eax, %eax
+	jne	.L44
+	xorl	%ebp, %ebp
+	movl	$4294967295, %r13d
+.L33:
+	movq	nt_cmdline(%rip), %rax
+	cmpl	1880(%rax), %ebp
+	jnb	.L46
+	movl	%ebp, %edx
+	movl	$92, %esi
+	salq	$8, %rdx
+	leaq	854(%rax,%rdx), %rbx
+	movq	%rbx, %rdi
+	movq	%rbx, %r12
+	call	strrchr
+	testq	%rax, %rax
+	je	.L34
+	leaq	1(%rax), %r12
+.L34:
+	movq	%rbx, %rdi
+	call	diskfile_open
+	movq	%rax, %rsi
+	testq	%rax, %rax
+	jne	.L35
+	movq	%rbx, %rsi
+	leaq	.LC9(%rip), %rdi
+	jmp	.L45
+.L35:
+	movq	(%rax), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L36
+	movq	%rbx, %rsi
+	leaq	.LC10(%rip), %rdi
+.L45:
+	xorl	%eax, %eax
+	call	die
+.L36:
+	leaq	read_disk_file(%rip), %rcx
+	movq	%r12, %rdi
+	incl	%ebp
+	call	vdisk_add_file
+	jmp	.L33
+.L46:
+	cmpq	$0, 1904(%rax)
+	jne	.L38
+	leaq	.LC11(%rip), %rdi
+.L44:
+	xorl	%eax, %eax
+	call	die
+.L38:
+	call	bcd_patch_data
+	popq	%rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	jmp	vdisk_finalise
+	.size	extract_initrd, .-extract_initrd
+	.section	.rodata
+	.align 32
+	.type	bootarch_full.0, @object
+	.size	bootarch_full.0, 44
+bootarch_full.0:
+	.string	"\\"
+	.string	"E"
+	.string	"F"
+	.string	"I"
+	.string	"\\"
+	.string	"B"
+	.string	"O"
+	.string	"O"
+	.string	"T"
+	.string	"\\"
+	.string	"B"
+	.string	"O"
+	.string	"O"
+	.string	"T"
+	.string	"X"
+	.string	"6"
+	.string	"4"
+	.string	"."
+	.string	"E"
+	.string	"F"
+	.string	"I"
+	.string	""
+	.string	""
+	.hidden	vdisk_finalise
+	.hidden	bcd_patch_data
+	.hidden	diskfile_open
+	.hidden	strrchr
+	.hidden	cpio_extract
+	.hidden	__i386_bcd_raw_len
+	.hidden	__i386_bcd_raw
+	.hidden	diskfile_pread
+	.hidden	lzfile_pread
+	.hidden	memcpy
+	.hidden	nt_cmdline
+	.hidden	printf
+	.hidden	die
+	.hidden	strcasecmp
+	.hidden	efi_systab
+	.hidden	vdisk_add_file
+	.hidden	lzfile_check
+	.hidden	snprintf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,114 @@
+# 0 "kern/startup.S"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "include/compiler.h" 1
+# 0 "<command-line>" 2
+# 1 "kern/startup.S"
+# 27 "kern/startup.S"
+# 1 "include/ntloader.h" 1
+# 28 "kern/startup.S" 2
+
+
+
+
+
+
+ .section ".note.GNU-stack", "", @progbits
+
+
+
+ .code32
+ .arch i386
+
+
+ .section ".text", "ax", @progbits
+ .globl startup
+startup:
+
+ lgdt gdtr
+ lidt idtr
+ ljmp $0x20, $1f
+1: movw $0x30, %ax
+ movw %ax, %ds
+ movw %ax, %es
+ movw %ax, %fs
+ movw %ax, %gs
+ movw %ax, %ss
+ movl $_estack, %esp
+
+
+ call main
+
+
+ jmp reboot
+ .size startup, . - startup
+
+
+ .section ".text", "ax", @progbits
+ .globl reboot
+reboot:
+
+ movw $0x1234, 0x0472
+ movb $0xfe, %al
+ outb %al, $0x64
+
+ int $0xff
+
+1: hlt
+ jmp 1b
+ .size reboot, . - reboot
+
+
+ .section ".rodata16", "aw", @progbits
+ .balign 8
+gdt:
+ .globl gdtr
+gdtr:
+ .word gdt_limit
+ .long gdt
+
+ .org ( gdt + 0x10 )
+ .word 0, 0
+ .byte 0, 0x9b, 0x20, 0
+
+ .org ( gdt + 0x20 )
+ .word 0xffff, 0
+ .byte 0, 0x9f, 0xcf, 0
+
+ .org ( gdt + 0x30 )
+ .word 0xffff, 0
+ .byte 0, 0x93, 0xcf, 0
+
+ .org ( gdt + 0x50 )
+ .word 0xffff, ( (0x2000 << 4) & 0xffff )
+ .byte ( (0x2000 << 4) >> 16 ), 0x9b, 0x8f, 0
+
+ .org ( gdt + 0x60 )
+ .word 0xffff, ( (0x2000 << 4) & 0xffff )
+ .byte ( (0x2000 << 4) >> 16 ), 0x93, 0x8f, 0
+ .size gdt, . - gdt
+ .equ gdt_limit, . - gdt - 1
+
+
+ .section ".bss16", "aw", @nobits
+ .balign 8
+idt:
+ .space ( 256 * 8 )
+ .size idt, . - idt
+ .equ idt_limit, . - idt - 1
+
+
+ .section ".rodata16", "aw", @progbits
+ .globl idtr
+idtr:
+ .word idt_limit
+ .long idt
+ .size idtr, . - idtr
+
+
+ .section ".stack", "aw", @nobits
+ .balign 8
+_stack:
+ .space ( 64 * 1024 )
+ .size _stack, . - _stack
+_estack:
@@ -0,0 +1,289 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Virtual disk read tracing
+ *
+ * Records are collected in a fixed-size buffer and written out as
+ * text lines whenever the buffer fills, when bootmgr exits boot
+ * services, and on fatal errors.  The lines can be fed to the
+ * vtrace host tool.
+ *
+ */
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "ntloader.h"
+#include "cmdline.h"
+#include "vdisk.h"
+#include "efi.h"
+#include "trace.h"
+#include "efi/Protocol/SimpleFileSystem.h"
+
+#ifdef VDISK_TRACE
+
+/** A trace record */
+struct trace_entry
+{
+    /** Starting timestamp */
+    uint64_t start;
+    /** Starting LBA */
+    uint64_t lba;
+    /** Region or file name (or NULL) */
+    const char *name;
+    /** Starting sector within region or file */
+    uint32_t offset;
+    /** Elapsed timestamp ticks */
+    uint32_t ticks;
+    /** Number of sectors */
+    uint32_t count;
+    /** Record kind */
+    uint8_t kind;
+};
+
+/** Trace records */
+static struct trace_entry trace_entries[VDISK_TRACE];
+
+/** Number of trace records */
+static unsigned int trace_count;
+
+/** Trace is being written out */
+static int trace_flushing;
+
+/** Trace header has been written */
+static int trace_started;
+
+/** Trace output buffer */
+static char trace_buf[512];
+
+/** Used length of trace output buffer */
+static size_t trace_buf_len;
+
+/** Trace file (UEFI only) */
+static EFI_FILE_PROTOCOL *trace_file;
+
+/**
+ * Open trace file
+ *
+ * @ret file		Trace file, or NULL on error
+ */
+static EFI_FILE_PROTOCOL *trace_open (void)
+{
+    EFI_BOOT_SERVICES *bs = efi_systab->BootServices;
+    union
+    {
+        EFI_LOADED_IMAGE_PROTOCOL *image;
+        void *intf;
+    } loaded;
+    union
+    {
+        EFI_SIMPLE_FILE_SYSTEM_PROTOCOL *fs;
+        void *intf;
+    } sfs;
+    EFI_FILE_PROTOCOL *root;
+    EFI_FILE_PROTOCOL *file;
+    UINT64 mode = (EFI_FILE_MODE_READ | EFI_FILE_MODE_WRITE |
+                   EFI_FILE_MODE_CREATE);
+
+    if ((bs->HandleProtocol (efi_image_handle,
+                             &efi_loaded_image_protocol_guid,
+                             &loaded.intf) != 0) ||
+        (bs->HandleProtocol (loaded.image->DeviceHandle,
+                             &efi_simple_file_system_protocol_guid,
+                             &sfs.intf) != 0) ||
+        (sfs.fs->OpenVolume (sfs.fs, &root) != 0))
+        return NULL;
+    if (root->Open (root, &file, TRACE_FILE_NAME, mode, 0) != 0)
+        file = NULL;
+
+    /* Start a fresh file for each boot */
+    if (file && (! trace_started))
+    {
+        file->Delete (file);
+        if (root->Open (root, &file, TRACE_FILE_NAME, mode, 0) != 0)
+            file = NULL;
+    }
+    root->Close (root);
+    if (file)
+        file->SetPosition (file, 0xFFFFFFFFFFFFFFFFULL);
+    return file;
+}
+
+/**
+ * Write out trace output buffer
+ *
+ */
+static void trace_drain (void)
+{
+    UINTN len = trace_buf_len;
+    size_t i;
+
+    if (trace_file)
+    {
+        trace_file->Write (trace_file, &len, trace_buf);
+    }
+    else if (nt_cmdline->trace == TRACE_SINK_CONSOLE)
+    {
+        printf ("%s", trace_buf);
+    }
+    else
+    {
+        for (i = 0 ; i < trace_buf_len ; i++)
+        {
+#if defined(__i386__) || defined(__x86_64__)
+            __asm__ __volatile__ ("outb %b0, $0xe9"
+                                   : : "a" (trace_buf[i]));
+#else
+            putchar (trace_buf[i]);
+#endif
+        }
+    }
+    trace_buf_len = 0;
+    trace_buf[0] = '\0';
+}
+
+/**
+ * Write trace line
+ *
+ * @v fmt		Format string
+ * @v ...		Arguments
+ */
+static void __attribute__ ((format (printf, 1, 2)))
+trace_printf (const char *fmt, ...)
+{
+    char line[160];
+    va_list args;
+    size_t len;
+
+    va_start (args, fmt);
+    len = vsnprintf (line, sizeof (line), fmt, args);
+    va_end (args);
+    if (len >= sizeof (line))
+        len = (sizeof (line) - 1);
+
+    if ((trace_buf_len + len) >= sizeof (trace_buf))
+        trace_drain ();
+    memcpy ((trace_buf + trace_buf_len), line, (len + 1));
+    trace_buf_len += len;
+}
+
+/**
+ * Write trace header
+ *
+ */
+static void trace_header (void)
+{
+    EFI_BOOT_SERVICES *bs;
+    struct vdisk_file *file;
+    uint64_t start;
+    unsigned int i;
+
+    /* Calibrate timestamp counter, where a timer is available */
+    if (efi_systab)
+    {
+        bs = efi_systab->BootServices;
+        start = trace_timestamp ();
+        bs->Stall (10000);
+        trace_printf (TRACE_PREFIX " H %llu\n",
+                      ((trace_timestamp () - start) * 100));
+    }
+
+    /* Describe files */
+    for (i = 0 ; (file = vdisk_get_file (i)) != NULL ; i++)
+    {
+        trace_printf (TRACE_PREFIX " L %#zx %s\n",
+                      ((size_t) file->xlen), file->name);
+    }
+}
+
+/**
+ * Write out and discard trace records
+ *
+ */
+void trace_flush (void)
+{
+    struct trace_entry *entry;
+    unsigned int i;
+
+    if (trace_flushing)
+        return;
+    trace_flushing = 1;
+
+    if (efi_systab && (nt_cmdline->trace == TRACE_SINK_FILE))
+        trace_file = trace_open ();
+    if (! trace_started)
+    {
+        trace_header ();
+        trace_started = 1;
+    }
+
+    for (i = 0 ; i < trace_count ; i++)
+    {
+        entry = &trace_entries[i];
+        trace_printf (TRACE_PREFIX " %c %llx %x %llx %x %x %s\n",
+                      entry->kind, entry->start, entry->ticks,
+                      entry->lba, entry->count, entry->offset,
+                      (entry->name ? entry->name : "-"));
+    }
+    trace_drain ();
+    trace_count = 0;
+
+    if (trace_file)
+    {
+        trace_file->Close (trace_file);
+        trace_file = NULL;
+    }
+    trace_flushing = 0;
+}
+
+/**
+ * Record virtual disk read
+ *
+ * @v kind		Record kind
+ * @v name		Region or file name (or NULL)
+ * @v lba		Starting LBA
+ * @v count		Number of sectors
+ * @v offset		Starting sector within region or file
+ * @v start		Timestamp at start of read
+ */
+void trace_record (enum trace_kind kind, const char *name, uint64_t lba,
+                   unsigned int count, uint64_t offset, uint64_t start)
+{
+    struct trace_entry *entry;
+    uint64_t ticks = (trace_timestamp () - start);
+
+    if (trace_count == VDISK_TRACE)
+        trace_flush ();
+    if (trace_flushing)
+        return;
+
+    entry = &trace_entries[trace_count++];
+    entry->start = start;
+    entry->lba = lba;
+    entry->offset = offset;
+    entry->name = name;
+    entry->ticks = ((ticks > 0xffffffffULL) ? 0xffffffffUL : ticks);
+    entry->count = count;
+    entry->kind = kind;
+}
+
+#endif /* VDISK_TRACE */
@@ -28,7 +28,11 @@
 #include "bcd.h"
 #include "cmdline.h"
 #include "charset.h"
+#ifdef NTLOADER_UTIL
+extern void *efi_systab;
+#else
 #include "efi.h"
+#endif
 
 static void
 bcd_replace_suffix (const wchar_t *src, const wchar_t *dst)
@@ -0,0 +1,1596 @@
+	.file	"bcd.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Can't find HKEY %ls\n"
+	.section	.rodata.str2.2,"aMS",@progbits,2
+	.align 2
+.LC1:
+	.string	"E"
+	.string	"l"
+	.string	"e"
+	.string	"m"
+	.string	"e"
+	.string	"n"
+	.string	"t"
+	.string	"s"
+	.string	""
+	.string	""
+	.align 2
+.LC2:
+	.string	"E"
+	.string	"l"
+	.string	"e"
+	.string	"m"
+	.string	"e"
+	.string	"n"
+	.string	"t"
+	.string	""
+	.string	""
+	.section	.rodata.str1.1
+.LC3:
+	.string	"Can't find HVAL %ls\n"
+	.text
+	.type	bcd_find_hive, @function
+bcd_find_hive:
+	pushq	%r13
+	movq	%r8, %r13
+	pushq	%r12
+	movq	%rdx, %r12
+	pushq	%rbp
+	movq	%rcx, %rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	subq	$40, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	movq	%rsp, %rcx
+	xorl	%eax, %eax
+	movq	%rax, 16(%rsp)
+	call	reg_find_key
+	testl	%eax, %eax
+	jne	.L8
+	leaq	.LC1(%rip), %r12
+	movl	(%rsp), %esi
+	leaq	4(%rsp), %rcx
+	movq	%rbx, %rdi
+	movq	%r12, %rdx
+	call	reg_find_key
+	testl	%eax, %eax
+	je	.L3
+.L8:
+	movq	%r12, %rsi
+	jmp	.L9
+.L3:
+	movl	4(%rsp), %esi
+	leaq	8(%rsp), %rcx
+	movq	%rbp, %rdx
+	movq	%rbx, %rdi
+	call	reg_find_key
+	testl	%eax, %eax
+	je	.L4
+	movq	%rbp, %rsi
+.L9:
+	leaq	.LC0(%rip), %rdi
+.L10:
+	xorl	%eax, %eax
+	call	die
+.L4:
+	movl	8(%rsp), %esi
+	movq	%rbx, %rdi
+	leaq	16(%rsp), %rcx
+	movq	%r13, %r8
+	leaq	.LC2(%rip), %rbp
+	leaq	12(%rsp), %r9
+	movq	%rbp, %rdx
+	call	reg_query_value
+	movq	%rbp, %rsi
+	leaq	.LC3(%rip), %rdi
+	testl	%eax, %eax
+	jne	.L10
+	movq	16(%rsp), %rax
+	movq	24(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L6
+	call	__stack_chk_fail@PLT
+.L6:
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	bcd_find_hive, .-bcd_find_hive
+	.section	.rodata.str1.1
+.LC4:
+	.string	"Invalid u64 size %x\n"
+.LC5:
+	.string	"...patched %ls->%ls (%llx)\n"
+	.text
+	.type	bcd_patch_u64, @function
+bcd_patch_u64:
+	pushq	%rbp
+	movq	%rcx, %rbp
+	pushq	%rbx
+	movq	%rdx, %rbx
+	subq	$40, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	movq	%r8, 8(%rsp)
+	leaq	20(%rsp), %r8
+	call	bcd_find_hive
+	movl	20(%rsp), %esi
+	cmpl	$8, %esi
+	je	.L13
+	leaq	.LC4(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L13:
+	movq	%rax, %rdi
+	leaq	8(%rsp), %rsi
+	movl	$8, %edx
+	call	memcpy
+	movq	8(%rsp), %rcx
+	xorl	%eax, %eax
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	leaq	.LC5(%rip), %rdi
+	call	printf
+	movq	24(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L14
+	call	__stack_chk_fail@PLT
+.L14:
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	bcd_patch_u64, .-bcd_patch_u64
+	.section	.rodata.str1.1
+.LC6:
+	.string	"Invalid bool size %x\n"
+.LC7:
+	.string	"...patched %ls->%ls (%c)\n"
+	.text
+	.type	bcd_patch_bool, @function
+bcd_patch_bool:
+	pushq	%rbp
+	movq	%rcx, %rbp
+	pushq	%rbx
+	movq	%rdx, %rbx
+	subq	$40, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	movb	%r8b, 12(%rsp)
+	leaq	20(%rsp), %r8
+	call	bcd_find_hive
+	movl	20(%rsp), %esi
+	cmpl	$1, %esi
+	je	.L17
+	leaq	.LC6(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L17:
+	movq	%rax, %rdi
+	leaq	12(%rsp), %rsi
+	movl	$1, %edx
+	call	memcpy
+	cmpb	$1, 12(%rsp)
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	sbbl	%ecx, %ecx
+	leaq	.LC7(%rip), %rdi
+	xorl	%eax, %eax
+	andl	$-11, %ecx
+	addl	$121, %ecx
+	call	printf
+	movq	24(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L19
+	call	__stack_chk_fail@PLT
+.L19:
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	bcd_patch_bool, .-bcd_patch_bool
+	.section	.rodata.str1.1
+.LC8:
+	.string	"Can't delete HKEY %ls\n"
+	.text
+	.type	bcd_delete_key, @function
+bcd_delete_key:
+	pushq	%r12
+	movq	%rdx, %r12
+	pushq	%rbp
+	movq	%rcx, %rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	subq	$32, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	12(%rsp), %rcx
+	call	reg_find_key
+	testl	%eax, %eax
+	jne	.L29
+	leaq	.LC1(%rip), %r12
+	movl	12(%rsp), %esi
+	leaq	16(%rsp), %rcx
+	movq	%rbx, %rdi
+	movq	%r12, %rdx
+	call	reg_find_key
+	testl	%eax, %eax
+	je	.L24
+.L29:
+	movq	%r12, %rsi
+	jmp	.L30
+.L24:
+	movl	16(%rsp), %esi
+	leaq	20(%rsp), %rcx
+	movq	%rbp, %rdx
+	movq	%rbx, %rdi
+	call	reg_find_key
+	testl	%eax, %eax
+	je	.L25
+	movq	%rbp, %rsi
+.L30:
+	leaq	.LC0(%rip), %rdi
+.L31:
+	xorl	%eax, %eax
+	call	die
+.L25:
+	movl	16(%rsp), %esi
+	movl	20(%rsp), %edx
+	movq	%rbx, %rdi
+	call	reg_delete_key
+	movq	%rbp, %rsi
+	leaq	.LC8(%rip), %rdi
+	testl	%eax, %eax
+	jne	.L31
+	movq	24(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L27
+	call	__stack_chk_fail@PLT
+.L27:
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	bcd_delete_key, .-bcd_delete_key
+	.section	.rodata.str1.1
+.LC9:
+	.string	"WIM device path (%ls->%ls) length error (%x)\n"
+.LC10:
+	.string	"VHD device path (%ls->%ls) length error (%x)\n"
+.LC11:
+	.string	"OS device path (%ls->%ls) length error (%x)\n"
+.LC12:
+	.string	"Unsupported boot type %x\n"
+.LC13:
+	.string	"...patched %ls->%ls (device%x)\n"
+	.text
+	.type	bcd_patch_dp, @function
+bcd_patch_dp:
+	pushq	%r15
+	pushq	%r14
+	movq	%r8, %r14
+	pushq	%r13
+	movq	%rcx, %r13
+	movq	%r14, %rcx
+	pushq	%r12
+	pushq	%rbp
+	movl	%edx, %ebp
+	movq	%r13, %rdx
+	pushq	%rbx
+	subq	$40, %rsp
+	movaps	.LC14(%rip), %xmm0
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	4(%rsp), %r8
+	movups	%xmm0, 8(%rsp)
+	call	bcd_find_hive
+	movl	4(%rsp), %edx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memset
+	cmpl	$3, %ebp
+	ja	.L33
+	cmpl	$1, %ebp
+	movl	4(%rsp), %ecx
+	ja	.L34
+	testl	%ebp, %ebp
+	jne	.L54
+	jmp	.L35
+.L33:
+	cmpl	$4, %ebp
+	jne	.L37
+.L35:
+	movl	4(%rsp), %ecx
+	cmpl	$649, %ecx
+	ja	.L38
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	leaq	.LC9(%rip), %rdi
+	jmp	.L56
+.L38:
+	leaq	8(%rsp), %rsi
+	movl	$16, %edx
+	movq	%rbx, %rdi
+	movl	$68, %r12d
+	call	memcpy
+	movb	$1, 20(%rbx)
+	movw	$634, 24(%rbx)
+	movb	$3, 32(%rbx)
+	movb	$1, 56(%rbx)
+	movw	$594, 60(%rbx)
+	movb	$5, 64(%rbx)
+	jmp	.L39
+.L54:
+	cmpl	$699, %ecx
+	ja	.L40
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	leaq	.LC10(%rip), %rdi
+.L56:
+	xorl	%eax, %eax
+	call	die
+.L40:
+	movb	$8, 16(%rbx)
+	movl	$118, %r12d
+	movw	$684, 24(%rbx)
+	movb	$2, 36(%rbx)
+	movw	$7698, 39(%rbx)
+	movw	$654, 54(%rbx)
+	movb	$6, 62(%rbx)
+	movw	$614, 94(%rbx)
+	movb	$5, 102(%rbx)
+	movb	$1, 106(%rbx)
+	movw	$594, 110(%rbx)
+	movb	$5, 114(%rbx)
+	jmp	.L39
+.L34:
+	movl	$16, %r12d
+	cmpl	$87, %ecx
+	ja	.L39
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	leaq	.LC11(%rip), %rdi
+	jmp	.L56
+.L37:
+	movl	%ebp, %esi
+	leaq	.LC12(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L39:
+	movq	nt_cmdline(%rip), %rax
+	movl	%r12d, %r15d
+	movl	$16, %edx
+	leaq	16(%rbx,%r15), %rdi
+	cmpb	$1, 292(%rax)
+	sbbl	%eax, %eax
+	addl	$6, %eax
+	movb	%al, (%rbx,%r15)
+	leal	8(%r12), %eax
+	addl	$36, %r12d
+	movb	$72, (%rbx,%rax)
+	movq	nt_cmdline(%rip), %rax
+	leaq	309(%rax), %rsi
+	call	memcpy
+	leaq	40(%rbx,%r15), %rdi
+	movl	$16, %edx
+	movq	nt_cmdline(%rip), %rax
+	movb	341(%rax), %al
+	movb	%al, (%rbx,%r12)
+	movq	nt_cmdline(%rip), %rax
+	leaq	325(%rax), %rsi
+	call	memcpy
+	cmpl	$1, %ebp
+	jbe	.L47
+	cmpl	$4, %ebp
+	jne	.L42
+.L47:
+	movq	nt_cmdline(%rip), %rax
+	leaq	72(%rbx,%r15), %rdi
+	movl	$255, %esi
+	leaq	342(%rax), %rdx
+	call	utf8_to_ucs2
+.L42:
+	xorl	%eax, %eax
+	movl	%ebp, %ecx
+	movq	%r14, %rdx
+	movq	%r13, %rsi
+	leaq	.LC13(%rip), %rdi
+	call	printf
+	movq	24(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L44
+	call	__stack_chk_fail@PLT
+.L44:
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	bcd_patch_dp, .-bcd_patch_dp
+	.section	.rodata.str1.1
+.LC15:
+	.string	"...patched %ls->%ls (%ls)\n"
+	.text
+	.type	bcd_patch_sz, @function
+bcd_patch_sz:
+	pushq	%r13
+	movq	%r8, %r13
+	pushq	%r12
+	movq	%rcx, %r12
+	pushq	%rbp
+	movq	%rdx, %rbp
+	pushq	%rbx
+	subq	$24, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 8(%rsp)
+	xorl	%eax, %eax
+	leaq	4(%rsp), %r8
+	call	bcd_find_hive
+	movl	4(%rsp), %edx
+	xorl	%esi, %esi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+	call	memset
+	movl	4(%rsp), %esi
+	movq	%r13, %rdx
+	movq	%rbx, %rdi
+	shrl	%esi
+	call	utf8_to_ucs2
+	xorl	%eax, %eax
+	movq	%rbx, %rcx
+	movq	%r12, %rdx
+	movq	%rbp, %rsi
+	leaq	.LC15(%rip), %rdi
+	call	printf
+	movq	8(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L58
+	call	__stack_chk_fail@PLT
+.L58:
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	bcd_patch_sz, .-bcd_patch_sz
+	.section	.rodata.str1.1
+.LC16:
+	.string	"...patched BCD at %#x (%ls->%ls)\n"
+	.text
+	.type	bcd_replace_suffix, @function
+bcd_replace_suffix:
+	pushq	%r15
+	leaq	.LC16(%rip), %r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	movq	%rsi, %r12
+	pushq	%rbp
+	movq	%rdi, %rbp
+	pushq	%rbx
+	xorl	%ebx, %ebx
+	pushq	%rdx
+	movq	nt_cmdline(%rip), %rax
+	movq	1888(%rax), %r14
+.L61:
+	movq	nt_cmdline(%rip), %rax
+	leaq	10(%rbx), %rdx
+	movl	1896(%rax), %eax
+	cmpq	%rax, %rdx
+	jnb	.L65
+	leaq	(%r14,%rbx), %r13
+	movl	$10, %edx
+	movq	%rbp, %rsi
+	movq	%r13, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L62
+	movl	$10, %edx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	memcpy
+	movq	%r12, %rcx
+	movq	%rbp, %rdx
+	movl	%ebx, %esi
+	movq	%r15, %rdi
+	xorl	%eax, %eax
+	call	printf
+.L62:
+	incq	%rbx
+	jmp	.L61
+.L65:
+	popq	%rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	bcd_replace_suffix, .-bcd_replace_suffix
+	.section	.rodata.str2.2
+	.align 2
+.LC17:
+	.string	"{"
+	.string	"9"
+	.string	"d"
+	.string	"e"
+	.string	"a"
+	.string	"8"
+	.string	"6"
+	.string	"2"
+	.string	"c"
+	.string	"-"
+	.string	"5"
+	.string	"c"
+	.string	"d"
+	.string	"d"
+	.string	"-"
+	.string	"4"
+	.string	"e"
+	.string	"7"
+	.string	"0"
+	.string	"-"
+	.string	"a"
+	.string	"c"
+	.string	"c"
+	.string	"1"
+	.string	"-"
+	.string	"f"
+	.string	"3"
+	.string	"2"
+	.string	"b"
+	.string	"3"
+	.string	"4"
+	.string	"4"
+	.string	"d"
+	.string	"4"
+	.string	"7"
+	.string	"9"
+	.string	"5"
+	.string	"}"
+	.string	""
+	.string	""
+	.section	.rodata.str1.1
+.LC18:
+	.string	"Invalid wchar size %zu\n"
+	.text
+	.type	bcd_patch_szw.constprop.0, @function
+bcd_patch_szw.constprop.0:
+	pushq	%r14
+	leaq	.LC17(%rip), %r14
+	pushq	%r13
+	movq	%rdi, %r13
+	movq	%rcx, %rdi
+	pushq	%r12
+	movq	%rdx, %r12
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rcx, %rbx
+	subq	$32, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	movl	%esi, 12(%rsp)
+	call	wcslen
+	movl	12(%rsp), %esi
+	movq	%r14, %rdx
+	movq	%r12, %rcx
+	leaq	20(%rsp), %r8
+	movq	%r13, %rdi
+	leaq	(%rax,%rax), %rbp
+	call	bcd_find_hive
+	movl	20(%rsp), %edx
+	cmpq	%rbp, %rdx
+	jnb	.L67
+	movq	%rbp, %rsi
+	leaq	.LC18(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L67:
+	xorl	%esi, %esi
+	movq	%rax, %r13
+	movq	%rax, %rdi
+	call	memset
+	movq	%rbp, %rdx
+	movq	%rbx, %rsi
+	movq	%r13, %rdi
+	call	memcpy
+	xorl	%eax, %eax
+	movq	%rbx, %rcx
+	movq	%r12, %rdx
+	movq	%r14, %rsi
+	leaq	.LC15(%rip), %rdi
+	call	printf
+	movq	24(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L68
+	call	__stack_chk_fail@PLT
+.L68:
+	addq	$32, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	bcd_patch_szw.constprop.0, .-bcd_patch_szw.constprop.0
+	.section	.rodata.str2.2
+	.align 2
+.LC19:
+	.string	"{"
+	.string	"1"
+	.string	"9"
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"8"
+	.string	"1"
+	.string	"7"
+	.string	"-"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"-"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"-"
+	.string	"a"
+	.string	"b"
+	.string	"c"
+	.string	"d"
+	.string	"-"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"1"
+	.string	"}"
+	.string	""
+	.string	""
+	.align 2
+.LC20:
+	.string	"{"
+	.string	"1"
+	.string	"9"
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"8"
+	.string	"1"
+	.string	"7"
+	.string	"-"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"-"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"-"
+	.string	"a"
+	.string	"b"
+	.string	"c"
+	.string	"d"
+	.string	"-"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"2"
+	.string	"}"
+	.string	""
+	.string	""
+	.align 2
+.LC21:
+	.string	"{"
+	.string	"1"
+	.string	"9"
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"8"
+	.string	"1"
+	.string	"7"
+	.string	"-"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"-"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"-"
+	.string	"a"
+	.string	"b"
+	.string	"c"
+	.string	"d"
+	.string	"-"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"}"
+	.string	""
+	.string	""
+	.section	.rodata.str1.1
+.LC22:
+	.string	"BCD hive load error.\n"
+	.section	.rodata.str2.2
+	.align 2
+.LC23:
+	.string	"O"
+	.string	"b"
+	.string	"j"
+	.string	"e"
+	.string	"c"
+	.string	"t"
+	.string	"s"
+	.string	""
+	.string	""
+	.section	.rodata.str1.1
+.LC24:
+	.string	"BCD hive load OK.\n"
+	.section	.rodata.str2.2
+	.align 2
+.LC25:
+	.string	"2"
+	.string	"3"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"3"
+	.string	""
+	.string	""
+	.align 2
+.LC26:
+	.string	"2"
+	.string	"4"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"1"
+	.string	""
+	.string	""
+	.align 2
+.LC27:
+	.string	"2"
+	.string	"5"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	""
+	.string	""
+	.align 2
+.LC28:
+	.string	"1"
+	.string	"1"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"1"
+	.string	""
+	.string	""
+	.align 2
+.LC29:
+	.string	"{"
+	.string	"1"
+	.string	"9"
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"8"
+	.string	"1"
+	.string	"7"
+	.string	"-"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"-"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"-"
+	.string	"a"
+	.string	"b"
+	.string	"c"
+	.string	"d"
+	.string	"-"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"3"
+	.string	"}"
+	.string	""
+	.string	""
+	.align 2
+.LC30:
+	.string	"2"
+	.string	"1"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"1"
+	.string	""
+	.string	""
+	.section	.rodata.str1.1
+.LC31:
+	.string	"\\Windows\\System32\\winresume.efi"
+	.section	.rodata.str2.2
+	.align 2
+.LC32:
+	.string	"1"
+	.string	"2"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"2"
+	.string	""
+	.string	""
+	.section	.rodata.str1.1
+.LC33:
+	.string	"\\hiberfil.sys"
+	.section	.rodata.str2.2
+	.align 2
+.LC34:
+	.string	"2"
+	.string	"2"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"2"
+	.string	""
+	.string	""
+	.align 2
+.LC35:
+	.string	"3"
+	.string	"1"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"3"
+	.string	""
+	.string	""
+	.align 2
+.LC36:
+	.string	"{"
+	.string	"a"
+	.string	"e"
+	.string	"5"
+	.string	"5"
+	.string	"3"
+	.string	"4"
+	.string	"e"
+	.string	"0"
+	.string	"-"
+	.string	"a"
+	.string	"9"
+	.string	"2"
+	.string	"4"
+	.string	"-"
+	.string	"4"
+	.string	"6"
+	.string	"6"
+	.string	"c"
+	.string	"-"
+	.string	"b"
+	.string	"8"
+	.string	"3"
+	.string	"6"
+	.string	"-"
+	.string	"7"
+	.string	"5"
+	.string	"8"
+	.string	"5"
+	.string	"3"
+	.string	"9"
+	.string	"a"
+	.string	"3"
+	.string	"e"
+	.string	"e"
+	.string	"3"
+	.string	"a"
+	.string	"}"
+	.string	""
+	.string	""
+	.align 2
+.LC37:
+	.string	"3"
+	.string	"2"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	""
+	.string	""
+	.align 2
+.LC38:
+	.string	"3"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"6"
+	.string	""
+	.string	""
+	.align 2
+.LC39:
+	.string	"3"
+	.string	"5"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"1"
+	.string	""
+	.string	""
+	.align 2
+.LC40:
+	.string	"1"
+	.string	"2"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"3"
+	.string	"0"
+	.string	""
+	.string	""
+	.align 2
+.LC41:
+	.string	"{"
+	.string	"1"
+	.string	"9"
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"8"
+	.string	"1"
+	.string	"7"
+	.string	"-"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"6"
+	.string	"-"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"8"
+	.string	"-"
+	.string	"a"
+	.string	"b"
+	.string	"c"
+	.string	"d"
+	.string	"-"
+	.string	"1"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"}"
+	.string	""
+	.string	""
+	.align 2
+.LC42:
+	.string	"1"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	"9"
+	.string	""
+	.string	""
+	.align 2
+.LC43:
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"1"
+	.string	"0"
+	.string	""
+	.string	""
+	.align 2
+.LC44:
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"2"
+	.string	"2"
+	.string	""
+	.string	""
+	.align 2
+.LC45:
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	"3"
+	.string	""
+	.string	""
+	.align 2
+.LC46:
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	"2"
+	.string	""
+	.string	""
+	.align 2
+.LC47:
+	.string	"1"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	"0"
+	.string	""
+	.string	""
+	.align 2
+.LC48:
+	.string	"1"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	"1"
+	.string	""
+	.string	""
+	.align 2
+.LC49:
+	.string	"1"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"4"
+	.string	"6"
+	.string	""
+	.string	""
+	.align 2
+.LC50:
+	.string	"2"
+	.string	"5"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"2"
+	.string	"0"
+	.string	""
+	.string	""
+	.align 2
+.LC51:
+	.string	"2"
+	.string	"5"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"2"
+	.string	"1"
+	.string	""
+	.string	""
+	.align 2
+.LC52:
+	.string	"1"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"5"
+	.string	"4"
+	.string	""
+	.string	""
+	.align 2
+.LC53:
+	.string	"1"
+	.string	"5"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"5"
+	.string	"2"
+	.string	""
+	.string	""
+	.align 2
+.LC54:
+	.string	"2"
+	.string	"5"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"8"
+	.string	"0"
+	.string	""
+	.string	""
+	.align 2
+.LC55:
+	.string	"2"
+	.string	"6"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"0"
+	.string	"8"
+	.string	"1"
+	.string	""
+	.string	""
+	.align 2
+.LC56:
+	.string	"."
+	.string	"e"
+	.string	"f"
+	.string	"i"
+	.string	""
+	.string	""
+	.align 2
+.LC57:
+	.string	"."
+	.string	"e"
+	.string	"x"
+	.string	"e"
+	.string	""
+	.string	""
+	.text
+	.globl	bcd_patch_data
+	.hidden	bcd_patch_data
+	.type	bcd_patch_data, @function
+bcd_patch_data:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$56, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	movq	nt_cmdline(%rip), %rax
+	movl	1896(%rax), %ebx
+	movq	1888(%rax), %rax
+	movq	%rax, 32(%rsp)
+	leaq	24(%rsp), %rax
+	movq	%rax, %rdi
+	movq	%rbx, 24(%rsp)
+	movq	%rax, 8(%rsp)
+	call	reg_open_hive
+	testl	%eax, %eax
+	je	.L71
+	leaq	.LC22(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L71:
+	movq	8(%rsp), %rdi
+	leaq	16(%rsp), %rsi
+	leaq	.LC23(%rip), %rbx
+	call	reg_find_root
+	movl	16(%rsp), %esi
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	leaq	20(%rsp), %rcx
+	call	reg_find_key
+	testl	%eax, %eax
+	je	.L72
+	movq	%rbx, %rsi
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L72:
+	leaq	.LC24(%rip), %rdi
+	xorl	%eax, %eax
+	leaq	.LC19(%rip), %rbp
+	call	printf
+	movq	nt_cmdline(%rip), %rax
+	movl	288(%rax), %eax
+	cmpl	$1, %eax
+	je	.L73
+	cmpl	$2, %eax
+	leaq	.LC20(%rip), %rbp
+	leaq	.LC21(%rip), %rax
+	cmovne	%rax, %rbp
+.L73:
+	movl	20(%rsp), %esi
+	movq	8(%rsp), %rdi
+	movq	%rbp, %rcx
+	leaq	.LC25(%rip), %rdx
+	leaq	.LC29(%rip), %rbx
+	leaq	.LC32(%rip), %r13
+	call	bcd_patch_szw.constprop.0
+	movl	20(%rsp), %esi
+	movq	8(%rsp), %rdi
+	movq	%rbp, %rcx
+	leaq	.LC26(%rip), %rdx
+	leaq	.LC34(%rip), %r12
+	call	bcd_patch_szw.constprop.0
+	movl	20(%rsp), %esi
+	movq	nt_cmdline(%rip), %rax
+	leaq	.LC27(%rip), %rcx
+	movq	8(%rsp), %rdi
+	leaq	.LC17(%rip), %rdx
+	leaq	.LC38(%rip), %r15
+	movq	32(%rax), %r8
+	leaq	.LC39(%rip), %r14
+	call	bcd_patch_u64
+	movl	20(%rsp), %esi
+	movq	%rbx, %rcx
+	movq	8(%rsp), %rdi
+	leaq	.LC28(%rip), %r8
+	movl	$3, %edx
+	call	bcd_patch_dp
+	movl	20(%rsp), %esi
+	movq	%rbx, %rcx
+	movq	8(%rsp), %rdi
+	leaq	.LC30(%rip), %r8
+	movl	$3, %edx
+	call	bcd_patch_dp
+	movl	20(%rsp), %esi
+	movq	%rbx, %rdx
+	movq	%r13, %rcx
+	movq	8(%rsp), %rdi
+	leaq	.LC31(%rip), %r8
+	call	bcd_patch_sz
+	movl	20(%rsp), %esi
+	movq	%rbx, %rdx
+	movq	%r12, %rcx
+	movq	8(%rsp), %rdi
+	leaq	.LC33(%rip), %r8
+	leaq	.LC36(%rip), %rbx
+	call	bcd_patch_sz
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	cmpl	$4, 288(%rax)
+	jne	.L74
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	leaq	.LC35(%rip), %rcx
+	call	bcd_delete_key
+	movl	20(%rsp), %esi
+	movq	%rbx, %rdx
+	movq	8(%rsp), %rdi
+	leaq	.LC37(%rip), %rcx
+	call	bcd_delete_key
+	movl	20(%rsp), %esi
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	movq	nt_cmdline(%rip), %rax
+	movq	8(%rsp), %rdi
+	movzbl	9(%rax), %r8d
+	call	bcd_patch_bool
+	movl	20(%rsp), %esi
+	movq	%r14, %rcx
+	movq	%rbx, %rdx
+	movq	nt_cmdline(%rip), %rax
+	movq	8(%rsp), %rdi
+	movq	56(%rax), %r8
+	call	bcd_patch_u64
+	jmp	.L75
+.L74:
+	movq	8(%rsp), %rdi
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	call	bcd_delete_key
+	movl	20(%rsp), %esi
+	movq	%r14, %rcx
+	movq	%rbx, %rdx
+	movq	8(%rsp), %rdi
+	call	bcd_delete_key
+.L75:
+	leaq	.LC41(%rip), %rbx
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC40(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	leaq	.LC52(%rip), %r14
+	leaq	.LC53(%rip), %r15
+	leaq	64(%rax), %r8
+	call	bcd_patch_sz
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC42(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	1(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC43(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	3(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC44(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	4(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC45(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	5(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC46(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	6(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC47(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	10(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC48(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	11(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC49(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movzbl	(%rax), %r8d
+	call	bcd_patch_bool
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC50(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movq	16(%rax), %r8
+	call	bcd_patch_u64
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC51(%rip), %rcx
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	movq	24(%rax), %r8
+	call	bcd_patch_u64
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	cmpb	$15, 2(%rax)
+	jne	.L76
+	movq	8(%rsp), %rdi
+	movq	%r14, %rcx
+	movq	%rbx, %rdx
+	call	bcd_delete_key
+	movl	20(%rsp), %esi
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	movq	nt_cmdline(%rip), %rax
+	movq	8(%rsp), %rdi
+	movq	48(%rax), %r8
+	call	bcd_patch_u64
+	jmp	.L77
+.L76:
+	movq	8(%rsp), %rdi
+	movq	%r15, %rcx
+	movq	%rbx, %rdx
+	call	bcd_delete_key
+	movl	20(%rsp), %esi
+	movq	%r14, %rcx
+	movq	%rbx, %rdx
+	movq	nt_cmdline(%rip), %rax
+	movq	8(%rsp), %rdi
+	movzbl	2(%rax), %r8d
+	call	bcd_patch_bool
+.L77:
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC54(%rip), %rcx
+	leaq	.LC55(%rip), %r14
+	cmpb	$0, 7(%rax)
+	je	.L78
+	movq	40(%rax), %r8
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	call	bcd_patch_u64
+	movl	20(%rsp), %esi
+	movq	%r14, %rcx
+	movq	%rbx, %rdx
+	movq	nt_cmdline(%rip), %rax
+	movq	8(%rsp), %rdi
+	movzbl	8(%rax), %r8d
+	call	bcd_patch_bool
+	jmp	.L79
+.L78:
+	movq	8(%rsp), %rdi
+	movq	%rbx, %rdx
+	call	bcd_delete_key
+	movl	20(%rsp), %esi
+	movq	%r14, %rcx
+	movq	%rbx, %rdx
+	movq	8(%rsp), %rdi
+	call	bcd_delete_key
+.L79:
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	movq	%rbp, %rcx
+	leaq	.LC28(%rip), %r8
+	movq	8(%rsp), %rdi
+	movl	288(%rax), %edx
+	call	bcd_patch_dp
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	.LC30(%rip), %r8
+	movq	8(%rsp), %rdi
+	movq	%rbp, %rcx
+	movl	288(%rax), %edx
+	call	bcd_patch_dp
+	movl	20(%rsp), %esi
+	movq	%r13, %rcx
+	movq	%rbp, %rdx
+	movq	nt_cmdline(%rip), %rax
+	movq	8(%rsp), %rdi
+	leaq	192(%rax), %r8
+	call	bcd_patch_sz
+	movq	8(%rsp), %rdi
+	movq	%r12, %rcx
+	movq	%rbp, %rdx
+	movq	nt_cmdline(%rip), %rax
+	movl	20(%rsp), %esi
+	leaq	256(%rax), %r8
+	call	bcd_patch_sz
+	cmpq	$0, efi_systab(%rip)
+	leaq	.LC56(%rip), %rdi
+	leaq	.LC57(%rip), %rax
+	je	.L80
+	movq	%rdi, %rsi
+	movq	%rax, %rdi
+	jmp	.L87
+.L80:
+	movq	%rax, %rsi
+.L87:
+	call	bcd_replace_suffix
+	movq	40(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L82
+	call	__stack_chk_fail@PLT
+.L82:
+	addq	$56, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	bcd_patch_data, .-bcd_patch_data
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC14:
+	.quad	5074616855148442848
+	.quad	4246510966104471224
+	.hidden	efi_systab
+	.hidden	reg_find_root
+	.hidden	reg_open_hive
+	.hidden	wcslen
+	.hidden	memcmp
+	.hidden	utf8_to_ucs2
+	.hidden	nt_cmdline
+	.hidden	memset
+	.hidden	reg_delete_key
+	.hidden	printf
+	.hidden	memcpy
+	.hidden	reg_query_value
+	.hidden	die
+	.hidden	reg_find_key
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
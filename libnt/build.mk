@@ -2,13 +2,14 @@
 OBJECTS += libnt/bcd.o
 OBJECTS += libnt/charset.o
 OBJECTS += libnt/cpio.o
+OBJECTS += libnt/lzfile.o
+OBJECTS += libnt/lznt1.o
 OBJECTS += libnt/reg.o
 OBJECTS += libnt/vdisk.o
 
 OBJECTS += libnt/peloader.o
 
 # OBJECTS += libnt/huffman.c
-# OBJECTS += libnt/lznt1.c
 # OBJECTS += libnt/xca.c
 
 RM_FILES += libnt/*.s libnt/*.o
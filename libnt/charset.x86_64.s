@@ -0,0 +1,123 @@
+	.file	"charset.c"
+	.text
+	.globl	utf8_to_ucs2
+	.hidden	utf8_to_ucs2
+	.type	utf8_to_ucs2, @function
+utf8_to_ucs2:
+	movq	%rsi, %r8
+	movq	%rdx, %rcx
+	movq	%rdi, %rax
+	xorl	%r9d, %r9d
+.L2:
+	movzbl	(%rcx), %edx
+	cmpq	%r8, %r9
+	jnb	.L1
+	testb	%dl, %dl
+	je	.L1
+	leaq	2(%rax), %r10
+	js	.L3
+	incq	%rcx
+	jmp	.L4
+.L3:
+	cmpb	$-33, %dl
+	ja	.L5
+	movb	1(%rcx), %sil
+	leal	-128(%rsi), %edi
+	cmpb	$63, %dil
+	ja	.L6
+	sall	$6, %edx
+	andl	$63, %esi
+	addq	$2, %rcx
+	andw	$1984, %dx
+	orl	%esi, %edx
+	jmp	.L4
+.L5:
+	cmpb	$-17, %dl
+	ja	.L7
+.L6:
+	movzbl	1(%rcx), %esi
+	movl	%esi, %edi
+	addl	$-128, %edi
+	cmpb	$63, %dil
+	ja	.L7
+	movb	2(%rcx), %dil
+	leal	-128(%rdi), %r11d
+	cmpb	$63, %r11b
+	ja	.L7
+	sall	$12, %edx
+	andl	$63, %edi
+	sall	$6, %esi
+	addq	$3, %rcx
+	orl	%edi, %edx
+	andw	$4032, %si
+	orl	%esi, %edx
+	jmp	.L4
+.L7:
+	movw	$0, (%rax)
+	movq	%r10, %rax
+	ret
+.L4:
+	movw	%dx, -2(%r10)
+	incq	%r9
+	movq	%r10, %rax
+	jmp	.L2
+.L1:
+	ret
+	.size	utf8_to_ucs2, .-utf8_to_ucs2
+	.globl	ucs2_to_utf8
+	.hidden	ucs2_to_utf8
+	.type	ucs2_to_utf8, @function
+ucs2_to_utf8:
+	movq	%rdi, %rax
+	xorl	%ecx, %ecx
+	movq	%rdx, %rdi
+.L16:
+	cmpq	%rdi, %rcx
+	je	.L23
+	movw	(%rsi,%rcx,2), %dx
+	cmpw	$127, %dx
+	ja	.L17
+	movb	%dl, (%rax)
+	incq	%rax
+	jmp	.L18
+.L17:
+	cmpw	$2047, %dx
+	ja	.L19
+	shrw	$6, %dx
+	addq	$2, %rax
+	orl	$-64, %edx
+	movb	%dl, -2(%rax)
+	movb	(%rsi,%rcx,2), %dl
+	andl	$63, %edx
+	orl	$-128, %edx
+	movb	%dl, -1(%rax)
+	jmp	.L18
+.L19:
+	leal	10240(%rdx), %r8d
+	cmpw	$2047, %r8w
+	ja	.L20
+	movb	$0, (%rax)
+	incq	%rax
+	ret
+.L20:
+	shrw	$12, %dx
+	addq	$3, %rax
+	orl	$-32, %edx
+	movb	%dl, -3(%rax)
+	movw	(%rsi,%rcx,2), %dx
+	shrw	$6, %dx
+	andl	$63, %edx
+	orl	$-128, %edx
+	movb	%dl, -2(%rax)
+	movb	(%rsi,%rcx,2), %dl
+	andl	$63, %edx
+	orl	$-128, %edx
+	movb	%dl, -1(%rax)
+.L18:
+	incq	%rcx
+	jmp	.L16
+.L23:
+	ret
+	.size	ucs2_to_utf8, .-ucs2_to_utf8
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,145 @@
+	.file	"cpio.c"
+	.text
+	.type	cpio_value, @function
+cpio_value:
+	pushq	%rbx
+	movq	%rdi, %rsi
+	movl	$8, %edx
+	subq	$32, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	15(%rsp), %rbx
+	movq	%rbx, %rdi
+	call	memcpy
+	movl	$16, %edx
+	xorl	%esi, %esi
+	movq	%rbx, %rdi
+	movb	$0, 23(%rsp)
+	call	strtoul
+	movq	24(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L2
+	call	__stack_chk_fail@PLT
+.L2:
+	addq	$32, %rsp
+	popq	%rbx
+	ret
+	.size	cpio_value, .-cpio_value
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Truncated CPIO header\n"
+.LC1:
+	.string	"070701"
+.LC2:
+	.string	"Bad CPIO magic\n"
+.LC3:
+	.string	"Truncated CPIO file\n"
+.LC4:
+	.string	"TRAILER!!!"
+	.text
+	.globl	cpio_extract
+	.hidden	cpio_extract
+	.type	cpio_extract, @function
+cpio_extract:
+	pushq	%r15
+	leaq	.LC1(%rip), %r15
+	pushq	%r14
+	pushq	%r13
+	movq	%rdx, %r13
+	pushq	%r12
+	pushq	%rbp
+	movq	%rsi, %rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	subq	$24, %rsp
+.L6:
+	cmpq	$3, %rbp
+	jbe	.L26
+	cmpl	$0, (%rbx)
+	jne	.L7
+	addq	$4, %rbx
+	subq	$4, %rbp
+	jmp	.L6
+.L26:
+	testq	%rbp, %rbp
+	jne	.L10
+	jmp	.L9
+.L7:
+	cmpq	$109, %rbp
+	ja	.L11
+.L10:
+	leaq	.LC0(%rip), %rdi
+	jmp	.L25
+.L11:
+	movl	$6, %edx
+	movq	%r15, %rsi
+	movq	%rbx, %rdi
+	call	memcmp
+	testl	%eax, %eax
+	je	.L13
+	leaq	.LC2(%rip), %rdi
+	jmp	.L25
+.L13:
+	leaq	110(%rbx), %rax
+	leaq	94(%rbx), %rdi
+	movq	%rax, (%rsp)
+	call	cpio_value
+	leaq	54(%rbx), %rdi
+	leaq	113(%rax), %r12
+	call	cpio_value
+	andq	$-4, %r12
+	addq	%rbx, %r12
+	movq	%rax, %rdx
+	leaq	(%r12,%rax), %rcx
+	subq	%rbx, %rcx
+	movq	%rcx, %r14
+	cmpq	%rbp, %rcx
+	jnb	.L14
+	leaq	3(%rcx), %rcx
+	andq	$-4, %rcx
+	movq	%rcx, %r14
+.L14:
+	cmpq	%r14, %rbp
+	jnb	.L15
+	leaq	.LC3(%rip), %rdi
+.L25:
+	xorl	%eax, %eax
+	call	printf
+	orl	$-1, %eax
+	jmp	.L5
+.L15:
+	movq	(%rsp), %rdi
+	leaq	.LC4(%rip), %rsi
+	movq	%rdx, 8(%rsp)
+	call	strcmp
+	testl	%eax, %eax
+	je	.L9
+	movq	8(%rsp), %rdx
+	movq	(%rsp), %rdi
+	movq	%r12, %rsi
+	call	*%r13
+	testl	%eax, %eax
+	jne	.L5
+	addq	%r14, %rbx
+	subq	%r14, %rbp
+	jmp	.L6
+.L9:
+	xorl	%eax, %eax
+.L5:
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	cpio_extract, .-cpio_extract
+	.hidden	strcmp
+	.hidden	printf
+	.hidden	memcmp
+	.hidden	strtoul
+	.hidden	memcpy
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
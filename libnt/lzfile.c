@@ -0,0 +1,247 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Block-compressed files
+ *
+ * Only the LZNT1 blocks touched by a read are decompressed.  Partial
+ * blocks are kept in a small cache, since bootmgr tends to read the
+ * same file in many small pieces.
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#ifndef NTLOADER_UTIL
+#include "ntloader.h"
+#endif
+#include "lznt1.h"
+#include "lzfile.h"
+
+#ifdef NTLOADER_UTIL
+#define DBG(...) \
+do \
+{ \
+    fprintf (stderr, __VA_ARGS__); \
+} while (0)
+#endif
+
+/** Number of cached blocks */
+#define LZFILE_CACHE_COUNT 4
+
+/** A cached decompressed block */
+struct lzfile_cache
+{
+    /** Block-compressed file (or NULL if unused) */
+    const void *data;
+    /** Block index */
+    size_t block;
+    /** Decompressed data */
+    uint8_t buf[LZFILE_BLOCK_SIZE];
+};
+
+/** Decompressed block cache */
+static struct lzfile_cache lzfile_cache[LZFILE_CACHE_COUNT];
+
+/** Next cache entry to be replaced */
+static unsigned int lzfile_cache_next;
+
+/**
+ * Check for block-compressed file
+ *
+ * @v data		File data
+ * @v len		Length of file data
+ * @v file_len		Uncompressed length to fill in
+ * @ret rc		Return status code (0 if block-compressed)
+ */
+int lzfile_check (const void *data, size_t len, size_t *file_len)
+{
+    const struct lzfile_header *header = data;
+    const uint32_t *offsets = lzfile_offsets (header);
+    uint64_t chunks;
+    size_t table_end;
+    uint32_t i;
+
+    /* Check header */
+    if (len < sizeof (*header))
+        return -1;
+    if (memcmp (header->magic, LZFILE_MAGIC, sizeof (header->magic)) != 0)
+        return -1;
+    if ((header->chunk_shift < LZFILE_BLOCK_SHIFT) ||
+        (header->chunk_shift > LZFILE_MAX_CHUNK_SHIFT) ||
+        (header->len != (size_t) header->len))
+    {
+        DBG ("bad block-compressed file header\n");
+        return -1;
+    }
+    chunks = ((header->len + (1ULL << header->chunk_shift) - 1) >>
+              header->chunk_shift);
+    if ((chunks != header->chunks) ||
+        (chunks >= ((len - sizeof (*header)) / sizeof (offsets[0]))))
+    {
+        DBG ("bad block-compressed file chunk count\n");
+        return -1;
+    }
+
+    /* Check chunk offset table */
+    table_end = (sizeof (*header) +
+                 ((header->chunks + 1) * sizeof (offsets[0])));
+    if (offsets[0] < table_end)
+        goto bad_table;
+    for (i = 0 ; i < header->chunks ; i++)
+    {
+        if (offsets[i + 1] < offsets[i])
+            goto bad_table;
+    }
+    if (offsets[header->chunks] > len)
+        goto bad_table;
+
+    *file_len = header->len;
+    return 0;
+
+bad_table:
+    DBG ("bad block-compressed file chunk table\n");
+    return -1;
+}
+
+/**
+ * Decompress block
+ *
+ * @v data		Block-compressed file
+ * @v block		Block index
+ * @v block_len		Expected decompressed length
+ * @v buf		Decompression buffer
+ * @ret rc		Return status code
+ */
+static int lzfile_block (const void *data, size_t block, size_t block_len,
+                         void *buf)
+{
+    const struct lzfile_header *header = data;
+    const uint32_t *offsets = lzfile_offsets (header);
+    const uint16_t *block_header;
+    unsigned int chunk_shift = (header->chunk_shift - LZFILE_BLOCK_SHIFT);
+    size_t chunk = (block >> chunk_shift);
+    unsigned int skip = (block & ((1UL << chunk_shift) - 1));
+    size_t offset = offsets[chunk];
+    size_t end = offsets[chunk + 1];
+    size_t len;
+
+    /* Skip preceding blocks within chunk */
+    while (1)
+    {
+        if ((offset + sizeof (*block_header)) > end)
+            goto overrun;
+        block_header = (data + offset);
+        len = (sizeof (*block_header) + LZNT1_BLOCK_LEN (*block_header));
+        if ((offset + len) > end)
+            goto overrun;
+        if (! skip--)
+            break;
+        offset += len;
+    }
+
+    /* Decompress block */
+    if (lznt1_decompress ((data + offset), len, buf) != (ssize_t) block_len)
+    {
+        DBG ("bad block-compressed file block %#zx\n", block);
+        return -1;
+    }
+    return 0;
+
+overrun:
+    DBG ("block-compressed file chunk %#zx overrun\n", chunk);
+    return -1;
+}
+
+/**
+ * Read data from block-compressed file
+ *
+ * @v data		Block-compressed file
+ * @v buf		Data buffer
+ * @v offset		Offset
+ * @v len		Length
+ * @ret rc		Return status code
+ */
+int lzfile_pread (const void *data, void *buf, size_t offset, size_t len)
+{
+    const struct lzfile_header *header = data;
+    struct lzfile_cache *cache;
+    size_t file_len = header->len;
+    size_t block;
+    size_t block_len;
+    size_t skip;
+    size_t frag_len;
+    unsigned int i;
+
+    if ((offset > file_len) || (len > (file_len - offset)))
+        return -1;
+
+    while (len)
+    {
+        block = (offset >> LZFILE_BLOCK_SHIFT);
+        skip = (offset & (LZFILE_BLOCK_SIZE - 1));
+        block_len = (file_len - (block << LZFILE_BLOCK_SHIFT));
+        if (block_len > LZFILE_BLOCK_SIZE)
+            block_len = LZFILE_BLOCK_SIZE;
+        frag_len = (block_len - skip);
+        if (frag_len > len)
+            frag_len = len;
+
+        /* Look up block in cache */
+        for (i = 0 ; i < LZFILE_CACHE_COUNT ; i++)
+        {
+            cache = &lzfile_cache[i];
+            if ((cache->data == data) && (cache->block == block))
+                break;
+        }
+
+        if (i < LZFILE_CACHE_COUNT)
+        {
+            /* Copy from cache */
+            memcpy (buf, (cache->buf + skip), frag_len);
+        }
+        else if (frag_len == block_len)
+        {
+            /* Decompress whole block directly into buffer */
+            if (lzfile_block (data, block, block_len, buf) != 0)
+                return -1;
+        }
+        else
+        {
+            /* Decompress partial block via cache */
+            cache = &lzfile_cache[lzfile_cache_next];
+            lzfile_cache_next = ((lzfile_cache_next + 1) %
+                                 LZFILE_CACHE_COUNT);
+            cache->data = NULL;
+            if (lzfile_block (data, block, block_len, cache->buf) != 0)
+                return -1;
+            cache->data = data;
+            cache->block = block;
+            memcpy (buf, (cache->buf + skip), frag_len);
+        }
+
+        buf += frag_len;
+        offset += frag_len;
+        len -= frag_len;
+    }
+    return 0;
+}
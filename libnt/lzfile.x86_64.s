@@ -0,0 +1,292 @@
+	.file	"lzfile.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"bad block-compressed file block %#zx\n"
+.LC1:
+	.string	"block-compressed file chunk %#zx overrun\n"
+	.text
+	.type	lzfile_block, @function
+lzfile_block:
+	pushq	%rbp
+	movq	%rdx, %rbp
+	pushq	%rbx
+	movq	%rsi, %rbx
+	pushq	%r8
+	movl	8(%rdi), %eax
+	movq	%rcx, %r8
+	leal	-12(%rax), %ecx
+	orq	$-1, %rax
+	shrq	%cl, %rsi
+	salq	%cl, %rax
+	notl	%eax
+	movl	24(%rdi,%rsi,4), %edx
+	movl	28(%rdi,%rsi,4), %r10d
+	andl	%ebx, %eax
+.L3:
+	leaq	2(%rdx), %rcx
+	cmpq	%rcx, %r10
+	jb	.L2
+	leaq	(%rdi,%rdx), %r9
+	movw	(%r9), %cx
+	andl	$4095, %ecx
+	addq	$3, %rcx
+	addq	%rcx, %rdx
+	cmpq	%rdx, %r10
+	jb	.L2
+	leal	-1(%rax), %r11d
+	testl	%eax, %eax
+	je	.L11
+	movl	%r11d, %eax
+	jmp	.L3
+.L11:
+	movq	%r8, %rdx
+	movq	%rcx, %rsi
+	movq	%r9, %rdi
+	call	lznt1_decompress
+	movq	%rbx, %rsi
+	leaq	.LC0(%rip), %rdi
+	movq	%rax, %rdx
+	xorl	%eax, %eax
+	cmpq	%rbp, %rdx
+	je	.L1
+	jmp	.L9
+.L2:
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+.L9:
+	call	printf
+	orl	$-1, %eax
+.L1:
+	popq	%rdx
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	lzfile_block, .-lzfile_block
+	.section	.rodata.str1.1
+.LC2:
+	.string	"NTLZNT1\032"
+.LC3:
+	.string	"bad block-compressed file header\n"
+.LC4:
+	.string	"bad block-compressed file chunk count\n"
+.LC5:
+	.string	"bad block-compressed file chunk table\n"
+	.text
+	.globl	lzfile_check
+	.hidden	lzfile_check
+	.type	lzfile_check, @function
+lzfile_check:
+	cmpq	$23, %rsi
+	jbe	.L24
+	pushq	%r13
+	leaq	24(%rdi), %r13
+	pushq	%r12
+	movq	%rdx, %r12
+	movl	$8, %edx
+	pushq	%rbp
+	movq	%rsi, %rbp
+	leaq	.LC2(%rip), %rsi
+	pushq	%rbx
+	movq	%rdi, %rbx
+	pushq	%rcx
+	call	memcmp
+	testl	%eax, %eax
+	jne	.L14
+	movl	8(%rbx), %ecx
+	leal	-12(%rcx), %edx
+	cmpl	$12, %edx
+	jbe	.L16
+	leaq	.LC3(%rip), %rdi
+.L27:
+	call	printf
+.L14:
+	orl	$-1, %eax
+	jmp	.L12
+.L16:
+	movq	16(%rbx), %rdi
+	movl	$1, %edx
+	salq	%cl, %rdx
+	leaq	-1(%rdi,%rdx), %rdx
+	shrq	%cl, %rdx
+	movl	12(%rbx), %ecx
+	movq	%rcx, %rsi
+	cmpq	%rdx, %rcx
+	jne	.L18
+	leaq	-24(%rbp), %rcx
+	shrq	$2, %rcx
+	cmpq	%rcx, %rdx
+	jb	.L19
+.L18:
+	leaq	.LC4(%rip), %rdi
+	jmp	.L28
+.L19:
+	leal	1(%rsi), %ecx
+	movl	24(%rbx), %r8d
+	leaq	24(,%rcx,4), %rcx
+	cmpq	%rcx, %r8
+	jb	.L20
+	xorl	%ecx, %ecx
+.L21:
+	movl	%ecx, %r8d
+	cmpl	%esi, %ecx
+	jnb	.L29
+	incq	%rcx
+	incl	%r8d
+	movl	20(%rbx,%rcx,4), %r9d
+	cmpl	%r9d, 0(%r13,%r8,4)
+	jnb	.L21
+	jmp	.L20
+.L29:
+	movl	0(%r13,%rdx,4), %edx
+	cmpq	%rdx, %rbp
+	jb	.L20
+	movq	%rdi, (%r12)
+	jmp	.L12
+.L20:
+	leaq	.LC5(%rip), %rdi
+.L28:
+	xorl	%eax, %eax
+	jmp	.L27
+.L12:
+	popq	%rdx
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+.L24:
+	orl	$-1, %eax
+	ret
+	.size	lzfile_check, .-lzfile_check
+	.globl	lzfile_pread
+	.hidden	lzfile_pread
+	.type	lzfile_pread, @function
+lzfile_pread:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$40, %rsp
+	movq	16(%rdi), %r15
+	cmpq	%rdx, %r15
+	jnb	.L31
+.L33:
+	orl	$-1, %eax
+	jmp	.L30
+.L31:
+	movq	%r15, %rax
+	movq	%rdi, %r13
+	movq	%rsi, %r14
+	movq	%rdx, %rbp
+	subq	%rdx, %rax
+	movq	%rcx, %r12
+	cmpq	%rcx, %rax
+	jb	.L33
+.L34:
+	testq	%r12, %r12
+	je	.L46
+	movq	%rbp, %rax
+	movq	%r15, %rdi
+	movq	%rbp, %rsi
+	movq	%rbp, %r8
+	andq	$-4096, %rax
+	andl	$4095, %r8d
+	shrq	$12, %rsi
+	leaq	lzfile_cache(%rip), %rcx
+	subq	%rax, %rdi
+	movl	$4096, %eax
+	movq	%rcx, %rdx
+	cmpq	%rax, %rdi
+	cmova	%rax, %rdi
+	movq	%rdi, %rbx
+	subq	%r8, %rbx
+	cmpq	%r12, %rbx
+	cmova	%r12, %rbx
+	xorl	%eax, %eax
+.L37:
+	cmpq	%r13, (%rcx)
+	jne	.L35
+	cmpq	%rsi, 8(%rcx)
+	je	.L36
+.L35:
+	incl	%eax
+	addq	$4112, %rcx
+	cmpl	$4, %eax
+	jne	.L37
+	jmp	.L47
+.L36:
+	imulq	$4112, %rax, %rax
+	leaq	16(%r8,%rax), %rsi
+	addq	%rdx, %rsi
+	jmp	.L45
+.L47:
+	cmpq	%rdi, %rbx
+	jne	.L40
+	movq	%r14, %rcx
+	movq	%rbx, %rdx
+	movq	%r13, %rdi
+	call	lzfile_block
+	testl	%eax, %eax
+	je	.L39
+	jmp	.L33
+.L40:
+	movl	lzfile_cache_next(%rip), %eax
+	movq	%r8, 24(%rsp)
+	movq	%rsi, 8(%rsp)
+	leal	1(%rax), %ecx
+	imulq	$4112, %rax, %rax
+	andl	$3, %ecx
+	movl	%ecx, lzfile_cache_next(%rip)
+	xorl	%ecx, %ecx
+	leaq	(%rdx,%rax), %r9
+	leaq	16(%rdx,%rax), %rax
+	movq	%rdi, %rdx
+	movq	%r13, %rdi
+	movq	%rcx, (%r9)
+	movq	%rax, %rcx
+	movq	%r9, 16(%rsp)
+	movq	%rax, (%rsp)
+	call	lzfile_block
+	testl	%eax, %eax
+	jne	.L33
+	movq	16(%rsp), %r9
+	movq	8(%rsp), %rsi
+	movq	24(%rsp), %r8
+	movq	%rsi, 8(%r9)
+	movq	(%rsp), %rsi
+	movq	%r13, (%r9)
+	addq	%r8, %rsi
+.L45:
+	movq	%rbx, %rdx
+	movq	%r14, %rdi
+	call	memcpy
+.L39:
+	addq	%rbx, %r14
+	addq	%rbx, %rbp
+	subq	%rbx, %r12
+	jmp	.L34
+.L46:
+	xorl	%eax, %eax
+.L30:
+	addq	$40, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	lzfile_pread, .-lzfile_pread
+	.local	lzfile_cache_next
+	.comm	lzfile_cache_next,4,4
+	.local	lzfile_cache
+	.comm	lzfile_cache,16448,32
+	.hidden	memcpy
+	.hidden	memcmp
+	.hidden	printf
+	.hidden	lznt1_decompress
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
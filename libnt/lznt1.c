@@ -28,6 +28,9 @@
 #include <stddef.h>
 #include <string.h>
 #include <stdio.h>
+#ifndef NTLOADER_UTIL
+#include "ntloader.h"
+#endif
 #include "lznt1.h"
 
 #ifdef NTLOADER_UTIL
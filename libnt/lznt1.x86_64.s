@@ -0,0 +1,165 @@
+	.file	"lznt1.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"LZNT1 block header overrun at %#zx\n"
+.LC1:
+	.string	"LZNT1 compressed value overrun at %#zx\n"
+.LC2:
+	.string	"LZNT1 uncompressed block overrun at %#zx+%#zx\n"
+	.text
+	.globl	lznt1_decompress
+	.hidden	lznt1_decompress
+	.type	lznt1_decompress, @function
+lznt1_decompress:
+	pushq	%r15
+	pushq	%r14
+	movq	%rdx, %r14
+	pushq	%r13
+	movq	%rsi, %r13
+	pushq	%r12
+	movq	%rdi, %r12
+	pushq	%rbp
+	xorl	%ebp, %ebp
+	pushq	%rbx
+	xorl	%ebx, %ebx
+	subq	$24, %rsp
+.L2:
+	cmpq	%r13, %rbx
+	je	.L1
+	leaq	1(%rbx), %rax
+	cmpq	%r13, %rax
+	jne	.L3
+	cmpb	$0, (%r12,%rbx)
+	je	.L1
+.L3:
+	leaq	2(%rbx), %rsi
+	cmpq	%rsi, %r13
+	jnb	.L5
+	movq	%rbx, %rsi
+	leaq	.LC0(%rip), %rdi
+	jmp	.L36
+.L5:
+	movw	(%r12,%rbx), %ax
+	movq	%rax, %rdx
+	andl	$4095, %edx
+	leaq	1(%rdx), %r15
+	leaq	(%rsi,%r15), %rbx
+	testw	%ax, %ax
+	jns	.L7
+	xorl	%edx, %edx
+	testq	%r14, %r14
+	je	.L8
+	leaq	(%r14,%rbp), %rdx
+.L8:
+	movl	$16, 12(%rsp)
+	xorl	%r9d, %r9d
+	xorl	%r8d, %r8d
+	xorl	%edi, %edi
+	movl	$12, %ecx
+	jmp	.L9
+.L39:
+	incl	%r8d
+	shrl	%r9d
+	movq	%r11, %rsi
+	andl	$7, %r8d
+.L9:
+	cmpq	%rbx, %rsi
+	je	.L11
+	testl	%r8d, %r8d
+	je	.L38
+.L10:
+	testb	$1, %r9b
+	je	.L12
+	leaq	2(%rsi), %r11
+	cmpq	%r11, %rbx
+	jnb	.L13
+	leaq	.LC1(%rip), %rdi
+.L36:
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L6
+.L38:
+	movzbl	(%r12,%rsi), %r9d
+	incq	%rsi
+	cmpq	%rbx, %rsi
+	jne	.L10
+	jmp	.L11
+.L13:
+	movl	$1, %eax
+	movzwl	(%r12,%rsi), %esi
+	sall	%cl, %eax
+	decl	%eax
+	andl	%esi, %eax
+	addl	$3, %eax
+	cltq
+	addq	%rax, %rdi
+	testq	%rdx, %rdx
+	je	.L17
+	sarl	%cl, %esi
+	xorl	%r15d, %r15d
+	movslq	%esi, %rsi
+	notq	%rsi
+	addq	%rdx, %rsi
+.L15:
+	movb	(%rsi,%r15), %r10b
+	movb	%r10b, (%rdx,%r15)
+	incq	%r15
+	cmpq	%r15, %rax
+	jne	.L15
+	addq	%rax, %rdx
+	jmp	.L17
+.L12:
+	testq	%rdx, %rdx
+	je	.L16
+	movb	(%r12,%rsi), %al
+	incq	%rdx
+	movb	%al, -1(%rdx)
+.L16:
+	leaq	1(%rsi), %r11
+	incq	%rdi
+.L17:
+	movl	12(%rsp), %eax
+	cmpq	%rdi, %rax
+	jnb	.L39
+	decl	%ecx
+	sall	12(%rsp)
+	jmp	.L17
+.L11:
+	addq	%rdi, %rbp
+	jmp	.L2
+.L7:
+	cmpq	%rbx, %r13
+	jnb	.L21
+	movq	%r15, %rdx
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L6:
+	orq	$-1, %rbp
+	jmp	.L1
+.L21:
+	testq	%r14, %r14
+	je	.L22
+	addq	%r12, %rsi
+	leaq	(%r14,%rbp), %rdi
+	movq	%r15, %rdx
+	call	memcpy
+.L22:
+	addq	%r15, %rbp
+	jmp	.L2
+.L1:
+	addq	$24, %rsp
+	movq	%rbp, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	lznt1_decompress, .-lznt1_decompress
+	.hidden	memcpy
+	.hidden	printf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,145 @@
+	.file	"peloader.c"
+	.text
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Bad MZ magic %04x\n"
+.LC1:
+	.string	"PE header outside file\n"
+.LC2:
+	.string	"Bad PE magic %08x\n"
+	.text
+	.globl	load_pe
+	.hidden	load_pe
+	.type	load_pe, @function
+load_pe:
+	pushq	%r15
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$88, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 72(%rsp)
+	xorl	%eax, %eax
+	movq	%rsi, (%rsp)
+	movzwl	(%rdi), %esi
+	cmpw	$23117, %si
+	je	.L2
+	leaq	.LC0(%rip), %rdi
+	jmp	.L11
+.L2:
+	movl	60(%rdi), %eax
+	movq	%rdi, %r14
+	cmpq	%rax, (%rsp)
+	jnb	.L4
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L3:
+	orl	$-1, %eax
+	jmp	.L1
+.L4:
+	leaq	(%rdi,%rax), %r13
+	movl	0(%r13), %esi
+	cmpl	$17744, %esi
+	je	.L6
+	leaq	.LC2(%rip), %rdi
+	xorl	%eax, %eax
+.L11:
+	call	printf
+	jmp	.L3
+.L6:
+	addq	$24, %rax
+	movzwl	20(%r13), %ebp
+	movq	%rdx, %rbx
+	movq	%r14, %rsi
+	leaq	(%rdi,%rax), %r15
+	movl	28(%r15), %edi
+	addq	%rax, %rbp
+	addq	%r14, %rbp
+	movq	%rdi, (%rdx)
+	movl	60(%r15), %edx
+	call	memcpy
+	leaq	63(%rsp), %rax
+	movl	60(%r15), %r8d
+	xorl	%r10d, %r10d
+	movq	%rax, 16(%rsp)
+	addq	(%rbx), %r8
+.L7:
+	movzwl	6(%r13), %eax
+	cmpl	%eax, %r10d
+	jnb	.L13
+	movq	16(%rsp), %rdi
+	xorl	%esi, %esi
+	movl	$9, %edx
+	movq	%r8, 40(%rsp)
+	movl	%r10d, 36(%rsp)
+	call	memset
+	movq	16(%rsp), %rdi
+	movq	%rbp, %rsi
+	movl	$8, %edx
+	call	memcpy
+	movl	16(%rbp), %eax
+	movl	12(%rbp), %r12d
+	xorl	%esi, %esi
+	addq	(%rbx), %r12
+	movq	%rax, 24(%rsp)
+	movl	8(%rbp), %eax
+	movq	%r12, %rdi
+	movq	%rax, %rdx
+	movq	%rax, 8(%rsp)
+	call	memset
+	movl	20(%rbp), %esi
+	movq	24(%rsp), %rdx
+	movq	%r12, %rdi
+	addq	%r14, %rsi
+	call	memcpy
+	movq	8(%rsp), %rax
+	movq	40(%rsp), %r8
+	movl	36(%rsp), %r10d
+	addq	%rax, %r12
+	cmpq	%r12, %r8
+	cmovb	%r12, %r8
+	incl	%r10d
+	addq	$40, %rbp
+	jmp	.L7
+.L13:
+	movl	32(%r15), %eax
+	movq	(%rbx), %rdi
+	movq	%r14, %rsi
+	subq	%rdi, %r8
+	movq	%rax, %rdx
+	negl	%edx
+	leaq	-1(%r8,%rax), %rax
+	andq	%rdx, %rax
+	movq	(%rsp), %rdx
+	movq	%rax, 8(%rbx)
+	addq	%rax, %rdi
+	call	memcpy
+	movq	(%rsp), %rax
+	addq	%rax, 8(%rbx)
+	movl	16(%r15), %eax
+	addq	(%rbx), %rax
+	movq	%rax, 16(%rbx)
+	xorl	%eax, %eax
+.L1:
+	movq	72(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L9
+	call	__stack_chk_fail@PLT
+.L9:
+	addq	$88, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	load_pe, .-load_pe
+	.hidden	memset
+	.hidden	memcpy
+	.hidden	printf
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1058 @@
+	.file	"reg.c"
+	.text
+	.type	get_int32_size, @function
+get_int32_size:
+	subq	$24, %rsp
+	addq	%rdi, %rsi
+	movl	$4, %edx
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 8(%rsp)
+	xorl	%eax, %eax
+	leaq	4(%rsp), %rdi
+	call	memcpy
+	movl	4(%rsp), %eax
+	negl	%eax
+	movq	8(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L2
+	call	__stack_chk_fail@PLT
+.L2:
+	addq	$24, %rsp
+	ret
+	.size	get_int32_size, .-get_int32_size
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"Unhandled registry signature 0x%x.\n"
+	.text
+	.type	clear_volatile, @function
+clear_volatile:
+	pushq	%r12
+	pushq	%rbp
+	movl	%esi, %ebp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	movq	%rbp, %rsi
+	subq	$16, %rsp
+	movq	8(%rdi), %rdi
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 8(%rsp)
+	xorl	%eax, %eax
+	call	get_int32_size
+	cmpl	$79, %eax
+	jle	.L5
+	movq	8(%rbx), %rdi
+	leaq	4(%rdi,%rbp), %rbp
+	cmpw	$27502, 0(%rbp)
+	jne	.L5
+	xorl	%ecx, %ecx
+	cmpl	$0, 20(%rbp)
+	movl	$-1163005939, 32(%rbp)
+	movl	%ecx, 24(%rbp)
+	je	.L5
+	movl	28(%rbp), %eax
+	cmpl	$-1, %eax
+	je	.L5
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	movq	8(%rbx), %rdx
+	movl	28(%rbp), %eax
+	leaq	6(%rsp), %rdi
+	leaq	4100(%rdx,%rax), %rsi
+	movl	$2, %edx
+	call	memcpy
+	movzwl	6(%rsp), %esi
+	leal	-26220(%rsi), %eax
+	testw	$-513, %ax
+	jne	.L7
+	movl	28(%rbp), %eax
+	movq	8(%rbx), %rdx
+	xorl	%ebp, %ebp
+	leaq	4100(%rdx,%rax), %r12
+.L8:
+	movzwl	2(%r12), %eax
+	cmpl	%eax, %ebp
+	jnb	.L5
+	movl	%ebp, %eax
+	movq	%rbx, %rdi
+	incl	%ebp
+	movl	4(%r12,%rax,8), %esi
+	addl	$4096, %esi
+	call	clear_volatile
+	jmp	.L8
+.L7:
+	cmpw	$26994, %si
+	jne	.L10
+	movl	28(%rbp), %eax
+	movq	8(%rbx), %rdx
+	xorl	%ebp, %ebp
+	leaq	4100(%rdx,%rax), %r12
+.L11:
+	movzwl	2(%r12), %eax
+	cmpl	%eax, %ebp
+	jnb	.L5
+	movl	%ebp, %eax
+	movq	%rbx, %rdi
+	incl	%ebp
+	movl	4(%r12,%rax,4), %esi
+	addl	$4096, %esi
+	call	clear_volatile
+	jmp	.L11
+.L10:
+	leaq	.LC0(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L5:
+	movq	8(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L14
+	call	__stack_chk_fail@PLT
+.L14:
+	addq	$16, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	clear_volatile, .-clear_volatile
+	.globl	reg_find_root
+	.hidden	reg_find_root
+	.type	reg_find_root, @function
+reg_find_root:
+	movq	8(%rdi), %rax
+	movl	36(%rax), %eax
+	addl	$4096, %eax
+	movl	%eax, (%rsi)
+	ret
+	.size	reg_find_root, .-reg_find_root
+	.section	.rodata.str1.1
+.LC1:
+	.string	"Reading nested CM_KEY_INDEX is not yet implemented\n"
+	.text
+	.globl	reg_enum_keys
+	.hidden	reg_enum_keys
+	.type	reg_enum_keys, @function
+reg_enum_keys:
+	pushq	%r14
+	movq	%rdi, %r14
+	pushq	%r13
+	movl	%esi, %r13d
+	pushq	%r12
+	movq	%r13, %rsi
+	movl	%r8d, %r12d
+	pushq	%rbp
+	movq	%rcx, %rbp
+	pushq	%rbx
+	movq	8(%rdi), %rdi
+	movl	%edx, %ebx
+	call	get_int32_size
+	testl	%eax, %eax
+	jns	.L21
+.L26:
+	movl	$3, %edx
+	jmp	.L20
+.L21:
+	cmpl	$79, %eax
+	jle	.L24
+	movq	8(%r14), %rdi
+	leaq	4(%rdi,%r13), %r13
+	cmpw	$27502, 0(%r13)
+	jne	.L24
+	movzwl	72(%r13), %edx
+	cltq
+	addq	$80, %rdx
+	cmpq	%rdx, %rax
+	jb	.L24
+	cmpl	20(%r13), %ebx
+	jnb	.L26
+	movl	28(%r13), %eax
+	cmpl	$-1, %eax
+	je	.L26
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	testl	%eax, %eax
+	js	.L26
+	cmpl	$7, %eax
+	jle	.L24
+	movl	28(%r13), %edx
+	movq	8(%r14), %rdi
+	leaq	4100(%rdi,%rdx), %r13
+	movw	0(%r13), %dx
+	cmpw	$26994, %dx
+	jne	.L27
+	movzwl	2(%r13), %r8d
+	xorl	%edx, %edx
+	jmp	.L28
+.L29:
+	subw	$26220, %cx
+	testw	$-513, %cx
+	jne	.L24
+	movzwl	2(%rsi), %ecx
+	cmpl	%ecx, %ebx
+	jb	.L38
+	subl	%ecx, %ebx
+	incq	%rdx
+.L28:
+	cmpq	%r8, %rdx
+	jnb	.L30
+	movl	4(%r13,%rdx,4), %ecx
+	leaq	4100(%rdi,%rcx), %rsi
+	movw	(%rsi), %cx
+	cmpw	$26994, %cx
+	jne	.L29
+	leaq	.LC1(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L24:
+	movl	$6, %edx
+	jmp	.L20
+.L27:
+	subw	$26220, %dx
+	testw	$-513, %dx
+	je	.L30
+	jmp	.L24
+.L38:
+	movq	%rsi, %r13
+.L30:
+	movzwl	2(%r13), %ecx
+	cltq
+	movq	%rcx, %rdx
+	leaq	8(,%rcx,8), %rcx
+	cmpq	%rcx, %rax
+	jb	.L24
+	cmpl	%edx, %ebx
+	jnb	.L24
+	movl	4(%r13,%rbx,8), %eax
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	testl	%eax, %eax
+	js	.L26
+	cmpl	$79, %eax
+	jle	.L24
+	movl	4(%r13,%rbx,8), %edx
+	movq	8(%r14), %rcx
+	leaq	4100(%rcx,%rdx), %rdx
+	cmpw	$27502, (%rdx)
+	jne	.L24
+	movzwl	72(%rdx), %ecx
+	cltq
+	addq	$80, %rcx
+	cmpq	%rcx, %rax
+	jb	.L24
+	xorl	%eax, %eax
+	testb	$32, 2(%rdx)
+	je	.L33
+.L32:
+	movzwl	72(%rdx), %ecx
+	cmpl	%ecx, %eax
+	jnb	.L46
+	cmpl	%r12d, %eax
+	jnb	.L41
+	movsbw	76(%rdx,%rax), %cx
+	movw	%cx, 0(%rbp,%rax,2)
+	incq	%rax
+	jmp	.L32
+.L37:
+	cmpl	%r12d, %eax
+	jnb	.L41
+	movw	76(%rdx,%rax,2), %cx
+	movw	%cx, 0(%rbp,%rax,2)
+	incq	%rax
+.L33:
+	movw	72(%rdx), %cx
+	shrw	%cx
+	movzwl	%cx, %ecx
+	cmpl	%ecx, %eax
+	jb	.L37
+.L46:
+	xorl	%edx, %edx
+	jmp	.L36
+.L41:
+	movl	$1, %edx
+.L36:
+	movw	$0, 0(%rbp,%rax,2)
+.L20:
+	popq	%rbx
+	movl	%edx, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	reg_enum_keys, .-reg_enum_keys
+	.globl	reg_find_key
+	.hidden	reg_find_key
+	.type	reg_find_key, @function
+reg_find_key:
+	pushq	%r15
+	pushq	%r14
+	movq	%rdx, %r14
+	pushq	%r13
+	movq	%rdi, %r13
+	pushq	%r12
+	movq	%rcx, %r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$24, %rsp
+.L78:
+	xorl	%ebp, %ebp
+.L48:
+	movw	(%r14,%rbp,2), %ax
+	cmpw	$92, %ax
+	je	.L71
+	testw	%ax, %ax
+	je	.L71
+	incq	%rbp
+	jmp	.L48
+.L71:
+	movl	%esi, %ebx
+	movq	8(%r13), %rdi
+	movq	%rbx, %rsi
+	call	get_int32_size
+	testl	%eax, %eax
+	jns	.L51
+.L55:
+	movl	$3, %eax
+	jmp	.L47
+.L51:
+	cmpl	$79, %eax
+	jg	.L53
+.L54:
+	movl	$6, %eax
+	jmp	.L47
+.L53:
+	movq	8(%r13), %rdi
+	leaq	4(%rdi,%rbx), %rbx
+	cmpw	$27502, (%rbx)
+	jne	.L54
+	movzwl	72(%rbx), %edx
+	cltq
+	addq	$80, %rdx
+	cmpq	%rdx, %rax
+	jb	.L54
+	cmpl	$0, 20(%rbx)
+	je	.L55
+	movl	28(%rbx), %eax
+	cmpl	$-1, %eax
+	je	.L55
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	testl	%eax, %eax
+	js	.L55
+	cmpl	$7, %eax
+	jle	.L54
+	movl	28(%rbx), %edx
+	movq	8(%r13), %rcx
+	leaq	4100(%rcx,%rdx), %rbx
+	movw	(%rbx), %cx
+	leal	-26220(%rcx), %edx
+	testw	$-513, %dx
+	jne	.L54
+	movzwl	2(%rbx), %edx
+	cltq
+	leaq	8(,%rdx,8), %rdx
+	cmpq	%rdx, %rax
+	jb	.L54
+	xorl	%r15d, %r15d
+.L56:
+	movzwl	2(%rbx), %eax
+	cmpl	%eax, %r15d
+	jnb	.L55
+	movl	%r15d, %edx
+	movq	8(%r13), %rdi
+	movl	4(%rbx,%rdx,8), %eax
+	movq	%rdx, 8(%rsp)
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	cmpl	$79, %eax
+	jle	.L57
+	movq	8(%rsp), %rdx
+	movq	8(%r13), %rcx
+	movl	4(%rbx,%rdx,8), %edx
+	leaq	4100(%rcx,%rdx), %rcx
+	movq	%rdx, %rsi
+	cmpw	$27502, (%rcx)
+	jne	.L57
+	movzwl	72(%rcx), %edi
+	cltq
+	leaq	80(%rdi), %r8
+	movq	%rdi, %rdx
+	cmpq	%r8, %rax
+	jb	.L57
+	testb	$32, 2(%rcx)
+	je	.L58
+	xorl	%eax, %eax
+	cmpq	%rdi, %rbp
+	jne	.L57
+.L59:
+	cmpl	%edx, %eax
+	jnb	.L85
+	movsbw	76(%rcx,%rax), %r8w
+	movw	(%r14,%rax,2), %di
+	leal	-65(%r8), %r9d
+	cmpw	$25, %r9w
+	ja	.L60
+	addl	$32, %r8d
+.L60:
+	leal	-65(%rdi), %r9d
+	cmpw	$25, %r9w
+	ja	.L61
+	addl	$32, %edi
+.L61:
+	incq	%rax
+	cmpw	%di, %r8w
+	je	.L59
+	jmp	.L57
+.L58:
+	shrw	%dx
+	movzwl	%dx, %eax
+	cmpq	%rax, %rbp
+	jne	.L57
+	xorl	%eax, %eax
+	movzwl	%dx, %edx
+.L64:
+	cmpl	%edx, %eax
+	jnb	.L85
+	movw	76(%rcx,%rax,2), %r8w
+	movw	(%r14,%rax,2), %di
+	leal	-65(%r8), %r9d
+	cmpw	$25, %r9w
+	ja	.L65
+	addl	$32, %r8d
+.L65:
+	leal	-65(%rdi), %r9d
+	cmpw	$25, %r9w
+	ja	.L66
+	addl	$32, %edi
+.L66:
+	incq	%rax
+	cmpw	%di, %r8w
+	je	.L64
+	jmp	.L57
+.L85:
+	jne	.L57
+	addq	%rbp, %rbp
+	addl	$4096, %esi
+	movw	(%r14,%rbp), %ax
+	testw	%ax, %ax
+	jne	.L86
+	jmp	.L69
+.L57:
+	incl	%r15d
+	jmp	.L56
+.L86:
+	leaq	2(%r14,%rbp), %r14
+	movw	(%r14), %dx
+	cmpw	$92, %ax
+	jne	.L78
+	testw	%dx, %dx
+	jne	.L78
+.L69:
+	movl	%esi, (%r12)
+	xorl	%eax, %eax
+.L47:
+	addq	$24, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	reg_find_key, .-reg_find_key
+	.globl	reg_delete_key
+	.hidden	reg_delete_key
+	.type	reg_delete_key, @function
+reg_delete_key:
+	pushq	%r13
+	pushq	%r12
+	movq	%rdi, %r12
+	pushq	%rbp
+	movl	%edx, %ebp
+	pushq	%rbx
+	movl	%esi, %ebx
+	pushq	%rcx
+	movq	8(%rdi), %rdi
+	movq	%rbx, %rsi
+	call	get_int32_size
+	testl	%eax, %eax
+	jns	.L88
+.L92:
+	movl	$3, %eax
+	jmp	.L87
+.L88:
+	cmpl	$79, %eax
+	jg	.L90
+.L91:
+	movl	$6, %eax
+	jmp	.L87
+.L90:
+	movq	8(%r12), %rdi
+	leaq	4(%rdi,%rbx), %rbx
+	cmpw	$27502, (%rbx)
+	jne	.L91
+	movzwl	72(%rbx), %edx
+	cltq
+	addq	$80, %rdx
+	cmpq	%rdx, %rax
+	jb	.L91
+	cmpl	$0, 20(%rbx)
+	je	.L92
+	movl	28(%rbx), %eax
+	cmpl	$-1, %eax
+	je	.L92
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	testl	%eax, %eax
+	js	.L92
+	cmpl	$7, %eax
+	jle	.L91
+	movl	28(%rbx), %edx
+	movq	8(%r12), %rcx
+	leaq	4100(%rcx,%rdx), %r12
+	movw	(%r12), %cx
+	leal	-26220(%rcx), %edx
+	testw	$-513, %dx
+	jne	.L91
+	movzwl	2(%r12), %ecx
+	cltq
+	movq	%rcx, %rdx
+	leaq	8(,%rcx,8), %rcx
+	cmpq	%rcx, %rax
+	jb	.L91
+	xorl	%eax, %eax
+	movzwl	%dx, %esi
+.L93:
+	movl	%eax, %r13d
+	cmpl	%esi, %eax
+	jnb	.L92
+	movl	4(%r12,%rax,8), %ecx
+	leaq	1(%rax), %rdi
+	addl	$4096, %ecx
+	cmpl	%ebp, %ecx
+	jne	.L97
+	decl	%edx
+	leaq	4(%r12,%rax,8), %rdi
+	movw	%dx, 2(%r12)
+.L94:
+	movzwl	2(%r12), %eax
+	leaq	8(%rdi), %rbp
+	cmpl	%eax, %r13d
+	jnb	.L102
+	movl	$8, %edx
+	movq	%rbp, %rsi
+	incl	%r13d
+	call	memcpy
+	movq	%rbp, %rdi
+	jmp	.L94
+.L102:
+	decl	20(%rbx)
+	xorl	%eax, %eax
+	jmp	.L87
+.L97:
+	movq	%rdi, %rax
+	jmp	.L93
+.L87:
+	popq	%rdx
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	reg_delete_key, .-reg_delete_key
+	.globl	reg_enum_values
+	.hidden	reg_enum_values
+	.type	reg_enum_values, @function
+reg_enum_values:
+	pushq	%r15
+	movl	%esi, %r15d
+	pushq	%r14
+	movq	%r15, %rsi
+	movl	%edx, %r14d
+	pushq	%r13
+	movq	%rdi, %r13
+	pushq	%r12
+	movq	%r9, %r12
+	pushq	%rbp
+	movl	%r8d, %ebp
+	pushq	%rbx
+	movq	%rcx, %rbx
+	pushq	%r10
+	movq	8(%rdi), %rdi
+	call	get_int32_size
+	testl	%eax, %eax
+	jns	.L104
+.L108:
+	movl	$3, %ecx
+	jmp	.L103
+.L104:
+	cmpl	$79, %eax
+	jg	.L106
+.L107:
+	movl	$6, %ecx
+	jmp	.L103
+.L106:
+	movq	8(%r13), %rdi
+	leaq	4(%rdi,%r15), %r15
+	cmpw	$27502, (%r15)
+	jne	.L107
+	movzwl	72(%r15), %edx
+	cltq
+	addq	$80, %rdx
+	cmpq	%rdx, %rax
+	jb	.L107
+	cmpl	36(%r15), %r14d
+	jnb	.L108
+	movl	40(%r15), %eax
+	cmpl	$-1, %eax
+	je	.L108
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	testl	%eax, %eax
+	js	.L108
+	movl	36(%r15), %edx
+	cltq
+	leaq	4(,%rdx,4), %rdx
+	cmpq	%rdx, %rax
+	jb	.L107
+	movl	40(%r15), %eax
+	movq	8(%r13), %rdi
+	leaq	4100(%rax,%r14,4), %r14
+	addq	%rdi, %r14
+	movl	(%r14), %eax
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	testl	%eax, %eax
+	js	.L108
+	cmpl	$23, %eax
+	jle	.L107
+	movl	(%r14), %edx
+	movq	8(%r13), %rcx
+	leaq	4100(%rcx,%rdx), %rdx
+	cmpw	$27510, (%rdx)
+	jne	.L107
+	movzwl	2(%rdx), %ecx
+	cltq
+	addq	$24, %rcx
+	cmpq	%rcx, %rax
+	jb	.L107
+	xorl	%eax, %eax
+	testb	$1, 16(%rdx)
+	je	.L110
+.L109:
+	movzwl	2(%rdx), %ecx
+	cmpl	%ecx, %eax
+	jnb	.L123
+	cmpl	%ebp, %eax
+	jnb	.L118
+	movsbw	20(%rdx,%rax), %cx
+	movw	%cx, (%rbx,%rax,2)
+	incq	%rax
+	jmp	.L109
+.L115:
+	cmpl	%ebp, %eax
+	jnb	.L118
+	movw	20(%rdx,%rax,2), %cx
+	movw	%cx, (%rbx,%rax,2)
+	incq	%rax
+.L110:
+	movw	2(%rdx), %cx
+	shrw	%cx
+	movzwl	%cx, %ecx
+	cmpl	%ecx, %eax
+	jb	.L115
+.L123:
+	xorl	%ecx, %ecx
+	jmp	.L114
+.L118:
+	movl	$1, %ecx
+.L114:
+	movw	$0, (%rbx,%rax,2)
+	movl	12(%rdx), %eax
+	movl	%eax, (%r12)
+.L103:
+	popq	%rdx
+	movl	%ecx, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	reg_enum_values, .-reg_enum_values
+	.globl	reg_query_value
+	.hidden	reg_query_value
+	.type	reg_query_value, @function
+reg_query_value:
+	pushq	%r15
+	movq	%r9, %r15
+	pushq	%r14
+	pushq	%r13
+	movq	%rdx, %r13
+	pushq	%r12
+	movl	%esi, %r12d
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	movq	%rdx, %rdi
+	subq	$56, %rsp
+	movq	%rcx, 16(%rsp)
+	movq	%r8, 24(%rsp)
+	call	wcslen
+	movq	8(%rbx), %rdi
+	movq	%r12, %rsi
+	movq	%rax, %rbp
+	call	get_int32_size
+	testl	%eax, %eax
+	jns	.L125
+.L129:
+	movl	$3, %eax
+	jmp	.L124
+.L125:
+	cmpl	$79, %eax
+	jg	.L127
+.L128:
+	movl	$6, %eax
+	jmp	.L124
+.L127:
+	movq	8(%rbx), %rdi
+	leaq	4(%rdi,%r12), %r14
+	cmpw	$27502, (%r14)
+	jne	.L128
+	movzwl	72(%r14), %ecx
+	cltq
+	addq	$80, %rcx
+	cmpq	%rcx, %rax
+	jb	.L128
+	cmpl	$0, 36(%r14)
+	je	.L129
+	movl	40(%r14), %eax
+	cmpl	$-1, %eax
+	je	.L129
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	testl	%eax, %eax
+	js	.L129
+	movl	36(%r14), %ecx
+	cltq
+	leaq	4(,%rcx,4), %rcx
+	cmpq	%rcx, %rax
+	jb	.L128
+	movl	40(%r14), %eax
+	movq	8(%rbx), %r11
+	movl	%ebp, %r8d
+	xorl	%ebp, %ebp
+	addq	$4100, %rax
+	movq	%rax, 8(%rsp)
+.L130:
+	cmpl	36(%r14), %ebp
+	jnb	.L129
+	movq	8(%rsp), %rdx
+	movl	%ebp, %eax
+	movq	8(%rbx), %rdi
+	movl	%r8d, 44(%rsp)
+	movq	%r11, 32(%rsp)
+	leaq	(%rdx,%rax,4), %r12
+	addq	%r11, %r12
+	movl	(%r12), %eax
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	movq	32(%rsp), %r11
+	movl	44(%rsp), %r8d
+	movslq	%eax, %rcx
+	cmpl	$23, %ecx
+	jle	.L131
+	movq	8(%rbx), %rdi
+	movl	(%r12), %eax
+	leaq	4100(%rdi,%rax), %r12
+	cmpw	$27510, (%r12)
+	jne	.L131
+	movzwl	2(%r12), %esi
+	movq	%rsi, %rax
+	addq	$24, %rsi
+	cmpq	%rsi, %rcx
+	jb	.L131
+	testb	$1, 16(%r12)
+	je	.L132
+	xorl	%ecx, %ecx
+	cmpl	%r8d, %eax
+	jne	.L131
+.L133:
+	cmpl	%eax, %ecx
+	jnb	.L153
+	movsbw	20(%r12,%rcx), %r9w
+	movw	0(%r13,%rcx,2), %si
+	leal	-65(%r9), %r10d
+	cmpw	$25, %r10w
+	ja	.L134
+	addl	$32, %r9d
+.L134:
+	leal	-65(%rsi), %r10d
+	cmpw	$25, %r10w
+	ja	.L135
+	addl	$32, %esi
+.L135:
+	incq	%rcx
+	cmpw	%si, %r9w
+	je	.L133
+	jmp	.L131
+.L132:
+	shrw	%ax
+	xorl	%ecx, %ecx
+	movzwl	%ax, %eax
+	cmpl	%r8d, %eax
+	jne	.L131
+.L138:
+	cmpl	%eax, %ecx
+	jnb	.L153
+	movw	20(%r12,%rcx,2), %r9w
+	movw	0(%r13,%rcx,2), %si
+	leal	-65(%r9), %r10d
+	cmpw	$25, %r10w
+	ja	.L139
+	addl	$32, %r9d
+.L139:
+	leal	-65(%rsi), %r10d
+	cmpw	$25, %r10w
+	ja	.L140
+	addl	$32, %esi
+.L140:
+	incq	%rcx
+	cmpw	%si, %r9w
+	je	.L138
+	jmp	.L131
+.L153:
+	cmpl	%ecx, %eax
+	jne	.L131
+	movl	4(%r12), %eax
+	testl	%eax, %eax
+	jns	.L142
+	andl	$2147483647, %eax
+	leal	-1(%rax), %edx
+	cmpl	$1, %edx
+	jbe	.L148
+	cmpl	$4, %eax
+	jne	.L143
+.L148:
+	leaq	8(%r12), %rax
+	jmp	.L146
+.L143:
+	testl	%eax, %eax
+	jne	.L128
+	xorl	%eax, %eax
+	jmp	.L146
+.L142:
+	movl	8(%r12), %eax
+	leal	4096(%rax), %esi
+	call	get_int32_size
+	cmpl	4(%r12), %eax
+	jb	.L128
+	movl	8(%r12), %eax
+	movq	8(%rbx), %rdx
+	leaq	4100(%rdx,%rax), %rax
+.L146:
+	movq	16(%rsp), %rbx
+	movq	24(%rsp), %rdx
+	movq	%rax, (%rbx)
+	movl	4(%r12), %eax
+	andl	$2147483647, %eax
+	movl	%eax, (%rdx)
+	movl	12(%r12), %eax
+	movl	%eax, (%r15)
+	xorl	%eax, %eax
+	jmp	.L124
+.L131:
+	incl	%ebp
+	jmp	.L130
+.L124:
+	addq	$56, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	reg_query_value, .-reg_query_value
+	.section	.rodata.str1.1
+.LC2:
+	.string	"Invalid signature.\n"
+.LC3:
+	.string	"Invalid major value.\n"
+.LC4:
+	.string	"Invalid minor value.\n"
+.LC5:
+	.string	"Type was not HFILE_TYPE_PRIMARY.\n"
+.LC6:
+	.string	"Format was not HBASE_FORMAT_MEMORY.\n"
+.LC7:
+	.string	"Cluster was not 1.\n"
+.LC8:
+	.string	"Sequence1 != Sequence2.\n"
+.LC9:
+	.string	"Invalid checksum.\n"
+.LC10:
+	.string	"Hive is dirty.\n"
+.LC11:
+	.string	"Header check failed.\n"
+.LC12:
+	.string	"Invalid hbin signature in hive_t at offset %zx.\n"
+.LC13:
+	.string	"hbin FileOffset in hive_t was 0x%x, expected %zx.\n"
+.LC14:
+	.string	"hbin overrun in hive_t at offset %zx.\n"
+.LC15:
+	.string	"hbin Size in hive_t at offset %zx was not multiple of 1000.\n"
+	.text
+	.globl	reg_open_hive
+	.hidden	reg_open_hive
+	.type	reg_open_hive, @function
+reg_open_hive:
+	pushq	%r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	movq	8(%rdi), %rbx
+	cmpl	$1718052210, (%rbx)
+	je	.L155
+	leaq	.LC2(%rip), %rdi
+	jmp	.L181
+.L155:
+	cmpl	$1, 20(%rbx)
+	je	.L157
+	leaq	.LC3(%rip), %rdi
+	jmp	.L181
+.L157:
+	cmpl	$2, 24(%rbx)
+	ja	.L158
+	leaq	.LC4(%rip), %rdi
+	jmp	.L181
+.L158:
+	movl	28(%rbx), %r13d
+	testl	%r13d, %r13d
+	je	.L159
+	leaq	.LC5(%rip), %rdi
+	jmp	.L181
+.L159:
+	cmpl	$1, 32(%rbx)
+	je	.L160
+	leaq	.LC6(%rip), %rdi
+	jmp	.L181
+.L160:
+	movl	44(%rbx), %r14d
+	cmpl	$1, %r14d
+	je	.L161
+	leaq	.LC7(%rip), %rdi
+.L181:
+	xorl	%eax, %eax
+	call	printf
+	leaq	.LC11(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L167
+.L161:
+	movl	8(%rbx), %eax
+	movq	%rdi, %r12
+	cmpl	%eax, 4(%rbx)
+	je	.L175
+	leaq	.LC8(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movl	4(%rbx), %eax
+	movl	%eax, 8(%rbx)
+	jmp	.L162
+.L175:
+	xorl	%r14d, %r14d
+.L162:
+	movq	8(%r12), %rdx
+	xorl	%ebp, %ebp
+	xorl	%eax, %eax
+.L163:
+	xorl	(%rdx,%rax,4), %ebp
+	incq	%rax
+	cmpq	$127, %rax
+	jne	.L163
+	testl	%ebp, %ebp
+	movl	$1, %eax
+	cmove	%eax, %ebp
+	movl	$-2, %eax
+	cmpl	%eax, %ebp
+	cmova	%eax, %ebp
+	cmpl	508(%rbx), %ebp
+	je	.L164
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	movl	%ebp, 508(%rbx)
+	jmp	.L165
+.L164:
+	testl	%r14d, %r14d
+	je	.L166
+.L165:
+	leaq	.LC10(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+.L166:
+	movq	8(%r12), %rdx
+	xorl	%esi, %esi
+	movl	40(%rdx), %edi
+	leaq	4096(%rdx), %rax
+	jmp	.L168
+.L169:
+	movl	4(%rax), %r8d
+	cmpq	%rsi, %r8
+	je	.L170
+	movq	%rsi, %rdx
+	leaq	.LC13(%rip), %rdi
+	movl	%r8d, %esi
+	xorl	%eax, %eax
+	call	printf
+.L167:
+	movl	$6, %r13d
+	jmp	.L154
+.L173:
+	addq	%rcx, %rsi
+	addq	%rcx, %rax
+.L168:
+	cmpq	%rdi, %rsi
+	jnb	.L183
+	cmpl	$1852400232, (%rax)
+	je	.L169
+	leaq	.LC12(%rip), %rdi
+	jmp	.L182
+.L170:
+	movl	8(%rax), %ecx
+	movq	%rdi, %r9
+	subq	%rsi, %r9
+	movq	%rcx, %r8
+	cmpq	%rcx, %r9
+	jnb	.L172
+	leaq	.LC14(%rip), %rdi
+.L182:
+	xorl	%eax, %eax
+	call	printf
+	jmp	.L167
+.L172:
+	andl	$4095, %r8d
+	je	.L173
+	leaq	.LC15(%rip), %rdi
+	jmp	.L182
+.L183:
+	movl	36(%rdx), %esi
+	movq	%r12, %rdi
+	addl	$4096, %esi
+	call	clear_volatile
+.L154:
+	popq	%rbx
+	movl	%r13d, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	reg_open_hive, .-reg_open_hive
+	.hidden	wcslen
+	.hidden	printf
+	.hidden	memcpy
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
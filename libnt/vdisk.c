@@ -25,15 +25,80 @@
  */
 
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
-#include <assert.h>
 #include "ctype.h"
 #include "ntloader.h"
 #include "vdisk.h"
+#include "trace.h"
 
-/** Virtual files */
-struct vdisk_file vdisk_files[VDISK_MAX_FILES];
+/** Number of virtual files per file table chunk */
+#define VDISK_FILES_PER_CHUNK 64
+
+/** First chunk of virtual files
+ *
+ * This is allocated statically, so that typical initrds need no
+ * dynamic allocation at all.
+ */
+static struct vdisk_file vdisk_first_files[VDISK_FILES_PER_CHUNK];
+
+/** Initial virtual file table */
+static struct vdisk_file *vdisk_first_chunk[] = { vdisk_first_files };
+
+/** Virtual file table
+ *
+ * Files are held in fixed-size chunks, so that the table can grow
+ * without moving any file already handed out by vdisk_add_file().
+ */
+static struct vdisk_file **vdisk_file_chunks = vdisk_first_chunk;
+
+/** Number of chunks allocated within virtual file table */
+static unsigned int vdisk_file_max_chunks = 1;
+
+/** Number of virtual files */
+static unsigned int vdisk_file_count;
+
+/** Virtual file slot size (log2 of sectors) */
+static unsigned int vdisk_file_shift = VDISK_MIN_FILE_SHIFT;
+
+/** Number of clusters in each virtual directory */
+static unsigned int vdisk_dir_clusters = 1;
+
+/**
+ * Get virtual file
+ *
+ * @v idx		File index
+ * @ret file		Virtual file
+ */
+static inline struct vdisk_file *vdisk_file_at (unsigned int idx)
+{
+    return &vdisk_file_chunks[ idx / VDISK_FILES_PER_CHUNK ]
+        [ idx % VDISK_FILES_PER_CHUNK ];
+}
+
+/**
+ * Get starting cluster of virtual file
+ *
+ * @v idx		File index
+ * @ret cluster		Starting cluster
+ */
+static inline uint32_t vdisk_file_cluster (unsigned int idx)
+{
+    return (VDISK_FILE_CLUSTER +
+            (idx << (vdisk_file_shift - VDISK_MIN_FILE_SHIFT)));
+}
+
+/**
+ * Get starting cluster of virtual directory
+ *
+ * @v dir		Directory index
+ * @ret cluster		Starting cluster
+ */
+static inline uint32_t vdisk_dir_cluster (unsigned int dir)
+{
+    return (VDISK_ROOT_CLUSTER + (dir * vdisk_dir_clusters));
+}
 
 /**
  * Read from virtual Master Boot Record
@@ -113,6 +178,27 @@ static void vdisk_fsinfo (uint64_t lba __unused, unsigned int count __unused,
     fsinfo->magic3 = VDISK_FSINFO_MAGIC3;
 }
 
+/**
+ * Fill FAT entries with an increasing cluster sequence
+ *
+ * @v next		FAT entries
+ * @v cluster		First cluster number
+ * @v count		Number of entries (a multiple of four)
+ */
+static void vdisk_fat_fill (uint32_t *next, uint32_t cluster,
+                            unsigned int count)
+{
+
+    /* Fill four entries per iteration to allow vectorisation */
+    for ( ; count ; count -= 4, next += 4, cluster += 4)
+    {
+        next[0] = (cluster + 1);
+        next[1] = (cluster + 2);
+        next[2] = (cluster + 3);
+        next[3] = (cluster + 4);
+    }
+}
+
 /**
  * Read from virtual FAT
  *
@@ -123,43 +209,64 @@ static void vdisk_fsinfo (uint64_t lba __unused, unsigned int count __unused,
 static void vdisk_fat (uint64_t lba, unsigned int count, void *data)
 {
     uint32_t *next = data;
+    struct vdisk_file *file;
     uint32_t start;
     uint32_t end;
-    uint32_t file_end_marker;
+    uint32_t dirs_end;
+    uint32_t marker;
+    unsigned int slot_shift;
     unsigned int i;
 
     /* Calculate window within FAT */
     start = ((lba - VDISK_FAT_LBA) *
               (VDISK_SECTOR_SIZE / sizeof (*next)));
     end = (start + (count * (VDISK_SECTOR_SIZE / sizeof (*next))));
-    next -= start;
 
     /* Start by marking each cluster as chaining to the next */
-    for (i = start ; i < end ; i++)
-        next[i] = (i + 1);
+    vdisk_fat_fill (next, start, (end - start));
+    next -= start;
 
     /* Add first-sector special values, if applicable */
+    dirs_end = vdisk_dir_cluster (VDISK_NUM_DIRS);
     if (start == 0)
     {
         next[0] = ((VDISK_FAT_END_MARKER & ~0xff) |
                     VDISK_VBR_MEDIA);
-        for (i = 1; i < (VDISK_SECTOR_SIZE / sizeof (*next)); i++)
+        next[1] = VDISK_FAT_END_MARKER;
+        for (i = dirs_end; i < (VDISK_SECTOR_SIZE / sizeof (*next)); i++)
             next[i] = VDISK_FAT_END_MARKER;
     }
 
-    /* Add end-of-file markers, if applicable */
-    for (i = 0 ; i < VDISK_MAX_FILES ; i++)
+    /* Add end-of-directory markers, if applicable */
+    if (start < dirs_end)
     {
-        if (vdisk_files[i].read)
+        for (i = 1 ; i <= VDISK_NUM_DIRS ; i++)
         {
-            file_end_marker = (VDISK_FILE_CLUSTER (i) +
-                                ((vdisk_files[i].xlen - 1) /
-                                  VDISK_CLUSTER_SIZE));
-            if ((file_end_marker >= start) &&
-                 (file_end_marker < end))
-                next[file_end_marker] = VDISK_FAT_END_MARKER;
+            marker = (vdisk_dir_cluster (i) - 1);
+            if ((marker >= start) && (marker < end))
+                next[marker] = VDISK_FAT_END_MARKER;
         }
     }
+
+    /* Add end-of-file markers, if applicable.  Only the slots
+     * overlapping this window need to be considered.
+     */
+    if (end <= VDISK_FILE_CLUSTER)
+        return;
+    slot_shift = (vdisk_file_shift - VDISK_MIN_FILE_SHIFT);
+    i = ((start > VDISK_FILE_CLUSTER) ?
+         ((start - VDISK_FILE_CLUSTER) >> slot_shift) : 0);
+    for ( ; i < vdisk_file_count ; i++)
+    {
+        marker = vdisk_file_cluster (i);
+        if (marker >= end)
+            break;
+        file = vdisk_file_at (i);
+        if (file->xlen)
+            marker += ((file->xlen - 1) / VDISK_CLUSTER_SIZE);
+        if ((marker >= start) && (marker < end))
+            next[marker] = VDISK_FAT_END_MARKER;
+    }
 }
 
 /**
@@ -288,11 +395,11 @@ static void vdisk_root (uint64_t lba __unused, unsigned int count __unused,
     /* Construct subdirectories */
     dirent = vdisk_empty_dir (dir);
     dirent = vdisk_directory_entry (dirent, "BOOT", 0, VDISK_DIRECTORY,
-                                     VDISK_BOOT_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_BOOT_DIR));
     dirent = vdisk_directory_entry (dirent, "SOURCES", 0, VDISK_DIRECTORY,
-                                     VDISK_SOURCES_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_SOURCES_DIR));
     dirent = vdisk_directory_entry (dirent, "EFI", 0, VDISK_DIRECTORY,
-                                     VDISK_EFI_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_EFI_DIR));
 }
 
 /**
@@ -311,10 +418,10 @@ static void vdisk_boot (uint64_t lba __unused, unsigned int count __unused,
     /* Construct subdirectories */
     dirent = vdisk_empty_dir (dir);
     dirent = vdisk_directory_entry (dirent, "FONTS", 0, VDISK_DIRECTORY,
-                                     VDISK_FONTS_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_FONTS_DIR));
     dirent = vdisk_directory_entry (dirent, "RESOURCES", 0,
                                      VDISK_DIRECTORY,
-                                     VDISK_RESOURCES_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_RESOURCES_DIR));
 }
 
 /**
@@ -381,10 +488,10 @@ static void vdisk_efi (uint64_t lba __unused, unsigned int count __unused,
     /* Construct subdirectories */
     dirent = vdisk_empty_dir (dir);
     dirent = vdisk_directory_entry (dirent, "BOOT", 0, VDISK_DIRECTORY,
-                                     VDISK_BOOT_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_BOOT_DIR));
     dirent = vdisk_directory_entry (dirent, "MICROSOFT", 0,
                                      VDISK_DIRECTORY,
-                                     VDISK_MICROSOFT_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_MICROSOFT_DIR));
 }
 
 /**
@@ -403,7 +510,7 @@ static void vdisk_microsoft (uint64_t lba __unused,
     /* Construct subdirectories */
     dirent = vdisk_empty_dir (dir);
     dirent = vdisk_directory_entry (dirent, "BOOT", 0, VDISK_DIRECTORY,
-                                     VDISK_BOOT_CLUSTER);
+                                     vdisk_dir_cluster (VDISK_BOOT_DIR));
 }
 
 /**
@@ -429,20 +536,66 @@ static void vdisk_dir_files (uint64_t lba, unsigned int count, void *data)
         dirent = &dir->entry[ VDISK_DIRENT_PER_SECTOR - 1 ];
 
         /* Identify file */
-        idx = VDISK_FILE_DIRENT_IDX (lba);
-        assert (idx < (sizeof (vdisk_files) /
-                         sizeof (vdisk_files[0])));
-        file = &vdisk_files[idx];
+        idx = (((uint32_t) (lba - VDISK_ROOT_LBA) %
+                (vdisk_dir_clusters * VDISK_CLUSTER_COUNT)) - 1);
+        if (idx >= vdisk_file_count)
+            continue;
+        file = vdisk_file_at (idx);
         if (! file->read)
             continue;
 
         /* Populate directory entry */
         vdisk_directory_entry (dirent, file->name, file->xlen,
                                 VDISK_READ_ONLY,
-                                VDISK_FILE_CLUSTER (idx));
+                                vdisk_file_cluster (idx));
     }
 }
 
+/**
+ * Restrict patch window to registered patched ranges
+ *
+ * @v file		Virtual file
+ * @v start		Starting offset of window, to update
+ * @v end		Ending offset of window, to update
+ * @ret rc		Return status code (0 if window needs patching)
+ *
+ * Overlapping ranges are coalesced into a single window, so that the
+ * patch method is invoked at most once per read.
+ */
+static int vdisk_patch_window (struct vdisk_file *file, size_t *start,
+                               size_t *end)
+{
+    struct vdisk_patch_range *range;
+    size_t patch_start = *end;
+    size_t patch_end = *start;
+    unsigned int i;
+
+    if (*start >= *end)
+        return -1;
+
+    /* Files without registered ranges are patched on every read */
+    if (! file->patch_count)
+        return 0;
+
+    for (i = 0 ; i < file->patch_count ; i++)
+    {
+        range = &file->patch_ranges[i];
+        if ((range->end <= *start) || (range->start >= *end))
+            continue;
+        if (patch_start > range->start)
+            patch_start = range->start;
+        if (patch_end < range->end)
+            patch_end = range->end;
+    }
+    if (patch_start >= patch_end)
+        return -1;
+    if (*start < patch_start)
+        *start = patch_start;
+    if (*end > patch_end)
+        *end = patch_end;
+    return 0;
+}
+
 /**
  * Read from virtual file (or empty space)
  *
@@ -453,15 +606,19 @@ static void vdisk_dir_files (uint64_t lba, unsigned int count, void *data)
 static void vdisk_file (uint64_t lba, unsigned int count, void *data)
 {
     struct vdisk_file *file;
+    uint64_t slot_lba;
     size_t offset;
     size_t len;
     size_t copy_len;
     size_t pad_len;
-    size_t patch_len;
+    size_t patch_start;
+    size_t patch_end;
 
     /* Construct file portion */
-    file = &vdisk_files[ VDISK_FILE_IDX (lba) ];
-    offset = VDISK_FILE_OFFSET (lba);
+    slot_lba = (lba - VDISK_FILE_LBA);
+    file = vdisk_file_at (slot_lba >> vdisk_file_shift);
+    offset = (((size_t) slot_lba & ((1UL << vdisk_file_shift) - 1)) *
+              VDISK_SECTOR_SIZE);
     len = (count * VDISK_SECTOR_SIZE);
 
     /* Copy any initialised-data portion */
@@ -476,11 +633,16 @@ static void vdisk_file (uint64_t lba, unsigned int count, void *data)
     memset ((data + copy_len), 0, pad_len);
 
     /* Patch any applicable portion */
-    patch_len = ((offset < file->xlen) ? (file->xlen - offset) : 0);
-    if (patch_len > len)
-        patch_len = len;
-    if (file->patch)
-        file->patch (file, data, offset, patch_len);
+    patch_start = offset;
+    patch_end = (offset + len);
+    if (patch_end > file->xlen)
+        patch_end = file->xlen;
+    if (file->patch && (vdisk_patch_window (file, &patch_start,
+                                            &patch_end) == 0))
+    {
+        file->patch (file, (data + (patch_start - offset)), patch_start,
+                     (patch_end - patch_start));
+    }
 }
 
 /** A virtual disk region */
@@ -500,6 +662,8 @@ struct vdisk_region
      * @v data		Data buffer
      */
     void (* build) (uint64_t lba, unsigned int count, void *data);
+    /** Prebuilt data (or NULL to build on demand) */
+    const void *cache;
 };
 
 /** Define a virtual disk region */
@@ -511,22 +675,26 @@ struct vdisk_region
     .build = _build, \
 }
 
-/** Define a virtual disk directory region */
-#define VDISK_DIRECTORY_REGION(_name, _build_subdirs, _lba) \
+/** Define a virtual disk directory region
+ *
+ * Directories initially occupy a single cluster each, and are moved
+ * and grown by vdisk_layout() as files are added.
+ */
+#define VDISK_DIRECTORY_REGION(_name, _build_subdirs, _dir) \
 { \
     .name = _name " subdirs", \
-    .lba = _lba, \
+    .lba = (VDISK_ROOT_LBA + ((_dir) * VDISK_CLUSTER_COUNT)), \
     .count = 1, \
     .build = _build_subdirs, \
 }, \
 { \
     .name = _name " files", \
-    .lba = (_lba + 1), \
+    .lba = (VDISK_ROOT_LBA + ((_dir) * VDISK_CLUSTER_COUNT) + 1), \
     .count = (VDISK_CLUSTER_COUNT - 1), \
     .build = vdisk_dir_files, \
 }
 
-/** Virtual disk regions */
+/** Virtual disk regions (sorted by starting LBA) */
 static struct vdisk_region vdisk_regions[] =
 {
     VDISK_REGION ("MBR", vdisk_mbr,
@@ -539,17 +707,50 @@ static struct vdisk_region vdisk_regions[] =
                    VDISK_BACKUP_VBR_LBA, VDISK_BACKUP_VBR_COUNT),
     VDISK_REGION ("FAT", vdisk_fat,
                    VDISK_FAT_LBA, VDISK_FAT_COUNT),
-    VDISK_DIRECTORY_REGION ("Root", vdisk_root, VDISK_ROOT_LBA),
-    VDISK_DIRECTORY_REGION ("Boot", vdisk_boot, VDISK_BOOT_LBA),
-    VDISK_DIRECTORY_REGION ("Sources", vdisk_sources, VDISK_SOURCES_LBA),
-    VDISK_DIRECTORY_REGION ("Fonts", vdisk_fonts, VDISK_FONTS_LBA),
+    VDISK_DIRECTORY_REGION ("Root", vdisk_root, VDISK_ROOT_DIR),
+    VDISK_DIRECTORY_REGION ("Boot", vdisk_boot, VDISK_BOOT_DIR),
+    VDISK_DIRECTORY_REGION ("Sources", vdisk_sources, VDISK_SOURCES_DIR),
+    VDISK_DIRECTORY_REGION ("Fonts", vdisk_fonts, VDISK_FONTS_DIR),
     VDISK_DIRECTORY_REGION ("Resources", vdisk_resources,
-                             VDISK_RESOURCES_LBA),
-    VDISK_DIRECTORY_REGION ("EFI", vdisk_efi, VDISK_EFI_LBA),
+                             VDISK_RESOURCES_DIR),
+    VDISK_DIRECTORY_REGION ("EFI", vdisk_efi, VDISK_EFI_DIR),
     VDISK_DIRECTORY_REGION ("Microsoft", vdisk_microsoft,
-                             VDISK_MICROSOFT_LBA),
+                             VDISK_MICROSOFT_DIR),
 };
 
+/** Number of virtual disk regions */
+#define VDISK_NUM_REGIONS \
+    (sizeof (vdisk_regions) / sizeof (vdisk_regions[0]))
+
+/**
+ * Find virtual disk region
+ *
+ * @v lba		LBA
+ * @ret region		First region ending after this LBA, or NULL
+ *
+ * The region table is sorted by starting LBA and regions never
+ * overlap, so a binary search on the region end is sufficient.
+ */
+static struct vdisk_region *vdisk_find_region (uint64_t lba)
+{
+    struct vdisk_region *region;
+    unsigned int min = 0;
+    unsigned int max = VDISK_NUM_REGIONS;
+    unsigned int mid;
+
+    while (min < max)
+    {
+        mid = ((min + max) / 2);
+        region = &vdisk_regions[mid];
+        if ((region->lba + region->count) <= lba)
+            min = (mid + 1);
+        else
+            max = mid;
+    }
+
+    return ((min < VDISK_NUM_REGIONS) ? &vdisk_regions[min] : NULL);
+}
+
 /**
  * Read from virtual disk
  *
@@ -561,17 +762,19 @@ void vdisk_read (uint64_t lba, unsigned int count, void *data)
 {
     struct vdisk_region *region;
     void (* build) (uint64_t lba, unsigned int count, void *data);
+    const void *cache;
     const char *name __unused;
     uint64_t start = lba;
     uint64_t end = (lba + count);
     uint64_t frag_start = start;
     uint64_t frag_end;
-    int file_idx;
+    uint64_t file_idx;
     uint64_t file_end;
-    uint64_t region_start;
     uint64_t region_end;
+    uint64_t frag_offset;
+    uint64_t timestamp;
     unsigned int frag_count;
-    unsigned int i;
+    enum trace_kind kind;
 
     DBG2 ("Read to %p from %#llx+%#x: ", data, lba, count);
 
@@ -581,54 +784,59 @@ void vdisk_read (uint64_t lba, unsigned int count, void *data)
         frag_end = end;
         name = NULL;
         build = NULL;
+        cache = NULL;
+        kind = TRACE_EMPTY;
+        frag_offset = 0;
 
         /* Truncate fragment and generate data */
-        file_idx = VDISK_FILE_IDX (frag_start);
-        if (file_idx >= 0)
+        if (frag_start >= VDISK_FILE_LBA)
         {
 
-            /* Truncate fragment to end of file */
-            file_end = VDISK_FILE_LBA (file_idx + 1);
+            /* Truncate fragment to end of file slot */
+            file_idx = ((frag_start - VDISK_FILE_LBA) >> vdisk_file_shift);
+            file_end = (VDISK_FILE_LBA +
+                        ((file_idx + 1) << vdisk_file_shift));
             if (frag_end > file_end)
                 frag_end = file_end;
 
             /* Generate data from file */
-            if (file_idx < VDISK_MAX_FILES)
+            if (file_idx < vdisk_file_count)
             {
-                name = vdisk_files[file_idx].name;
+                name = vdisk_file_at (file_idx)->name;
                 build = vdisk_file;
+                kind = TRACE_FILE;
+                frag_offset = ((frag_start - VDISK_FILE_LBA) &
+                               ((1ULL << vdisk_file_shift) - 1));
             }
 
         }
-        else
+        else if ((region = vdisk_find_region (frag_start)) != NULL)
         {
 
-            /* Truncate fragment to region boundaries */
-            for (i = 0 ; i < (sizeof (vdisk_regions) /
-                                sizeof (vdisk_regions[0])); i++)
+            if (frag_start < region->lba)
+            {
+                /* Avoid crossing start of next region */
+                if (frag_end > region->lba)
+                    frag_end = region->lba;
+            }
+            else
             {
-                region = &vdisk_regions[i];
-                region_start = region->lba;
-                region_end = (region_start + region->count);
-
-                /* Avoid crossing start of any region */
-                if ((frag_start < region_start) &&
-                     (frag_end > region_start))
-                    frag_end = region_start;
-
-                /* Ignore unless we overlap with this region */
-                if ((frag_start >= region_end) ||
-                     (frag_end <= region_start))
-                    continue;
-
                 /* Avoid crossing end of region */
+                region_end = (region->lba + region->count);
                 if (frag_end > region_end)
                     frag_end = region_end;
 
                 /* Found a suitable region */
                 name = region->name;
                 build = region->build;
-                break;
+                cache = region->cache;
+                kind = TRACE_REGION;
+                frag_offset = (frag_start - region->lba);
+                if (cache)
+                {
+                    cache += ((frag_start - region->lba) *
+                               VDISK_SECTOR_SIZE);
+                }
             }
         }
 
@@ -636,10 +844,15 @@ void vdisk_read (uint64_t lba, unsigned int count, void *data)
         frag_count = (frag_end - frag_start);
         DBG2 ("%s%s (%#x)", ((frag_start == start) ? "" : ", "),
                (name ? name : "empty"), frag_count);
-        if (build)
+        timestamp = trace_timestamp ();
+        if (cache)
+            memcpy (data, cache, (frag_count * VDISK_SECTOR_SIZE));
+        else if (build)
             build (frag_start, frag_count, data);
         else
             memset (data, 0, (frag_count * VDISK_SECTOR_SIZE));
+        trace_record (kind, name, frag_start, frag_count, frag_offset,
+                      timestamp);
 
         /* Move to next fragment */
         frag_start += frag_count;
@@ -650,6 +863,182 @@ void vdisk_read (uint64_t lba, unsigned int count, void *data)
     DBG2 ("\n");
 }
 
+/**
+ * Finalise virtual disk
+ *
+ * The set of files is fixed once the initrd has been extracted, so
+ * every directory sector can be rendered once into a single arena and
+ * subsequently served by a plain copy.  If memory is short, directory
+ * sectors continue to be built on demand.
+ */
+void vdisk_finalise (void)
+{
+    struct vdisk_region *region;
+    const void *files = NULL;
+    size_t files_len = 0;
+    size_t len = 0;
+    void *arena;
+    void *data;
+    unsigned int i;
+
+    /* Calculate arena size.  The file entries are identical for
+     * every directory, so only one copy of them is needed.
+     */
+    for (i = 0 ; i < VDISK_NUM_REGIONS ; i++)
+    {
+        region = &vdisk_regions[i];
+        if (region->lba < VDISK_ROOT_LBA)
+            continue;
+        if (region->build == vdisk_dir_files)
+            files_len = (region->count * VDISK_SECTOR_SIZE);
+        else
+            len += (region->count * VDISK_SECTOR_SIZE);
+    }
+    len += files_len;
+
+    /* Allocate arena */
+    arena = malloc (len);
+    if (! arena)
+    {
+        DBG ("...building directories on demand\n");
+        return;
+    }
+
+    /* Render directory sectors */
+    data = arena;
+    for (i = 0 ; i < VDISK_NUM_REGIONS ; i++)
+    {
+        region = &vdisk_regions[i];
+        if (region->lba < VDISK_ROOT_LBA)
+            continue;
+        if ((region->build == vdisk_dir_files) && files)
+        {
+            region->cache = files;
+            continue;
+        }
+        region->build (region->lba, region->count, data);
+        region->cache = data;
+        if (region->build == vdisk_dir_files)
+            files = data;
+        data += (region->count * VDISK_SECTOR_SIZE);
+    }
+    DBG ("...prebuilt directories at %p len %#zx\n", arena, len);
+}
+
+/**
+ * Get virtual file
+ *
+ * @v idx		File index
+ * @ret file		Virtual file, or NULL
+ */
+struct vdisk_file *vdisk_get_file (unsigned int idx)
+{
+    return ((idx < vdisk_file_count) ? vdisk_file_at (idx) : NULL);
+}
+
+/**
+ * Get number of sectors in use
+ *
+ * @ret count		Number of sectors
+ *
+ * Every sector beyond this reads as zeroes.
+ */
+uint64_t vdisk_used_count (void)
+{
+    return (VDISK_FILE_LBA +
+            ((uint64_t) vdisk_file_count << vdisk_file_shift));
+}
+
+/**
+ * Lay out virtual directories and file slots
+ *
+ * @v file		Virtual file (which may have grown)
+ *
+ * Each directory must have room for one entry per file, and each file
+ * slot must be large enough to hold the largest file.  Both only ever
+ * grow, and are fixed once the initrd has been extracted.
+ */
+static void vdisk_layout (struct vdisk_file *file)
+{
+    struct vdisk_region *region;
+    uint64_t lba;
+    size_t sectors;
+    unsigned int dir_count;
+    unsigned int i;
+
+    /* Grow file slots to fit this file */
+    sectors = ((file->xlen / VDISK_SECTOR_SIZE) +
+               ((file->xlen % VDISK_SECTOR_SIZE) ? 1 : 0));
+    while ((vdisk_file_shift < VDISK_MAX_FILE_SHIFT) &&
+            (sectors > (1UL << vdisk_file_shift)))
+        vdisk_file_shift++;
+    if (sectors > (1UL << vdisk_file_shift))
+        die ("File too large: %s\n", file->name);
+    if ((VDISK_FILE_LBA + ((uint64_t) vdisk_file_count << vdisk_file_shift))
+        > VDISK_COUNT)
+        die ("Too many files\n");
+
+    /* Grow directories to fit one subdirectory sector plus all files */
+    vdisk_dir_clusters = ((vdisk_file_count + VDISK_CLUSTER_COUNT) /
+                          VDISK_CLUSTER_COUNT);
+    dir_count = (vdisk_dir_clusters * VDISK_CLUSTER_COUNT);
+    if ((VDISK_ROOT_LBA + ((uint64_t) VDISK_NUM_DIRS * dir_count))
+        > VDISK_FILE_LBA)
+        die ("Too many files\n");
+
+    /* Move directory regions */
+    lba = VDISK_ROOT_LBA;
+    for (i = 0 ; i < VDISK_NUM_REGIONS ; i++)
+    {
+        region = &vdisk_regions[i];
+        if (region->lba < VDISK_ROOT_LBA)
+            continue;
+        if (region->build == vdisk_dir_files)
+        {
+            region->lba = (lba + 1);
+            region->count = (dir_count - 1);
+            lba += dir_count;
+        }
+        else
+        {
+            region->lba = lba;
+        }
+    }
+}
+
+/**
+ * Allocate new virtual file
+ *
+ * @ret file		Virtual file
+ */
+static struct vdisk_file *vdisk_alloc_file (void)
+{
+    struct vdisk_file **chunks;
+    struct vdisk_file *chunk;
+    unsigned int idx = vdisk_file_count;
+    unsigned int max = (idx / VDISK_FILES_PER_CHUNK);
+
+    /* Allocate new chunk, if necessary */
+    if (max >= vdisk_file_max_chunks)
+    {
+        chunks = malloc ((max + 1) * sizeof (chunks[0]));
+        chunk = malloc (VDISK_FILES_PER_CHUNK * sizeof (chunk[0]));
+        if ((! chunks) || (! chunk))
+            die ("Out of memory\n");
+        memcpy (chunks, vdisk_file_chunks,
+                 (vdisk_file_max_chunks * sizeof (chunks[0])));
+        memset (chunk, 0, (VDISK_FILES_PER_CHUNK * sizeof (chunk[0])));
+        chunks[max] = chunk;
+        if (vdisk_file_chunks != vdisk_first_chunk)
+            free (vdisk_file_chunks);
+        vdisk_file_chunks = chunks;
+        vdisk_file_max_chunks = (max + 1);
+    }
+
+    vdisk_file_count++;
+    return vdisk_file_at (idx);
+}
+
 /**
  * Add file to virtual disk
  *
@@ -665,20 +1054,16 @@ struct vdisk_file *vdisk_add_file (const char *name, void *opaque, size_t len,
                                             size_t offset,
                                             size_t len))
 {
-    static unsigned int index = 0;
     struct vdisk_file *file;
 
-    /* Sanity check */
-    if (index >= VDISK_MAX_FILES)
-        die ("Too many files\n");
-
     /* Store file */
-    file = &vdisk_files[index++];
+    file = vdisk_alloc_file ();
     snprintf (file->name, sizeof (file->name), "%s", name);
     file->opaque = opaque;
     file->len = len;
     file->xlen = len;
     file->read = read;
+    vdisk_layout (file);
     DBG ("Using %s via %p len %#zx\n", file->name, file->opaque,
           file->len);
 
@@ -698,7 +1083,86 @@ void vdisk_patch_file (struct vdisk_file *file,
 
     /* Record patch method */
     file->patch = patch;
+    file->patch_count = 0;
 
-    /* Allow patch method to update file length */
+    /* Allow patch method to update file length and register ranges */
     patch (file, NULL, 0, 0);
+    vdisk_layout (file);
+    DBG ("Patching %s in %d ranges\n", file->name, file->patch_count);
+}
+
+/**
+ * Register patched range within virtual file
+ *
+ * @v file		Virtual file
+ * @v offset		Starting offset
+ * @v len		Length
+ *
+ * This is intended to be called by a patch method when it is first
+ * invoked with a NULL data buffer.  Reads that do not overlap any
+ * registered range then bypass the patch method entirely.  If too
+ * many disjoint ranges are registered, the two closest neighbours
+ * are merged, so the recorded ranges only ever grow.
+ */
+void vdisk_patch_range (struct vdisk_file *file, size_t offset, size_t len)
+{
+    struct vdisk_patch_range ranges[VDISK_MAX_PATCH_RANGES + 1];
+    struct vdisk_patch_range *range;
+    unsigned int count = 0;
+    unsigned int closest;
+    size_t start = offset;
+    size_t end = (offset + len);
+    unsigned int i;
+
+    if (! len)
+        return;
+
+    /* Rebuild sorted list, absorbing overlapping or adjacent ranges */
+    for (i = 0 ; i < file->patch_count ; i++)
+    {
+        range = &file->patch_ranges[i];
+        if ((range->end < start) || (range->start > end))
+            continue;
+        if (start > range->start)
+            start = range->start;
+        if (end < range->end)
+            end = range->end;
+    }
+    for (i = 0 ; i < file->patch_count ; i++)
+    {
+        range = &file->patch_ranges[i];
+        if ((range->start >= start) && (range->end <= end))
+            continue;
+        if ((range->start > start) && (count == 0 ||
+                                       ranges[count - 1].start < start))
+        {
+            ranges[count].start = start;
+            ranges[count++].end = end;
+        }
+        ranges[count++] = *range;
+    }
+    if ((count == 0) || (ranges[count - 1].start < start))
+    {
+        ranges[count].start = start;
+        ranges[count++].end = end;
+    }
+
+    /* Merge closest neighbours if there are too many ranges */
+    if (count > VDISK_MAX_PATCH_RANGES)
+    {
+        closest = 0;
+        for (i = 1 ; i < (count - 1) ; i++)
+        {
+            if ((ranges[i + 1].start - ranges[i].end) <
+                (ranges[closest + 1].start - ranges[closest].end))
+                closest = i;
+        }
+        ranges[closest].end = ranges[closest + 1].end;
+        count--;
+        memmove (&ranges[closest + 1], &ranges[closest + 2],
+                 ((count - closest - 1) * sizeof (ranges[0])));
+    }
+
+    memcpy (file->patch_ranges, ranges, (count * sizeof (ranges[0])));
+    file->patch_count = count;
 }
@@ -0,0 +1,1382 @@
+	.file	"vdisk.c"
+	.text
+	.type	vdisk_file_at, @function
+vdisk_file_at:
+	movq	vdisk_file_chunks(%rip), %rcx
+	movl	%edi, %edx
+	andl	$63, %edi
+	shrl	$6, %edx
+	imulq	$144, %rdi, %rax
+	addq	(%rcx,%rdx,8), %rax
+	ret
+	.size	vdisk_file_at, .-vdisk_file_at
+	.type	vdisk_fat, @function
+vdisk_fat:
+	leaq	-192(%rdi), %r9
+	sall	$7, %esi
+	pushq	%rbx
+	movq	%rdx, %r11
+	sall	$7, %r9d
+	pushq	%rcx
+	movq	%rdx, %rcx
+	addl	%r9d, %esi
+	movl	%r9d, %eax
+.L3:
+	cmpl	%eax, %esi
+	je	.L38
+	leal	1(%rax), %edx
+	addq	$16, %rcx
+	movl	%edx, -16(%rcx)
+	leal	2(%rax), %edx
+	movl	%edx, -12(%rcx)
+	leal	3(%rax), %edx
+	addl	$4, %eax
+	movl	%edx, -8(%rcx)
+	movl	%eax, -4(%rcx)
+	jmp	.L3
+.L38:
+	movl	vdisk_dir_clusters(%rip), %edi
+	movl	%r9d, %eax
+	leaq	0(,%rax,4), %rdx
+	imull	$7, %edi, %r8d
+	subq	%rdx, %r11
+	addl	$2, %r8d
+	testl	%r9d, %r9d
+	je	.L5
+	cmpl	%r8d, %r9d
+	jb	.L6
+	jmp	.L7
+.L5:
+	movabsq	$1152921470515544056, %rbx
+	movl	%r8d, %edx
+	movq	%rbx, (%r11)
+	leaq	(%r11,%rdx,4), %rcx
+	movl	%r8d, %edx
+.L8:
+	cmpl	$127, %edx
+	ja	.L39
+	movl	$268435448, (%rcx)
+	incl	%edx
+	addq	$4, %rcx
+	jmp	.L8
+.L39:
+	testl	%r8d, %r8d
+	jne	.L6
+	cmpl	$122881, %esi
+	jbe	.L2
+	movl	vdisk_file_shift(%rip), %eax
+	leal	-6(%rax), %ecx
+	jmp	.L11
+.L6:
+	leal	1(%rdi), %edx
+	movl	$7, %ecx
+.L13:
+	cmpl	%r9d, %edx
+	jb	.L12
+	cmpl	%esi, %edx
+	jnb	.L12
+	movl	%edx, %r8d
+	movl	$268435448, (%r11,%r8,4)
+.L12:
+	addl	%edi, %edx
+	decl	%ecx
+	jne	.L13
+.L7:
+	cmpl	$122881, %esi
+	jbe	.L2
+	movl	vdisk_file_shift(%rip), %ebx
+	subq	$122881, %rax
+	xorl	%r8d, %r8d
+	leal	-6(%rbx), %ecx
+	shrq	%cl, %rax
+	cmpl	$122881, %r9d
+	cmova	%eax, %r8d
+.L11:
+	movl	vdisk_file_count(%rip), %ebx
+.L15:
+	cmpl	%ebx, %r8d
+	jnb	.L2
+	movl	%r8d, %r10d
+	movl	%ecx, 4(%rsp)
+	sall	%cl, %r10d
+	addl	$122881, %r10d
+	cmpl	%esi, %r10d
+	jnb	.L2
+	movl	%r8d, %edi
+	call	vdisk_file_at
+	movl	4(%rsp), %ecx
+	movq	48(%rax), %rax
+	testq	%rax, %rax
+	je	.L16
+	decq	%rax
+	shrq	$15, %rax
+	addl	%eax, %r10d
+.L16:
+	cmpl	%r9d, %r10d
+	jb	.L17
+	cmpl	%esi, %r10d
+	jnb	.L17
+	movl	$268435448, (%r11,%r10,4)
+.L17:
+	incl	%r8d
+	jmp	.L15
+.L2:
+	popq	%rax
+	popq	%rbx
+	ret
+	.size	vdisk_fat, .-vdisk_fat
+	.type	vdisk_file, @function
+vdisk_file:
+	pushq	%r14
+	xorl	%r14d, %r14d
+	pushq	%r13
+	pushq	%r12
+	movq	%rdx, %r12
+	pushq	%rbp
+	pushq	%rbx
+	movl	%esi, %ebx
+	leaq	-8388608(%rdi), %rsi
+	movq	%rsi, %rax
+	sall	$9, %ebx
+	subq	$16, %rsp
+	movl	vdisk_file_shift(%rip), %ecx
+	shrq	%cl, %rax
+	movl	%ecx, 12(%rsp)
+	movq	%rax, %rdi
+	call	vdisk_file_at
+	movl	12(%rsp), %ecx
+	movq	%rax, %r13
+	orq	$-1, %rax
+	salq	%cl, %rax
+	movq	%rax, %rbp
+	movq	40(%r13), %rax
+	notq	%rbp
+	andq	%rsi, %rbp
+	salq	$9, %rbp
+	cmpq	%rax, %rbp
+	jnb	.L41
+	subq	%rbp, %rax
+	cmpq	%rbx, %rax
+	cmova	%rbx, %rax
+	movq	%rax, %r14
+	testq	%rax, %rax
+	je	.L41
+	movq	%rax, %rcx
+	movq	%rbp, %rdx
+	movq	%r12, %rsi
+	movq	%r13, %rdi
+	call	*56(%r13)
+.L41:
+	movq	%rbx, %rdx
+	xorl	%esi, %esi
+	leaq	(%r12,%r14), %rdi
+	subq	%r14, %rdx
+	call	memset
+	movq	48(%r13), %rax
+	leaq	0(%rbp,%rbx), %rcx
+	movq	64(%r13), %r8
+	cmpq	%rax, %rcx
+	cmova	%rax, %rcx
+	cmpq	%rcx, %rbp
+	jnb	.L40
+	testq	%r8, %r8
+	je	.L40
+	movl	136(%r13), %r11d
+	testl	%r11d, %r11d
+	je	.L49
+	leaq	80(%r13), %rsi
+	movq	%rbp, %rax
+	movq	%rcx, %rdx
+	xorl	%edi, %edi
+.L47:
+	movq	(%rsi), %r9
+	cmpq	%r9, %rbp
+	jnb	.L46
+	movq	-8(%rsi), %r10
+	cmpq	%rcx, %r10
+	jnb	.L46
+	cmpq	%r10, %rdx
+	cmova	%r10, %rdx
+	cmpq	%r9, %rax
+	cmovb	%r9, %rax
+.L46:
+	incl	%edi
+	addq	$16, %rsi
+	cmpl	%edi, %r11d
+	jne	.L47
+	cmpq	%rax, %rdx
+	jnb	.L40
+	cmpq	%rdx, %rbp
+	cmovnb	%rbp, %rdx
+	cmpq	%rax, %rcx
+	cmova	%rax, %rcx
+	jmp	.L45
+.L49:
+	movq	%rbp, %rdx
+.L45:
+	movq	%rdx, %rax
+	addq	$16, %rsp
+	movq	%r13, %rdi
+	subq	%rdx, %rcx
+	subq	%rbp, %rax
+	popq	%rbx
+	popq	%rbp
+	leaq	(%r12,%rax), %rsi
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	jmp	*%r8
+.L40:
+	addq	$16, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	vdisk_file, .-vdisk_file
+	.type	vdisk_empty_dir, @function
+vdisk_empty_dir:
+	pushq	%rbx
+	movl	$512, %edx
+	movq	%rdi, %rbx
+	xorl	%esi, %esi
+	call	memset
+	movq	%rbx, %rax
+	leaq	512(%rbx), %rdx
+.L53:
+	movb	$-27, (%rax)
+	addq	$32, %rax
+	cmpq	%rdx, %rax
+	jne	.L53
+	leaq	480(%rbx), %rax
+	popq	%rbx
+	ret
+	.size	vdisk_empty_dir, .-vdisk_empty_dir
+	.type	vdisk_sources, @function
+vdisk_sources:
+	movq	%rdx, %rdi
+	jmp	vdisk_empty_dir
+	.size	vdisk_sources, .-vdisk_sources
+	.type	vdisk_directory_entry, @function
+vdisk_directory_entry:
+	pushq	%r15
+	movl	%ecx, %r15d
+	pushq	%r14
+	movq	%rdx, %r14
+	movl	$11, %edx
+	pushq	%r13
+	movq	%rsi, %r13
+	movl	$32, %esi
+	pushq	%r12
+	movl	%r8d, %r12d
+	pushq	%rbp
+	leaq	-32(%rdi), %rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+	pushq	%r9
+	call	memset
+	movl	%r12d, %eax
+	movb	%r15b, 11(%rbx)
+	movl	%r14d, 28(%rbx)
+	shrl	$16, %eax
+	movl	$553648128, 13(%rbx)
+	movb	$40, 17(%rbx)
+	movl	$673251328, 22(%rbx)
+	movw	%ax, 20(%rbx)
+	xorl	%eax, %eax
+	movw	%r12w, 26(%rbx)
+	xorl	%r12d, %r12d
+.L58:
+	rorb	%r12b
+	addb	(%rbx,%rax), %r12b
+	incq	%rax
+	cmpq	$11, %rax
+	jne	.L58
+	subq	$31, %rbx
+	movl	$1, %eax
+.L59:
+	cmpb	$15, 11(%rbp)
+	je	.L60
+	movb	%al, 0(%rbp)
+	leaq	1(%rbp), %rdi
+	movl	$10, %edx
+	leal	1(%rax), %r14d
+	movl	$255, %esi
+	call	memset
+	movb	$15, 11(%rbp)
+	leaq	14(%rbp), %rdi
+	movl	$12, %edx
+	movb	%r12b, 13(%rbp)
+	movl	$255, %esi
+	call	memset
+	leaq	28(%rbp), %rdi
+	movl	$4, %edx
+	movl	$255, %esi
+	call	memset
+	movl	%r14d, %eax
+.L60:
+	movsbw	0(%r13), %dx
+	incq	%r13
+	movl	%edx, %ecx
+	movw	%dx, (%rbx)
+	leaq	-32(%rbp), %rdx
+	testb	%cl, %cl
+	je	.L61
+	leaq	9(%rbp), %rcx
+	cmpq	%rcx, %rbx
+	jne	.L62
+	leaq	14(%rbp), %rbx
+	jmp	.L59
+.L62:
+	leaq	24(%rbp), %rcx
+	cmpq	%rcx, %rbx
+	jne	.L64
+	leaq	28(%rbp), %rbx
+	jmp	.L59
+.L64:
+	leaq	30(%rbp), %rcx
+	cmpq	%rcx, %rbx
+	jne	.L65
+	leaq	-31(%rbp), %rbx
+	movq	%rdx, %rbp
+	jmp	.L59
+.L65:
+	addq	$2, %rbx
+	jmp	.L59
+.L61:
+	orb	$64, 0(%rbp)
+	movq	%rdx, %rax
+	popq	%rdx
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	vdisk_directory_entry, .-vdisk_directory_entry
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"BOOT"
+	.text
+	.type	vdisk_microsoft, @function
+vdisk_microsoft:
+	pushq	%rax
+	movq	%rdx, %rdi
+	call	vdisk_empty_dir
+	movl	vdisk_dir_clusters(%rip), %r8d
+	xorl	%edx, %edx
+	popq	%r9
+	movq	%rax, %rdi
+	movl	$16, %ecx
+	leaq	.LC0(%rip), %rsi
+	addl	$2, %r8d
+	jmp	vdisk_directory_entry
+	.size	vdisk_microsoft, .-vdisk_microsoft
+	.section	.rodata.str1.1
+.LC1:
+	.string	"MICROSOFT"
+	.text
+	.type	vdisk_efi, @function
+vdisk_efi:
+	pushq	%rax
+	movq	%rdx, %rdi
+	call	vdisk_empty_dir
+	movl	vdisk_dir_clusters(%rip), %r8d
+	xorl	%edx, %edx
+	movl	$16, %ecx
+	movq	%rax, %rdi
+	leaq	.LC0(%rip), %rsi
+	addl	$2, %r8d
+	call	vdisk_directory_entry
+	imull	$6, vdisk_dir_clusters(%rip), %r8d
+	xorl	%edx, %edx
+	popq	%r9
+	movq	%rax, %rdi
+	movl	$16, %ecx
+	leaq	.LC1(%rip), %rsi
+	addl	$2, %r8d
+	jmp	vdisk_directory_entry
+	.size	vdisk_efi, .-vdisk_efi
+	.section	.rodata.str1.1
+.LC2:
+	.string	"FONTS"
+.LC3:
+	.string	"RESOURCES"
+	.text
+	.type	vdisk_boot, @function
+vdisk_boot:
+	pushq	%rax
+	movq	%rdx, %rdi
+	call	vdisk_empty_dir
+	imull	$3, vdisk_dir_clusters(%rip), %r8d
+	xorl	%edx, %edx
+	movl	$16, %ecx
+	movq	%rax, %rdi
+	leaq	.LC2(%rip), %rsi
+	addl	$2, %r8d
+	call	vdisk_directory_entry
+	movl	$16, %ecx
+	xorl	%edx, %edx
+	leaq	.LC3(%rip), %rsi
+	movq	%rax, %rdi
+	movl	vdisk_dir_clusters(%rip), %eax
+	popq	%r9
+	leal	2(,%rax,4), %r8d
+	jmp	vdisk_directory_entry
+	.size	vdisk_boot, .-vdisk_boot
+	.section	.rodata.str1.1
+.LC4:
+	.string	"SOURCES"
+.LC5:
+	.string	"EFI"
+	.text
+	.type	vdisk_root, @function
+vdisk_root:
+	pushq	%rax
+	movq	%rdx, %rdi
+	call	vdisk_empty_dir
+	movl	vdisk_dir_clusters(%rip), %r8d
+	xorl	%edx, %edx
+	movl	$16, %ecx
+	movq	%rax, %rdi
+	leaq	.LC0(%rip), %rsi
+	addl	$2, %r8d
+	call	vdisk_directory_entry
+	movl	$16, %ecx
+	xorl	%edx, %edx
+	leaq	.LC4(%rip), %rsi
+	movq	%rax, %rdi
+	movl	vdisk_dir_clusters(%rip), %eax
+	leal	2(%rax,%rax), %r8d
+	call	vdisk_directory_entry
+	imull	$5, vdisk_dir_clusters(%rip), %r8d
+	xorl	%edx, %edx
+	popq	%r9
+	movq	%rax, %rdi
+	movl	$16, %ecx
+	leaq	.LC5(%rip), %rsi
+	addl	$2, %r8d
+	jmp	vdisk_directory_entry
+	.size	vdisk_root, .-vdisk_root
+	.type	vdisk_fsinfo, @function
+vdisk_fsinfo:
+	pushq	%rbx
+	movq	%rdx, %rbx
+	xorl	%esi, %esi
+	movl	$512, %edx
+	movq	%rbx, %rdi
+	call	memset
+	movl	$1096897106, (%rbx)
+	movl	$1631679090, 484(%rbx)
+	movl	$-1, 492(%rbx)
+	movl	$-1437270016, 508(%rbx)
+	popq	%rbx
+	ret
+	.size	vdisk_fsinfo, .-vdisk_fsinfo
+	.section	.rodata
+.LC6:
+	.string	"wimboot"
+	.string	""
+	.section	.rodata.str1.1
+.LC7:
+	.string	"ntloader  "
+.LC8:
+	.string	"FAT32   "
+	.text
+	.type	vdisk_vbr, @function
+vdisk_vbr:
+	pushq	%rbx
+	movq	%rdx, %rbx
+	xorl	%esi, %esi
+	movl	$512, %edx
+	movq	%rbx, %rdi
+	call	memset
+	movb	$-23, (%rbx)
+	leaq	3(%rbx), %rdi
+	movl	$8, %edx
+	leaq	.LC6(%rip), %rsi
+	call	memcpy
+	movl	$1077936640, 11(%rbx)
+	leaq	71(%rbx), %rdi
+	movabsq	$549772525631, %rax
+	movq	%rax, 24(%rbx)
+	movl	$11, %edx
+	leaq	.LC7(%rip), %rsi
+	movabsq	$2251254352314304, %rax
+	movq	%rax, 32(%rbx)
+	movabsq	$1688854155231234, %rax
+	movw	$256, 15(%rbx)
+	movb	$-8, 21(%rbx)
+	movq	%rax, 44(%rbx)
+	movb	$41, 66(%rbx)
+	movl	$-559038242, 67(%rbx)
+	call	memcpy
+	leaq	82(%rbx), %rdi
+	movl	$8, %edx
+	leaq	.LC8(%rip), %rsi
+	call	memcpy
+	movw	$-21931, 510(%rbx)
+	popq	%rbx
+	ret
+	.size	vdisk_vbr, .-vdisk_vbr
+	.type	vdisk_mbr, @function
+vdisk_mbr:
+	pushq	%rbx
+	movq	%rdx, %rbx
+	xorl	%esi, %esi
+	movl	$512, %edx
+	movq	%rbx, %rdi
+	call	memset
+	movb	$-128, 446(%rbx)
+	movabsq	$-2252074691592064, %rax
+	movb	$12, 450(%rbx)
+	movq	%rax, 454(%rbx)
+	movl	$340985129, 440(%rbx)
+	movw	$-21931, 510(%rbx)
+	popq	%rbx
+	ret
+	.size	vdisk_mbr, .-vdisk_mbr
+	.section	.rodata.str1.1
+.LC9:
+	.string	"File too large: %s\n"
+.LC10:
+	.string	"Too many files\n"
+	.text
+	.type	vdisk_layout, @function
+vdisk_layout:
+	pushq	%rdx
+	movq	48(%rdi), %rdx
+	xorl	%eax, %eax
+	movq	%rdi, %rsi
+	movl	vdisk_file_shift(%rip), %ecx
+	movl	$1, %r9d
+	testl	$511, %edx
+	setne	%al
+	shrq	$9, %rdx
+	addq	%rdx, %rax
+	xorl	%edx, %edx
+.L87:
+	movq	%r9, %rdi
+	salq	%cl, %rdi
+	cmpl	$22, %ecx
+	jbe	.L83
+	testb	%dl, %dl
+	je	.L84
+	movl	%ecx, vdisk_file_shift(%rip)
+.L84:
+	cmpq	%rax, %rdi
+	jnb	.L86
+	leaq	.LC9(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L83:
+	leal	1(%rcx), %r8d
+	cmpq	%rax, %rdi
+	jnb	.L102
+	movl	%r8d, %ecx
+	movb	$1, %dl
+	jmp	.L87
+.L102:
+	testb	%dl, %dl
+	je	.L86
+	movl	%ecx, vdisk_file_shift(%rip)
+.L86:
+	movl	vdisk_file_count(%rip), %edx
+	movq	%rdx, %rax
+	salq	%cl, %rdx
+	movl	$4294443072, %ecx
+	addq	$8388608, %rdx
+	cmpq	%rdx, %rcx
+	jnb	.L90
+.L91:
+	leaq	.LC10(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L90:
+	addl	$64, %eax
+	movl	%eax, %edx
+	andl	$-64, %eax
+	shrl	$6, %edx
+	movl	%eax, %esi
+	movl	%edx, vdisk_dir_clusters(%rip)
+	imulq	$7, %rsi, %rdx
+	addq	$524352, %rdx
+	cmpq	$8388608, %rdx
+	ja	.L91
+	leaq	vdisk_regions(%rip), %rdx
+	movl	$524352, %ecx
+	leaq	vdisk_dir_files(%rip), %r8
+	decl	%eax
+	leaq	760(%rdx), %rdi
+.L95:
+	cmpq	$524351, 8(%rdx)
+	jbe	.L94
+	cmpq	%r8, 24(%rdx)
+	jne	.L93
+	leaq	1(%rcx), %r9
+	movl	%eax, 16(%rdx)
+	addq	%rsi, %rcx
+	movq	%r9, 8(%rdx)
+	jmp	.L94
+.L93:
+	movq	%rcx, 8(%rdx)
+.L94:
+	addq	$40, %rdx
+	cmpq	%rdi, %rdx
+	jne	.L95
+	popq	%rax
+	ret
+	.size	vdisk_layout, .-vdisk_layout
+	.type	vdisk_resources, @function
+vdisk_resources:
+	movq	%rdx, %rdi
+	jmp	vdisk_empty_dir
+	.size	vdisk_resources, .-vdisk_resources
+	.type	vdisk_fonts, @function
+vdisk_fonts:
+	movq	%rdx, %rdi
+	jmp	vdisk_empty_dir
+	.size	vdisk_fonts, .-vdisk_fonts
+	.type	vdisk_dir_files, @function
+vdisk_dir_files:
+	movl	%esi, %esi
+	pushq	%r12
+	leaq	(%rsi,%rdi), %r12
+	pushq	%rbp
+	movq	%rdx, %rbp
+	pushq	%rbx
+	movq	%rdi, %rbx
+.L106:
+	cmpq	%rbx, %r12
+	je	.L110
+	movq	%rbp, %rdi
+	call	vdisk_empty_dir
+	movl	vdisk_dir_clusters(%rip), %ecx
+	xorl	%edx, %edx
+	leal	-524352(%rbx), %eax
+	sall	$6, %ecx
+	divl	%ecx
+	leal	-1(%rdx), %r8d
+	cmpl	vdisk_file_count(%rip), %r8d
+	jnb	.L107
+	movl	%r8d, %edi
+	call	vdisk_file_at
+	cmpq	$0, 56(%rax)
+	movq	%rax, %rsi
+	je	.L107
+	movl	vdisk_file_shift(%rip), %eax
+	movq	48(%rsi), %rdx
+	leaq	480(%rbp), %rdi
+	leal	-6(%rax), %ecx
+	sall	%cl, %r8d
+	movl	$1, %ecx
+	addl	$122881, %r8d
+	call	vdisk_directory_entry
+.L107:
+	incq	%rbx
+	addq	$512, %rbp
+	jmp	.L106
+.L110:
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	vdisk_dir_files, .-vdisk_dir_files
+	.globl	vdisk_read
+	.hidden	vdisk_read
+	.type	vdisk_read, @function
+vdisk_read:
+	pushq	%r14
+	movl	%esi, %esi
+	pushq	%r13
+	leaq	(%rsi,%rdi), %r14
+	movq	%rdi, %r13
+	pushq	%r12
+	leaq	vdisk_regions(%rip), %r12
+	pushq	%rbp
+	movq	%rdx, %rbp
+	pushq	%rbx
+.L121:
+	movl	%r13d, %ecx
+	cmpq	$8388607, %r13
+	jbe	.L122
+	movl	vdisk_file_shift(%rip), %ecx
+	leaq	-8388608(%r13), %rax
+	movl	vdisk_file_count(%rip), %edx
+	shrq	%cl, %rax
+	leaq	1(%rax), %rbx
+	salq	%cl, %rbx
+	addq	$8388608, %rbx
+	cmpq	%r14, %rbx
+	cmova	%r14, %rbx
+	subl	%r13d, %ebx
+	cmpq	%rdx, %rax
+	jnb	.L114
+	leaq	vdisk_file(%rip), %r8
+	jmp	.L113
+.L122:
+	movl	$19, %edi
+	xorl	%eax, %eax
+.L115:
+	cmpl	%edi, %eax
+	jnb	.L128
+	leal	(%rdi,%rax), %edx
+	shrl	%edx
+	movl	%edx, %esi
+	imulq	$40, %rsi, %rsi
+	movl	16(%r12,%rsi), %r8d
+	addq	8(%r12,%rsi), %r8
+	cmpq	%r8, %r13
+	jb	.L124
+	leal	1(%rdx), %eax
+	jmp	.L115
+.L124:
+	movl	%edx, %edi
+	jmp	.L115
+.L128:
+	movl	%r14d, %ebx
+	cmpl	$19, %eax
+	je	.L127
+	imulq	$40, %rax, %rax
+	addq	%r12, %rax
+	movq	8(%rax), %rdx
+	cmpq	%rdx, %r13
+	jnb	.L118
+	cmpq	%r14, %rdx
+	cmova	%r14, %rdx
+	movl	%edx, %ebx
+.L127:
+	subl	%ecx, %ebx
+	jmp	.L114
+.L118:
+	movl	16(%rax), %ebx
+	movq	%r13, %rdi
+	movq	32(%rax), %rsi
+	subq	%rdx, %rdi
+	movq	24(%rax), %r8
+	addq	%rdx, %rbx
+	cmpq	%r14, %rbx
+	cmova	%r14, %rbx
+	subl	%ecx, %ebx
+	movl	%ebx, %edx
+	sall	$9, %edx
+	testq	%rsi, %rsi
+	jne	.L119
+	testq	%r8, %r8
+	jne	.L113
+	jmp	.L114
+.L119:
+	salq	$9, %rdi
+	addq	%rdi, %rsi
+	movq	%rbp, %rdi
+	call	memcpy
+	jmp	.L120
+.L113:
+	movq	%rbp, %rdx
+	movl	%ebx, %esi
+	movq	%r13, %rdi
+	call	*%r8
+	jmp	.L120
+.L114:
+	movl	%ebx, %edx
+	xorl	%esi, %esi
+	movq	%rbp, %rdi
+	sall	$9, %edx
+	call	memset
+.L120:
+	movl	%ebx, %eax
+	sall	$9, %ebx
+	addq	%rax, %r13
+	addq	%rbx, %rbp
+	cmpq	%r13, %r14
+	jne	.L121
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	vdisk_read, .-vdisk_read
+	.section	.rodata.str1.1
+.LC11:
+	.string	"...building directories on demand\n"
+.LC12:
+	.string	"...prebuilt directories at %p len %#zx\n"
+	.text
+	.globl	vdisk_finalise
+	.hidden	vdisk_finalise
+	.type	vdisk_finalise, @function
+vdisk_finalise:
+	pushq	%r15
+	xorl	%ecx, %ecx
+	leaq	vdisk_dir_files(%rip), %rsi
+	pushq	%r14
+	pushq	%r13
+	xorl	%r13d, %r13d
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	leaq	vdisk_regions(%rip), %rbx
+	leaq	760(%rbx), %r12
+	movq	%rbx, %rax
+	subq	$24, %rsp
+.L131:
+	cmpq	$524351, 8(%rax)
+	jbe	.L130
+	movl	16(%rax), %edx
+	sall	$9, %edx
+	cmpq	%rsi, 24(%rax)
+	je	.L137
+	addq	%rdx, %rcx
+	jmp	.L130
+.L137:
+	movq	%rdx, %r13
+.L130:
+	addq	$40, %rax
+	cmpq	%r12, %rax
+	jne	.L131
+	leaq	0(%r13,%rcx), %rax
+	xorl	%r15d, %r15d
+	leaq	vdisk_dir_files(%rip), %r13
+	movq	%rax, %rdi
+	movq	%rax, 8(%rsp)
+	call	malloc
+	movq	%rax, %rbp
+	movq	%rax, %r14
+	testq	%rax, %rax
+	jne	.L132
+	addq	$24, %rsp
+	leaq	.LC11(%rip), %rdi
+	xorl	%eax, %eax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	jmp	printf
+.L132:
+	movq	8(%rbx), %rdi
+	cmpq	$524351, %rdi
+	jbe	.L135
+	movq	24(%rbx), %rax
+	cmpq	%r13, %rax
+	jne	.L134
+	testq	%r15, %r15
+	je	.L134
+	movq	%r15, 32(%rbx)
+	jmp	.L135
+.L134:
+	movq	%r14, %rdx
+	movl	16(%rbx), %esi
+	call	*%rax
+	movl	16(%rbx), %eax
+	cmpq	%r13, 24(%rbx)
+	movq	%r14, 32(%rbx)
+	cmove	%r14, %r15
+	sall	$9, %eax
+	addq	%rax, %r14
+.L135:
+	addq	$40, %rbx
+	cmpq	%r12, %rbx
+	jne	.L132
+	movq	8(%rsp), %rdx
+	addq	$24, %rsp
+	movq	%rbp, %rsi
+	leaq	.LC12(%rip), %rdi
+	popq	%rbx
+	xorl	%eax, %eax
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	jmp	printf
+	.size	vdisk_finalise, .-vdisk_finalise
+	.globl	vdisk_get_file
+	.hidden	vdisk_get_file
+	.type	vdisk_get_file, @function
+vdisk_get_file:
+	cmpl	vdisk_file_count(%rip), %edi
+	jnb	.L151
+	jmp	vdisk_file_at
+.L151:
+	xorl	%eax, %eax
+	ret
+	.size	vdisk_get_file, .-vdisk_get_file
+	.section	.rodata.str1.1
+.LC13:
+	.string	"Out of memory\n"
+.LC14:
+	.string	"%s"
+.LC15:
+	.string	"Using %s via %p len %#zx\n"
+	.text
+	.globl	vdisk_add_file
+	.hidden	vdisk_add_file
+	.type	vdisk_add_file, @function
+vdisk_add_file:
+	pushq	%r15
+	pushq	%r14
+	movq	%rcx, %r14
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	movq	%rdx, %rbp
+	pushq	%rbx
+	subq	$40, %rsp
+	movl	vdisk_file_count(%rip), %eax
+	movq	%rdi, 24(%rsp)
+	movl	%eax, %r12d
+	movq	%rsi, 16(%rsp)
+	shrl	$6, %r12d
+	cmpl	vdisk_file_max_chunks(%rip), %r12d
+	movl	%eax, 12(%rsp)
+	jb	.L153
+	leal	1(%r12), %edi
+	movq	%rdi, %r15
+	salq	$3, %rdi
+	call	malloc
+	movl	$9216, %edi
+	movq	%rax, %rbx
+	call	malloc
+	movq	%rax, %r13
+	testq	%rbx, %rbx
+	je	.L157
+	testq	%rax, %rax
+	jne	.L154
+.L157:
+	leaq	.LC13(%rip), %rdi
+	xorl	%eax, %eax
+	call	die
+.L154:
+	movl	vdisk_file_max_chunks(%rip), %edx
+	movq	vdisk_file_chunks(%rip), %rsi
+	movq	%rbx, %rdi
+	salq	$3, %rdx
+	call	memcpy
+	movq	%r13, %rdi
+	movl	$9216, %edx
+	xorl	%esi, %esi
+	call	memset
+	movq	vdisk_file_chunks(%rip), %rdi
+	leaq	vdisk_first_chunk(%rip), %rax
+	movq	%r13, (%rbx,%r12,8)
+	cmpq	%rax, %rdi
+	je	.L156
+	call	free
+.L156:
+	movq	%rbx, vdisk_file_chunks(%rip)
+	movl	%r15d, vdisk_file_max_chunks(%rip)
+.L153:
+	movl	12(%rsp), %edi
+	incl	vdisk_file_count(%rip)
+	movl	$32, %esi
+	call	vdisk_file_at
+	movq	24(%rsp), %rcx
+	leaq	.LC14(%rip), %rdx
+	movq	%rax, %rbx
+	movq	%rax, %rdi
+	xorl	%eax, %eax
+	call	snprintf
+	movq	16(%rsp), %rax
+	movq	%rbp, 40(%rbx)
+	movq	%rbx, %rdi
+	movq	%rbp, 48(%rbx)
+	movq	%rax, 32(%rbx)
+	movq	%r14, 56(%rbx)
+	call	vdisk_layout
+	movq	16(%rsp), %rdx
+	movq	%rbp, %rcx
+	movq	%rbx, %rsi
+	leaq	.LC15(%rip), %rdi
+	xorl	%eax, %eax
+	call	printf
+	addq	$40, %rsp
+	movq	%rbx, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	popq	%r15
+	ret
+	.size	vdisk_add_file, .-vdisk_add_file
+	.section	.rodata.str1.1
+.LC16:
+	.string	"Patching %s in %d ranges\n"
+	.text
+	.globl	vdisk_patch_file
+	.hidden	vdisk_patch_file
+	.type	vdisk_patch_file, @function
+vdisk_patch_file:
+	pushq	%rbx
+	xorl	%edx, %edx
+	movq	%rdi, %rbx
+	movq	%rsi, %rax
+	movq	%rsi, 64(%rdi)
+	xorl	%ecx, %ecx
+	xorl	%esi, %esi
+	movl	%edx, 136(%rdi)
+	xorl	%edx, %edx
+	call	*%rax
+	movq	%rbx, %rdi
+	call	vdisk_layout
+	movl	136(%rbx), %edx
+	movq	%rbx, %rsi
+	xorl	%eax, %eax
+	leaq	.LC16(%rip), %rdi
+	popq	%rbx
+	jmp	printf
+	.size	vdisk_patch_file, .-vdisk_patch_file
+	.globl	vdisk_patch_range
+	.hidden	vdisk_patch_range
+	.type	vdisk_patch_range, @function
+vdisk_patch_range:
+	pushq	%r13
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	subq	$104, %rsp
+	movq	__stack_chk_guard(%rip), %rcx
+	movq	%rcx, 88(%rsp)
+	xorl	%ecx, %ecx
+	testq	%rdx, %rdx
+	je	.L161
+	leaq	72(%rdi), %rcx
+	movq	%rdi, %r12
+	movq	%rsi, %rax
+	addq	%rsi, %rdx
+	movl	136(%rdi), %r10d
+	xorl	%esi, %esi
+	movq	%rcx, %rdi
+	movq	%rcx, %rbp
+.L163:
+	cmpl	%esi, %r10d
+	je	.L186
+	movq	8(%rdi), %r8
+	cmpq	%rax, %r8
+	jb	.L164
+	movq	(%rdi), %r9
+	cmpq	%r9, %rdx
+	jb	.L164
+	cmpq	%r9, %rax
+	cmova	%r9, %rax
+	cmpq	%r8, %rdx
+	cmovb	%r8, %rdx
+.L164:
+	incl	%esi
+	addq	$16, %rdi
+	jmp	.L163
+.L186:
+	xorl	%r8d, %r8d
+	xorl	%ebx, %ebx
+.L166:
+	cmpl	%r8d, %esi
+	je	.L187
+	movq	(%rcx), %rdi
+	cmpq	%rax, %rdi
+	jb	.L167
+	cmpq	8(%rcx), %rdx
+	jnb	.L168
+	cmpq	%rdi, %rax
+	jnb	.L167
+	testl	%ebx, %ebx
+	je	.L169
+	leal	-1(%rbx), %edi
+	salq	$4, %rdi
+	cmpq	%rax, (%rsp,%rdi)
+	jnb	.L167
+.L169:
+	movl	%ebx, %edi
+	incl	%ebx
+	salq	$4, %rdi
+	movq	%rax, (%rsp,%rdi)
+	movq	%rdx, 8(%rsp,%rdi)
+.L167:
+	movl	%ebx, %edi
+	movups	(%rcx), %xmm0
+	incl	%ebx
+	salq	$4, %rdi
+	movaps	%xmm0, (%rsp,%rdi)
+.L168:
+	incl	%r8d
+	addq	$16, %rcx
+	jmp	.L166
+.L187:
+	testl	%ebx, %ebx
+	movq	%rsp, %r13
+	jne	.L171
+	movq	%rax, (%rsp)
+	movl	$1, %ebx
+	movq	%rdx, 8(%rsp)
+	jmp	.L172
+.L171:
+	leal	-1(%rbx), %ecx
+	salq	$4, %rcx
+	cmpq	%rax, (%rsp,%rcx)
+	jnb	.L173
+	movl	%ebx, %ecx
+	incl	%ebx
+	salq	$4, %rcx
+	movq	%rax, (%rsp,%rcx)
+	movq	%rdx, 8(%rsp,%rcx)
+.L173:
+	cmpl	$4, %ebx
+	jbe	.L172
+	decl	%ebx
+	movq	%r13, %rcx
+	movl	$1, %edx
+	xorl	%eax, %eax
+.L175:
+	leal	1(%rax), %esi
+	movl	%eax, %r8d
+	movq	32(%rcx), %rdi
+	subq	24(%rcx), %rdi
+	salq	$4, %rsi
+	salq	$4, %r8
+	movl	%edx, %r9d
+	incl	%edx
+	movq	(%rsp,%rsi), %rsi
+	subq	8(%rsp,%r8), %rsi
+	cmpq	%rsi, %rdi
+	cmovb	%r9d, %eax
+	addq	$16, %rcx
+	cmpl	%ebx, %edx
+	jb	.L175
+	leal	1(%rax), %edi
+	movl	%eax, %edx
+	movl	$4, %ebx
+	salq	$4, %rdi
+	salq	$4, %rdx
+	leal	2(%rax), %esi
+	movq	8(%rsp,%rdi), %rcx
+	salq	$4, %rsi
+	addq	%r13, %rdi
+	addq	%r13, %rsi
+	movq	%rcx, 8(%rsp,%rdx)
+	movl	$3, %edx
+	subl	%eax, %edx
+	salq	$4, %rdx
+	call	memmove
+.L172:
+	movl	%ebx, %edx
+	movq	%r13, %rsi
+	movq	%rbp, %rdi
+	salq	$4, %rdx
+	call	memcpy
+	movl	%ebx, 136(%r12)
+.L161:
+	movq	88(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L176
+	call	__stack_chk_fail@PLT
+.L176:
+	addq	$104, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	ret
+	.size	vdisk_patch_range, .-vdisk_patch_range
+	.section	.rodata.str1.1
+.LC17:
+	.string	"MBR"
+.LC18:
+	.string	"VBR"
+.LC19:
+	.string	"FSInfo"
+.LC20:
+	.string	"VBR Backup"
+.LC21:
+	.string	"FAT"
+.LC22:
+	.string	"Root subdirs"
+.LC23:
+	.string	"Root files"
+.LC24:
+	.string	"Boot subdirs"
+.LC25:
+	.string	"Boot files"
+.LC26:
+	.string	"Sources subdirs"
+.LC27:
+	.string	"Sources files"
+.LC28:
+	.string	"Fonts subdirs"
+.LC29:
+	.string	"Fonts files"
+.LC30:
+	.string	"Resources subdirs"
+.LC31:
+	.string	"Resources files"
+.LC32:
+	.string	"EFI subdirs"
+.LC33:
+	.string	"EFI files"
+.LC34:
+	.string	"Microsoft subdirs"
+.LC35:
+	.string	"Microsoft files"
+	.section	.data.rel.local,"aw"
+	.align 32
+	.type	vdisk_regions, @object
+	.size	vdisk_regions, 760
+vdisk_regions:
+	.quad	.LC17
+	.quad	0
+	.long	1
+	.zero	4
+	.quad	vdisk_mbr
+	.zero	8
+	.quad	.LC18
+	.quad	128
+	.long	1
+	.zero	4
+	.quad	vdisk_vbr
+	.zero	8
+	.quad	.LC19
+	.quad	129
+	.long	1
+	.zero	4
+	.quad	vdisk_fsinfo
+	.zero	8
+	.quad	.LC20
+	.quad	134
+	.long	1
+	.zero	4
+	.quad	vdisk_vbr
+	.zero	8
+	.quad	.LC21
+	.quad	192
+	.long	524160
+	.zero	4
+	.quad	vdisk_fat
+	.zero	8
+	.quad	.LC22
+	.quad	524352
+	.long	1
+	.zero	4
+	.quad	vdisk_root
+	.zero	8
+	.quad	.LC23
+	.quad	524353
+	.long	63
+	.zero	4
+	.quad	vdisk_dir_files
+	.zero	8
+	.quad	.LC24
+	.quad	524416
+	.long	1
+	.zero	4
+	.quad	vdisk_boot
+	.zero	8
+	.quad	.LC25
+	.quad	524417
+	.long	63
+	.zero	4
+	.quad	vdisk_dir_files
+	.zero	8
+	.quad	.LC26
+	.quad	524480
+	.long	1
+	.zero	4
+	.quad	vdisk_sources
+	.zero	8
+	.quad	.LC27
+	.quad	524481
+	.long	63
+	.zero	4
+	.quad	vdisk_dir_files
+	.zero	8
+	.quad	.LC28
+	.quad	524544
+	.long	1
+	.zero	4
+	.quad	vdisk_fonts
+	.zero	8
+	.quad	.LC29
+	.quad	524545
+	.long	63
+	.zero	4
+	.quad	vdisk_dir_files
+	.zero	8
+	.quad	.LC30
+	.quad	524608
+	.long	1
+	.zero	4
+	.quad	vdisk_resources
+	.zero	8
+	.quad	.LC31
+	.quad	524609
+	.long	63
+	.zero	4
+	.quad	vdisk_dir_files
+	.zero	8
+	.quad	.LC32
+	.quad	524672
+	.long	1
+	.zero	4
+	.quad	vdisk_efi
+	.zero	8
+	.quad	.LC33
+	.quad	524673
+	.long	63
+	.zero	4
+	.quad	vdisk_dir_files
+	.zero	8
+	.quad	.LC34
+	.quad	524736
+	.long	1
+	.zero	4
+	.quad	vdisk_microsoft
+	.zero	8
+	.quad	.LC35
+	.quad	524737
+	.long	63
+	.zero	4
+	.quad	vdisk_dir_files
+	.zero	8
+	.data
+	.align 4
+	.type	vdisk_dir_clusters, @object
+	.size	vdisk_dir_clusters, 4
+vdisk_dir_clusters:
+	.long	1
+	.align 4
+	.type	vdisk_file_shift, @object
+	.size	vdisk_file_shift, 4
+vdisk_file_shift:
+	.long	6
+	.local	vdisk_file_count
+	.comm	vdisk_file_count,4,4
+	.align 4
+	.type	vdisk_file_max_chunks, @object
+	.size	vdisk_file_max_chunks, 4
+vdisk_file_max_chunks:
+	.long	1
+	.section	.data.rel.local
+	.align 8
+	.type	vdisk_file_chunks, @object
+	.size	vdisk_file_chunks, 8
+vdisk_file_chunks:
+	.quad	vdisk_first_chunk
+	.align 8
+	.type	vdisk_first_chunk, @object
+	.size	vdisk_first_chunk, 8
+vdisk_first_chunk:
+	.quad	vdisk_first_files
+	.local	vdisk_first_files
+	.comm	vdisk_first_files,9216,32
+	.hidden	memmove
+	.hidden	snprintf
+	.hidden	free
+	.hidden	printf
+	.hidden	malloc
+	.hidden	die
+	.hidden	memcpy
+	.hidden	memset
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -1,5 +1,6 @@
 # Objects
 OBJECTS += posix/stdio.o
+OBJECTS += posix/stdlib.o
 OBJECTS += posix/string.o
 OBJECTS += posix/vsprintf.o
 OBJECTS += posix/libgcc.o
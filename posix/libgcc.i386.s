@@ -0,0 +1,85 @@
+	.file	"libgcc.c"
+	.text
+	.globl	__udivmoddi4
+	.hidden	__udivmoddi4
+	.type	__udivmoddi4, @function
+__udivmoddi4:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%edi
+	pushl	%esi
+	pushl	%ebx
+	subl	$20, %esp
+	movl	8(%ebp), %eax
+	movl	12(%ebp), %edx
+	movl	%eax, -24(%ebp)
+	movl	%edx, -20(%ebp)
+	movl	16(%ebp), %eax
+	movl	20(%ebp), %edx
+	movl	%edx, %ebx
+	orl	%eax, %ebx
+	je	.L2
+	movl	$1, %esi
+	xorl	%edi, %edi
+.L3:
+	testl	%edx, %edx
+	js	.L15
+	addl	%eax, %eax
+	adcl	%edx, %edx
+	movl	%esi, %ecx
+	movl	%edi, %ebx
+	addl	%esi, %ecx
+	adcl	%edi, %ebx
+	movl	%ecx, %esi
+	movl	%ebx, %edi
+	jmp	.L3
+.L15:
+	xorl	%ecx, %ecx
+	movl	%ecx, -32(%ebp)
+	movl	%ecx, -28(%ebp)
+.L5:
+	movl	%edi, %ebx
+	orl	%esi, %ebx
+	je	.L16
+	cmpl	%eax, -24(%ebp)
+	movl	-20(%ebp), %ebx
+	sbbl	%edx, %ebx
+	jc	.L6
+	subl	%eax, -24(%ebp)
+	sbbl	%edx, -20(%ebp)
+	addl	%esi, -32(%ebp)
+	adcl	%edi, -28(%ebp)
+.L6:
+	shrdl	$1, %edx, %eax
+	shrl	%edx
+	movl	%esi, %ecx
+	movl	%edi, %ebx
+	shrdl	$1, %ebx, %ecx
+	shrl	%ebx
+	movl	%ecx, %esi
+	movl	%ebx, %edi
+	jmp	.L5
+.L16:
+	cmpl	$0, 24(%ebp)
+	jne	.L8
+.L9:
+	movl	-32(%ebp), %eax
+	movl	-28(%ebp), %edx
+	jmp	.L2
+.L8:
+	movl	24(%ebp), %eax
+	movl	-24(%ebp), %edx
+	movl	-20(%ebp), %ecx
+	movl	%edx, (%eax)
+	movl	%ecx, 4(%eax)
+	jmp	.L9
+.L2:
+	addl	$20, %esp
+	popl	%ebx
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	ret
+	.size	__udivmoddi4, .-__udivmoddi4
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
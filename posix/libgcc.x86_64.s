@@ -0,0 +1,4 @@
+	.file	"libgcc.c"
+	.text
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
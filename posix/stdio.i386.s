@@ -0,0 +1,127 @@
+	.file	"stdio.c"
+	.text
+	.globl	putchar
+	.hidden	putchar
+	.type	putchar, @function
+putchar:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%esi
+	pushl	%ebx
+	subl	$80, %esp
+	movl	8(%ebp), %ebx
+	movl	__stack_chk_guard, %eax
+	movl	%eax, -12(%ebp)
+	xorl	%eax, %eax
+	cmpl	$10, %ebx
+	jne	.L2
+	subl	$12, %esp
+	pushl	$13
+	call	putchar
+	addl	$16, %esp
+.L2:
+	movl	%ebx, %eax
+#APP
+# 50 "posix/stdio.c" 1
+	outb %al, $0xe9
+# 0 "" 2
+#NO_APP
+	movl	efi_systab, %eax
+	testl	%eax, %eax
+	je	.L3
+	movl	44(%eax), %eax
+	movw	%bx, -16(%ebp)
+	movw	$0, -14(%ebp)
+	pushl	%edx
+	pushl	%edx
+	leal	-16(%ebp), %edx
+	pushl	%edx
+	pushl	%eax
+	call	*4(%eax)
+	jmp	.L7
+.L3:
+	pushl	%eax
+	pushl	$64
+	pushl	$0
+	leal	-80(%ebp), %esi
+	pushl	%esi
+	call	memset
+	movl	$16, -80(%ebp)
+	orb	$14, %bh
+	movl	%ebx, -76(%ebp)
+	movl	$7, -72(%ebp)
+	movl	%esi, (%esp)
+	call	call_interrupt
+.L7:
+	addl	$16, %esp
+	movl	-12(%ebp), %eax
+	subl	__stack_chk_guard, %eax
+	je	.L5
+	call	__stack_chk_fail
+.L5:
+	xorl	%eax, %eax
+	leal	-8(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%ebp
+	ret
+	.size	putchar, .-putchar
+	.globl	getchar
+	.hidden	getchar
+	.type	getchar, @function
+getchar:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%esi
+	pushl	%ebx
+	subl	$80, %esp
+	movl	__stack_chk_guard, %eax
+	movl	%eax, -12(%ebp)
+	movl	efi_systab, %eax
+	testl	%eax, %eax
+	leal	-76(%ebp), %ebx
+	je	.L10
+	movl	36(%eax), %esi
+	pushl	%edx
+	movl	60(%eax), %eax
+	leal	-80(%ebp), %edx
+	pushl	%edx
+	leal	8(%esi), %edx
+	pushl	%edx
+	pushl	$1
+	call	*60(%eax)
+	popl	%ecx
+	popl	%eax
+	pushl	%ebx
+	pushl	%esi
+	call	*4(%esi)
+	movzwl	-74(%ebp), %eax
+	jmp	.L14
+.L10:
+	pushl	%eax
+	pushl	$64
+	pushl	$0
+	pushl	%ebx
+	call	memset
+	movl	$22, -76(%ebp)
+	movl	%ebx, (%esp)
+	call	call_interrupt
+	movzbl	-72(%ebp), %eax
+.L14:
+	addl	$16, %esp
+	movl	-12(%ebp), %edx
+	subl	__stack_chk_guard, %edx
+	je	.L12
+	call	__stack_chk_fail
+.L12:
+	leal	-8(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%ebp
+	ret
+	.size	getchar, .-getchar
+	.hidden	call_interrupt
+	.hidden	memset
+	.hidden	efi_systab
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
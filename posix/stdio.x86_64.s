@@ -0,0 +1,97 @@
+	.file	"stdio.c"
+	.text
+	.globl	putchar
+	.hidden	putchar
+	.type	putchar, @function
+putchar:
+	pushq	%rbx
+	movl	%edi, %ebx
+	subq	$80, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 72(%rsp)
+	xorl	%eax, %eax
+	cmpl	$10, %edi
+	jne	.L2
+	movl	$13, %edi
+	call	putchar
+.L2:
+	movl	%ebx, %eax
+#APP
+# 50 "posix/stdio.c" 1
+	outb %al, $0xe9
+# 0 "" 2
+#NO_APP
+	movq	efi_systab(%rip), %rax
+	testq	%rax, %rax
+	je	.L3
+	movq	64(%rax), %rax
+	movw	%bx, 68(%rsp)
+	leaq	68(%rsp), %rdx
+	subq	$32, %rsp
+	movw	$0, 102(%rsp)
+	movq	%rax, %rcx
+	call	*8(%rax)
+	addq	$32, %rsp
+	jmp	.L4
+.L3:
+	leaq	4(%rsp), %rdi
+	movl	$64, %edx
+	xorl	%esi, %esi
+	call	memset
+.L4:
+	movq	72(%rsp), %rax
+	subq	__stack_chk_guard(%rip), %rax
+	je	.L5
+	call	__stack_chk_fail@PLT
+.L5:
+	addq	$80, %rsp
+	xorl	%eax, %eax
+	popq	%rbx
+	ret
+	.size	putchar, .-putchar
+	.globl	getchar
+	.hidden	getchar
+	.type	getchar, @function
+getchar:
+	pushq	%rbx
+	subq	$80, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 72(%rsp)
+	movq	efi_systab(%rip), %rax
+	leaq	8(%rsp), %r8
+	testq	%rax, %rax
+	je	.L9
+	movq	48(%rax), %rbx
+	movq	96(%rax), %rax
+	subq	$32, %rsp
+	movl	$1, %ecx
+	leaq	16(%rbx), %rdx
+	call	*96(%rax)
+	addq	$32, %rsp
+	movq	%rbx, %rcx
+	leaq	4(%rsp), %rdx
+	subq	$32, %rsp
+	call	*8(%rbx)
+	movzwl	38(%rsp), %eax
+	addq	$32, %rsp
+	jmp	.L8
+.L9:
+	movl	$64, %edx
+	xorl	%esi, %esi
+	movq	%r8, %rdi
+	call	memset
+	movzbl	12(%rsp), %eax
+.L8:
+	movq	72(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L11
+	call	__stack_chk_fail@PLT
+.L11:
+	addq	$80, %rsp
+	popq	%rbx
+	ret
+	.size	getchar, .-getchar
+	.hidden	memset
+	.hidden	efi_systab
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,190 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Memory allocation
+ *
+ * Under UEFI, allocations come from the firmware pool.  Under BIOS
+ * there is no allocator to borrow, so allocations are carved from a
+ * fixed heap within our own .bss (which is already described to
+ * bootmgr.exe as in use).  Allocation failure is reported by
+ * returning NULL; callers are expected to fall back gracefully.
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ntloader.h"
+#include "efi.h"
+
+/** A heap block header */
+struct heap_block
+{
+    /** Usable length */
+    size_t len;
+    /** Padding (to keep the payload 8-byte aligned) */
+    size_t pad;
+};
+
+/** Heap block alignment */
+#define HEAP_ALIGN 16
+
+#ifdef __i386__
+
+/** BIOS heap size */
+#define HEAP_SIZE 0x10000
+
+/** BIOS heap */
+static uint8_t heap[HEAP_SIZE] __attribute__ ((aligned (HEAP_ALIGN)));
+
+/** Used length of BIOS heap */
+static size_t heap_used;
+
+/**
+ * Check if block is the most recent BIOS heap allocation
+ *
+ * @v block		Block header
+ * @ret is_last		Block is the most recent allocation
+ */
+static int heap_is_last (struct heap_block *block)
+{
+    size_t end = ((((uint8_t *) (block + 1)) - heap) + block->len);
+
+    return (((end + HEAP_ALIGN - 1) & ~(HEAP_ALIGN - 1)) == heap_used);
+}
+
+#endif
+
+/**
+ * Get block header
+ *
+ * @v ptr		Allocated memory
+ * @ret block		Block header
+ */
+static inline struct heap_block *heap_block (void *ptr)
+{
+    return (((struct heap_block *) ptr) - 1);
+}
+
+/**
+ * Allocate memory
+ *
+ * @v len		Length
+ * @ret ptr		Allocated memory, or NULL on failure
+ */
+void *malloc (size_t len)
+{
+    struct heap_block *block;
+    size_t total = (sizeof (*block) + len);
+    void *mem = NULL;
+
+    if (efi_systab)
+    {
+        if (efi_systab->BootServices->AllocatePool (EfiLoaderData, total,
+                                                   &mem) != 0)
+            return NULL;
+    }
+    else
+    {
+#ifdef __i386__
+        total = ((total + HEAP_ALIGN - 1) & ~(HEAP_ALIGN - 1));
+        if (total > (HEAP_SIZE - heap_used))
+            return NULL;
+        mem = (heap + heap_used);
+        heap_used += total;
+#endif
+    }
+    if (! mem)
+        return NULL;
+
+    block = mem;
+    block->len = len;
+    return (block + 1);
+}
+
+/**
+ * Free memory
+ *
+ * @v ptr		Allocated memory (or NULL)
+ *
+ * Under BIOS, only the most recent allocation is actually returned to
+ * the heap.
+ */
+void free (void *ptr)
+{
+    struct heap_block *block;
+
+    if (! ptr)
+        return;
+    block = heap_block (ptr);
+
+    if (efi_systab)
+    {
+        efi_systab->BootServices->FreePool (block);
+        return;
+    }
+#ifdef __i386__
+    if (heap_is_last (block))
+        heap_used = (((uint8_t *) block) - heap);
+#endif
+}
+
+/**
+ * Reallocate memory
+ *
+ * @v ptr		Allocated memory (or NULL)
+ * @v len		New length
+ * @ret ptr		Reallocated memory, or NULL on failure
+ *
+ * On failure, the original allocation is left untouched.
+ */
+void *realloc (void *ptr, size_t len)
+{
+    struct heap_block *block;
+    void *new;
+
+    if (! ptr)
+        return malloc (len);
+    block = heap_block (ptr);
+
+#ifdef __i386__
+    /* Grow or shrink the most recent BIOS allocation in place */
+    if ((! efi_systab) && heap_is_last (block))
+    {
+        size_t total = ((((uint8_t *) ptr) - heap) + len);
+
+        total = ((total + HEAP_ALIGN - 1) & ~(HEAP_ALIGN - 1));
+        if (total > HEAP_SIZE)
+            return NULL;
+        heap_used = total;
+        block->len = len;
+        return ptr;
+    }
+#endif
+
+    new = malloc (len);
+    if (! new)
+        return NULL;
+    memcpy (new, ptr, ((block->len < len) ? block->len : len));
+    free (ptr);
+    return new;
+}
@@ -0,0 +1,172 @@
+	.file	"stdlib.c"
+	.text
+	.globl	malloc
+	.hidden	malloc
+	.type	malloc, @function
+malloc:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%ebx
+	subl	$20, %esp
+	movl	8(%ebp), %ebx
+	movl	__stack_chk_guard, %eax
+	movl	%eax, -12(%ebp)
+	xorl	%eax, %eax
+	xorl	%ecx, %ecx
+	movl	%ecx, -16(%ebp)
+	movl	efi_systab, %eax
+	testl	%eax, %eax
+	je	.L2
+	pushl	%edx
+	movl	60(%eax), %eax
+	leal	-16(%ebp), %edx
+	pushl	%edx
+	leal	8(%ebx), %edx
+	pushl	%edx
+	pushl	$2
+	call	*44(%eax)
+	addl	$16, %esp
+	testl	%eax, %eax
+	je	.L3
+.L5:
+	xorl	%eax, %eax
+	jmp	.L1
+.L2:
+	leal	23(%ebx), %edx
+	andl	$-16, %edx
+	movl	heap_used, %eax
+	movl	$65536, %ecx
+	subl	%eax, %ecx
+	cmpl	%edx, %ecx
+	jb	.L5
+	leal	heap(%eax), %ecx
+	movl	%ecx, -16(%ebp)
+	addl	%edx, %eax
+	movl	%eax, heap_used
+.L3:
+	movl	-16(%ebp), %eax
+	testl	%eax, %eax
+	je	.L5
+	movl	%ebx, (%eax)
+	addl	$8, %eax
+.L1:
+	movl	-12(%ebp), %edx
+	subl	__stack_chk_guard, %edx
+	je	.L6
+	call	__stack_chk_fail
+.L6:
+	movl	-4(%ebp), %ebx
+	leave
+	ret
+	.size	malloc, .-malloc
+	.globl	free
+	.hidden	free
+	.type	free, @function
+free:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	8(%ebp), %eax
+	testl	%eax, %eax
+	je	.L15
+	leal	-8(%eax), %edx
+	movl	efi_systab, %ecx
+	testl	%ecx, %ecx
+	je	.L17
+	movl	60(%ecx), %eax
+	movl	%edx, 8(%ebp)
+	movl	48(%eax), %eax
+	popl	%ebp
+	jmp	*%eax
+.L17:
+	addl	-8(%eax), %eax
+	subl	$heap-15, %eax
+	andl	$-16, %eax
+	cmpl	heap_used, %eax
+	jne	.L15
+	subl	$heap, %edx
+	movl	%edx, heap_used
+.L15:
+	popl	%ebp
+	ret
+	.size	free, .-free
+	.globl	realloc
+	.hidden	realloc
+	.type	realloc, @function
+realloc:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%edi
+	pushl	%esi
+	pushl	%ebx
+	subl	$12, %esp
+	movl	8(%ebp), %ebx
+	movl	12(%ebp), %edi
+	testl	%ebx, %ebx
+	jne	.L23
+	movl	%edi, 8(%ebp)
+	leal	-12(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	jmp	malloc
+.L23:
+	cmpl	$0, efi_systab
+	jne	.L24
+	movl	%ebx, %edx
+	subl	$heap, %edx
+	movl	-8(%ebx), %eax
+	leal	15(%edx,%eax), %eax
+	andl	$-16, %eax
+	cmpl	heap_used, %eax
+	jne	.L24
+	leal	15(%edx,%edi), %eax
+	andl	$-16, %eax
+	cmpl	$65536, %eax
+	ja	.L25
+	movl	%eax, heap_used
+	movl	%edi, -8(%ebx)
+	movl	%ebx, %esi
+	jmp	.L22
+.L24:
+	subl	$12, %esp
+	pushl	%edi
+	call	malloc
+	movl	%eax, %esi
+	addl	$16, %esp
+	testl	%eax, %eax
+	jne	.L27
+.L25:
+	xorl	%esi, %esi
+	jmp	.L22
+.L27:
+	pushl	%eax
+	movl	-8(%ebx), %eax
+	cmpl	%eax, %edi
+	jnb	.L28
+	movl	%edi, %eax
+.L28:
+	pushl	%eax
+	pushl	%ebx
+	pushl	%esi
+	call	memcpy
+	movl	%ebx, (%esp)
+	call	free
+	addl	$16, %esp
+.L22:
+	movl	%esi, %eax
+	leal	-12(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	ret
+	.size	realloc, .-realloc
+	.local	heap_used
+	.comm	heap_used,4,4
+	.local	heap
+	.comm	heap,65536,16
+	.hidden	memcpy
+	.hidden	efi_systab
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,108 @@
+	.file	"stdlib.c"
+	.text
+	.globl	malloc
+	.hidden	malloc
+	.type	malloc, @function
+malloc:
+	pushq	%rbx
+	movq	%rdi, %rbx
+	xorl	%edi, %edi
+	subq	$16, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 8(%rsp)
+	xorl	%eax, %eax
+	movq	efi_systab(%rip), %rax
+	movq	%rdi, (%rsp)
+	testq	%rax, %rax
+	jne	.L2
+.L5:
+	movq	(%rsp), %rax
+	testq	%rax, %rax
+	jne	.L14
+	jmp	.L3
+.L2:
+	movq	96(%rax), %rax
+	subq	$32, %rsp
+	leaq	16(%rbx), %rdx
+	movl	$2, %ecx
+	leaq	32(%rsp), %r8
+	call	*64(%rax)
+	addq	$32, %rsp
+	testq	%rax, %rax
+	je	.L5
+.L3:
+	xorl	%eax, %eax
+	jmp	.L1
+.L14:
+	movq	%rbx, (%rax)
+	addq	$16, %rax
+.L1:
+	movq	8(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L7
+	call	__stack_chk_fail@PLT
+.L7:
+	addq	$16, %rsp
+	popq	%rbx
+	ret
+	.size	malloc, .-malloc
+	.globl	free
+	.hidden	free
+	.type	free, @function
+free:
+	testq	%rdi, %rdi
+	je	.L26
+	movq	efi_systab(%rip), %rax
+	testq	%rax, %rax
+	je	.L26
+	subq	$40, %rsp
+	movq	96(%rax), %rax
+	leaq	-16(%rdi), %rcx
+	call	*72(%rax)
+	addq	$40, %rsp
+	ret
+.L26:
+	ret
+	.size	free, .-free
+	.globl	realloc
+	.hidden	realloc
+	.type	realloc, @function
+realloc:
+	pushq	%r12
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rsi, %rbx
+	testq	%rdi, %rdi
+	jne	.L30
+	popq	%rbx
+	movq	%rsi, %rdi
+	popq	%rbp
+	popq	%r12
+	jmp	malloc
+.L30:
+	movq	%rdi, %rbp
+	movq	%rsi, %rdi
+	call	malloc
+	movq	%rax, %r12
+	testq	%rax, %rax
+	je	.L29
+	movq	-16(%rbp), %rax
+	movq	%r12, %rdi
+	movq	%rbp, %rsi
+	cmpq	%rax, %rbx
+	cmovbe	%rbx, %rax
+	movq	%rax, %rdx
+	call	memcpy
+	movq	%rbp, %rdi
+	call	free
+.L29:
+	movq	%r12, %rax
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	ret
+	.size	realloc, .-realloc
+	.hidden	memcpy
+	.hidden	efi_systab
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,455 @@
+	.file	"string.c"
+	.text
+	.globl	memcpy
+	.hidden	memcpy
+	.type	memcpy, @function
+memcpy:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%edi
+	pushl	%esi
+	movl	8(%ebp), %eax
+	movl	16(%ebp), %edx
+	movl	%edx, %ecx
+	shrl	$2, %ecx
+	movl	%eax, %edi
+	movl	12(%ebp), %esi
+#APP
+# 50 "posix/string.c" 1
+	rep movsl
+# 0 "" 2
+#NO_APP
+	andl	$3, %edx
+	movl	%edx, %ecx
+#APP
+# 55 "posix/string.c" 1
+	rep movsb
+# 0 "" 2
+#NO_APP
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	ret
+	.size	memcpy, .-memcpy
+	.globl	memmove
+	.hidden	memmove
+	.type	memmove, @function
+memmove:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%edi
+	pushl	%esi
+	movl	8(%ebp), %eax
+	movl	12(%ebp), %esi
+	movl	16(%ebp), %edx
+	cmpl	%eax, %esi
+	jb	.L4
+	movl	%edx, %ecx
+	shrl	$2, %ecx
+	movl	%eax, %edi
+#APP
+# 50 "posix/string.c" 1
+	rep movsl
+# 0 "" 2
+#NO_APP
+	andl	$3, %edx
+	movl	%edx, %ecx
+#APP
+# 55 "posix/string.c" 1
+	rep movsb
+# 0 "" 2
+#NO_APP
+	jmp	.L5
+.L4:
+	leal	-1(%edx), %ecx
+	leal	(%eax,%ecx), %edi
+	addl	%ecx, %esi
+	movl	%edx, %ecx
+#APP
+# 83 "posix/string.c" 1
+	pushf
+	cli
+	std
+	rep movsb
+	popf
+	
+# 0 "" 2
+#NO_APP
+.L5:
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	ret
+	.size	memmove, .-memmove
+	.globl	memset
+	.hidden	memset
+	.type	memset, @function
+memset:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%ebx
+	movl	8(%ebp), %edx
+	movl	16(%ebp), %ecx
+	addl	%edx, %ecx
+	movl	%edx, %eax
+.L9:
+	cmpl	%ecx, %eax
+	je	.L12
+	incl	%eax
+	movb	12(%ebp), %bl
+	movb	%bl, -1(%eax)
+	jmp	.L9
+.L12:
+	movl	%edx, %eax
+	popl	%ebx
+	popl	%ebp
+	ret
+	.size	memset, .-memset
+	.globl	memcmp
+	.hidden	memcmp
+	.type	memcmp, @function
+memcmp:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%esi
+	pushl	%ebx
+	movl	8(%ebp), %edx
+	movl	12(%ebp), %ecx
+	movl	16(%ebp), %esi
+	addl	%edx, %esi
+.L14:
+	cmpl	%esi, %edx
+	je	.L18
+	incl	%edx
+	movzbl	-1(%edx), %eax
+	movzbl	(%ecx), %ebx
+	incl	%ecx
+	subl	%ebx, %eax
+	je	.L14
+	jmp	.L13
+.L18:
+	xorl	%eax, %eax
+.L13:
+	popl	%ebx
+	popl	%esi
+	popl	%ebp
+	ret
+	.size	memcmp, .-memcmp
+	.globl	strcmp
+	.hidden	strcmp
+	.type	strcmp, @function
+strcmp:
+	pushl	%ebp
+	movl	%esp, %ebp
+	xorl	%edx, %edx
+.L21:
+	movl	8(%ebp), %eax
+	movsbl	(%eax,%edx), %eax
+	movl	12(%ebp), %ecx
+	movsbl	(%ecx,%edx), %ecx
+	testl	%eax, %eax
+	je	.L20
+	incl	%edx
+	cmpl	%ecx, %eax
+	je	.L21
+.L20:
+	subl	%ecx, %eax
+	popl	%ebp
+	ret
+	.size	strcmp, .-strcmp
+	.globl	strcasecmp
+	.hidden	strcasecmp
+	.type	strcasecmp, @function
+strcasecmp:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%esi
+	pushl	%ebx
+	xorl	%ecx, %ecx
+.L32:
+	movl	8(%ebp), %eax
+	movsbl	(%eax,%ecx), %eax
+	movl	12(%ebp), %esi
+	movsbl	(%esi,%ecx), %edx
+	leal	-97(%edx), %ebx
+	leal	-97(%eax), %esi
+	cmpl	$25, %esi
+	ja	.L28
+	subl	$32, %eax
+	cmpl	$25, %ebx
+	ja	.L29
+	subl	$32, %edx
+	jmp	.L29
+.L28:
+	cmpl	$25, %ebx
+	ja	.L30
+	subl	$32, %edx
+.L30:
+	testl	%eax, %eax
+	je	.L31
+.L29:
+	incl	%ecx
+	cmpl	%eax, %edx
+	je	.L32
+.L31:
+	subl	%edx, %eax
+	popl	%ebx
+	popl	%esi
+	popl	%ebp
+	ret
+	.size	strcasecmp, .-strcasecmp
+	.globl	wcscasecmp
+	.hidden	wcscasecmp
+	.type	wcscasecmp, @function
+wcscasecmp:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%esi
+	pushl	%ebx
+	xorl	%ecx, %ecx
+.L43:
+	movl	8(%ebp), %eax
+	movzwl	(%eax,%ecx), %eax
+	movl	12(%ebp), %esi
+	movzwl	(%esi,%ecx), %edx
+	leal	-97(%edx), %ebx
+	leal	-97(%eax), %esi
+	cmpl	$25, %esi
+	ja	.L39
+	subl	$32, %eax
+	cmpl	$25, %ebx
+	ja	.L40
+	subl	$32, %edx
+	jmp	.L40
+.L39:
+	cmpl	$25, %ebx
+	ja	.L41
+	subl	$32, %edx
+.L41:
+	testl	%eax, %eax
+	je	.L42
+.L40:
+	addl	$2, %ecx
+	cmpl	%eax, %edx
+	je	.L43
+.L42:
+	subl	%edx, %eax
+	popl	%ebx
+	popl	%esi
+	popl	%ebp
+	ret
+	.size	wcscasecmp, .-wcscasecmp
+	.globl	strlen
+	.hidden	strlen
+	.type	strlen, @function
+strlen:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	8(%ebp), %edx
+	xorl	%eax, %eax
+.L50:
+	cmpb	$0, (%edx,%eax)
+	je	.L53
+	incl	%eax
+	jmp	.L50
+.L53:
+	popl	%ebp
+	ret
+	.size	strlen, .-strlen
+	.globl	wcslen
+	.hidden	wcslen
+	.type	wcslen, @function
+wcslen:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	8(%ebp), %edx
+	xorl	%eax, %eax
+.L55:
+	cmpw	$0, (%edx,%eax,2)
+	je	.L58
+	incl	%eax
+	jmp	.L55
+.L58:
+	popl	%ebp
+	ret
+	.size	wcslen, .-wcslen
+	.globl	strchr
+	.hidden	strchr
+	.type	strchr, @function
+strchr:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%ebx
+	movl	12(%ebp), %ecx
+	movl	8(%ebp), %eax
+.L61:
+	movsbl	(%eax), %ebx
+	cmpl	%ecx, %ebx
+	je	.L59
+	incl	%eax
+	testb	%bl, %bl
+	jne	.L61
+	xorl	%eax, %eax
+.L59:
+	popl	%ebx
+	popl	%ebp
+	ret
+	.size	strchr, .-strchr
+	.globl	strrchr
+	.hidden	strrchr
+	.type	strrchr, @function
+strrchr:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%ebx
+	movl	8(%ebp), %eax
+	xorl	%edx, %edx
+.L66:
+	movsbl	(%eax), %ebx
+	movl	%ebx, %ecx
+	cmpl	12(%ebp), %ebx
+	jne	.L65
+	movl	%eax, %edx
+.L65:
+	incl	%eax
+	testb	%cl, %cl
+	jne	.L66
+	movl	%edx, %eax
+	popl	%ebx
+	popl	%ebp
+	ret
+	.size	strrchr, .-strrchr
+	.globl	wcschr
+	.hidden	wcschr
+	.type	wcschr, @function
+wcschr:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	12(%ebp), %ecx
+	movl	8(%ebp), %eax
+.L72:
+	movw	(%eax), %dx
+	cmpw	%cx, %dx
+	je	.L70
+	addl	$2, %eax
+	testw	%dx, %dx
+	jne	.L72
+	xorl	%eax, %eax
+.L70:
+	popl	%ebp
+	ret
+	.size	wcschr, .-wcschr
+	.globl	isspace
+	.hidden	isspace
+	.type	isspace, @function
+isspace:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	8(%ebp), %eax
+	cmpl	$13, %eax
+	jg	.L76
+	cmpl	$8, %eax
+	setg	%al
+	jmp	.L79
+.L76:
+	cmpl	$32, %eax
+	sete	%al
+.L79:
+	movzbl	%al, %eax
+	popl	%ebp
+	ret
+	.size	isspace, .-isspace
+	.globl	strtoul
+	.hidden	strtoul
+	.type	strtoul, @function
+strtoul:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%edi
+	pushl	%esi
+	pushl	%ebx
+	subl	$12, %esp
+	movl	8(%ebp), %edx
+	movl	12(%ebp), %esi
+	movl	16(%ebp), %ecx
+.L81:
+	movsbl	(%edx), %eax
+	movl	%eax, %ebx
+	subl	$12, %esp
+	pushl	%eax
+	call	isspace
+	addl	$16, %esp
+	movl	%eax, %edi
+	testl	%eax, %eax
+	je	.L102
+	incl	%edx
+	jmp	.L81
+.L102:
+	cmpb	$43, %bl
+	jne	.L83
+	incl	%edx
+	jmp	.L84
+.L83:
+	cmpb	$45, %bl
+	jne	.L84
+	incl	%edx
+	movl	$1, %edi
+.L84:
+	movb	(%edx), %al
+	testl	%ecx, %ecx
+	jne	.L85
+	movl	$10, %ecx
+	cmpb	$48, %al
+	jne	.L85
+	movb	1(%edx), %al
+	orl	$32, %eax
+	cmpb	$120, %al
+	je	.L86
+	incl	%edx
+	movl	$8, %ecx
+	jmp	.L85
+.L86:
+	addl	$2, %edx
+	movl	$16, %ecx
+.L85:
+	xorl	%eax, %eax
+.L91:
+	movsbl	(%edx), %ebx
+	cmpl	$96, %ebx
+	jbe	.L87
+	subl	$87, %ebx
+	jmp	.L88
+.L87:
+	cmpl	$64, %ebx
+	jbe	.L89
+	subl	$55, %ebx
+	jmp	.L88
+.L89:
+	cmpl	$57, %ebx
+	ja	.L88
+	subl	$48, %ebx
+.L88:
+	cmpl	%ecx, %ebx
+	jnb	.L90
+	imull	%ecx, %eax
+	addl	%ebx, %eax
+	incl	%edx
+	jmp	.L91
+.L90:
+	testl	%esi, %esi
+	je	.L92
+	movl	%edx, (%esi)
+.L92:
+	testl	%edi, %edi
+	je	.L80
+	negl	%eax
+.L80:
+	leal	-12(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	ret
+	.size	strtoul, .-strtoul
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,335 @@
+	.file	"string.c"
+	.text
+	.globl	memcpy
+	.hidden	memcpy
+	.type	memcpy, @function
+memcpy:
+	movq	%rdx, %rcx
+	movq	%rdi, %rax
+	shrq	$2, %rcx
+#APP
+# 50 "posix/string.c" 1
+	rep movsl
+# 0 "" 2
+#NO_APP
+	andl	$3, %edx
+	movq	%rdx, %rcx
+#APP
+# 55 "posix/string.c" 1
+	rep movsb
+# 0 "" 2
+#NO_APP
+	ret
+	.size	memcpy, .-memcpy
+	.globl	memmove
+	.hidden	memmove
+	.type	memmove, @function
+memmove:
+	movq	%rdi, %rax
+	cmpq	%rdi, %rsi
+	jb	.L3
+	movq	%rdx, %rcx
+	shrq	$2, %rcx
+#APP
+# 50 "posix/string.c" 1
+	rep movsl
+# 0 "" 2
+#NO_APP
+	andl	$3, %edx
+	movq	%rdx, %rcx
+#APP
+# 55 "posix/string.c" 1
+	rep movsb
+# 0 "" 2
+#NO_APP
+	ret
+.L3:
+	leaq	-1(%rdx), %rcx
+	leaq	(%rdi,%rcx), %rdi
+	addq	%rcx, %rsi
+	movq	%rdx, %rcx
+#APP
+# 83 "posix/string.c" 1
+	pushf
+	cli
+	std
+	rep movsb
+	popf
+	
+# 0 "" 2
+#NO_APP
+	ret
+	.size	memmove, .-memmove
+	.globl	memset
+	.hidden	memset
+	.type	memset, @function
+memset:
+	movq	%rdi, %rax
+	xorl	%ecx, %ecx
+.L7:
+	cmpq	%rcx, %rdx
+	je	.L9
+	movb	%sil, (%rax,%rcx)
+	incq	%rcx
+	jmp	.L7
+.L9:
+	ret
+	.size	memset, .-memset
+	.globl	memcmp
+	.hidden	memcmp
+	.type	memcmp, @function
+memcmp:
+	xorl	%ecx, %ecx
+.L11:
+	cmpq	%rdx, %rcx
+	je	.L14
+	movzbl	(%rdi,%rcx), %eax
+	movzbl	(%rsi,%rcx), %r8d
+	incq	%rcx
+	subl	%r8d, %eax
+	je	.L11
+	jmp	.L10
+.L14:
+	xorl	%eax, %eax
+.L10:
+	ret
+	.size	memcmp, .-memcmp
+	.globl	strcmp
+	.hidden	strcmp
+	.type	strcmp, @function
+strcmp:
+	xorl	%edx, %edx
+.L16:
+	movsbl	(%rdi,%rdx), %eax
+	movsbl	(%rsi,%rdx), %ecx
+	incq	%rdx
+	testl	%eax, %eax
+	je	.L18
+	cmpl	%ecx, %eax
+	je	.L16
+.L18:
+	subl	%ecx, %eax
+	ret
+	.size	strcmp, .-strcmp
+	.globl	strcasecmp
+	.hidden	strcasecmp
+	.type	strcasecmp, @function
+strcasecmp:
+	xorl	%ecx, %ecx
+.L26:
+	movsbl	(%rdi,%rcx), %eax
+	leal	-97(%rax), %edx
+	cmpl	$25, %edx
+	ja	.L24
+	subl	$32, %eax
+.L24:
+	movsbl	(%rsi,%rcx), %edx
+	leal	-97(%rdx), %r8d
+	cmpl	$25, %r8d
+	ja	.L25
+	subl	$32, %edx
+.L25:
+	incq	%rcx
+	testl	%eax, %eax
+	je	.L28
+	cmpl	%eax, %edx
+	je	.L26
+.L28:
+	subl	%edx, %eax
+	ret
+	.size	strcasecmp, .-strcasecmp
+	.globl	wcscasecmp
+	.hidden	wcscasecmp
+	.type	wcscasecmp, @function
+wcscasecmp:
+	xorl	%ecx, %ecx
+.L36:
+	movzwl	(%rdi,%rcx), %eax
+	leal	-97(%rax), %edx
+	cmpl	$25, %edx
+	ja	.L34
+	subl	$32, %eax
+.L34:
+	movzwl	(%rsi,%rcx), %edx
+	leal	-97(%rdx), %r8d
+	cmpl	$25, %r8d
+	ja	.L35
+	subl	$32, %edx
+.L35:
+	addq	$2, %rcx
+	testl	%eax, %eax
+	je	.L38
+	cmpl	%eax, %edx
+	je	.L36
+.L38:
+	subl	%edx, %eax
+	ret
+	.size	wcscasecmp, .-wcscasecmp
+	.globl	strlen
+	.hidden	strlen
+	.type	strlen, @function
+strlen:
+	xorl	%eax, %eax
+.L44:
+	cmpb	$0, (%rdi,%rax)
+	je	.L46
+	incq	%rax
+	jmp	.L44
+.L46:
+	ret
+	.size	strlen, .-strlen
+	.globl	wcslen
+	.hidden	wcslen
+	.type	wcslen, @function
+wcslen:
+	xorl	%eax, %eax
+.L48:
+	cmpw	$0, (%rdi,%rax,2)
+	je	.L50
+	incq	%rax
+	jmp	.L48
+.L50:
+	ret
+	.size	wcslen, .-wcslen
+	.globl	strchr
+	.hidden	strchr
+	.type	strchr, @function
+strchr:
+	movq	%rdi, %rax
+.L53:
+	movsbl	(%rax), %ecx
+	cmpl	%esi, %ecx
+	je	.L51
+	incq	%rax
+	testb	%cl, %cl
+	jne	.L53
+	xorl	%eax, %eax
+.L51:
+	ret
+	.size	strchr, .-strchr
+	.globl	strrchr
+	.hidden	strrchr
+	.type	strrchr, @function
+strrchr:
+	xorl	%eax, %eax
+.L57:
+	movsbl	(%rdi), %ecx
+	cmpl	%esi, %ecx
+	cmove	%rdi, %rax
+	incq	%rdi
+	testb	%cl, %cl
+	jne	.L57
+	ret
+	.size	strrchr, .-strrchr
+	.globl	wcschr
+	.hidden	wcschr
+	.type	wcschr, @function
+wcschr:
+	movq	%rdi, %rax
+.L62:
+	movw	(%rax), %dx
+	cmpw	%si, %dx
+	je	.L60
+	addq	$2, %rax
+	testw	%dx, %dx
+	jne	.L62
+	xorl	%eax, %eax
+.L60:
+	ret
+	.size	wcschr, .-wcschr
+	.globl	isspace
+	.hidden	isspace
+	.type	isspace, @function
+isspace:
+	cmpl	$13, %edi
+	jg	.L65
+	cmpl	$8, %edi
+	setg	%al
+	jmp	.L67
+.L65:
+	cmpl	$32, %edi
+	sete	%al
+.L67:
+	movzbl	%al, %eax
+	ret
+	.size	isspace, .-isspace
+	.globl	strtoul
+	.hidden	strtoul
+	.type	strtoul, @function
+strtoul:
+	movq	%rdi, %rcx
+	movq	%rsi, %r8
+.L69:
+	movsbl	(%rcx), %edi
+	call	isspace
+	movl	%edi, %esi
+	movl	%eax, %edi
+	testl	%eax, %eax
+	je	.L89
+	incq	%rcx
+	jmp	.L69
+.L89:
+	cmpb	$43, %sil
+	jne	.L71
+	incq	%rcx
+	jmp	.L72
+.L71:
+	cmpb	$45, %sil
+	jne	.L72
+	incq	%rcx
+	movl	$1, %edi
+.L72:
+	movb	(%rcx), %al
+	testl	%edx, %edx
+	jne	.L73
+	movl	$10, %edx
+	cmpb	$48, %al
+	jne	.L73
+	movb	1(%rcx), %al
+	orl	$32, %eax
+	cmpb	$120, %al
+	je	.L74
+	incq	%rcx
+	movl	$8, %edx
+	jmp	.L73
+.L74:
+	addq	$2, %rcx
+	movl	$16, %edx
+.L73:
+	xorl	%eax, %eax
+	movslq	%edx, %r9
+.L79:
+	movsbl	(%rcx), %esi
+	cmpl	$96, %esi
+	jbe	.L75
+	subl	$87, %esi
+	jmp	.L76
+.L75:
+	cmpl	$64, %esi
+	jbe	.L77
+	subl	$55, %esi
+	jmp	.L76
+.L77:
+	cmpl	$57, %esi
+	ja	.L76
+	subl	$48, %esi
+.L76:
+	cmpl	%edx, %esi
+	jnb	.L78
+	imulq	%r9, %rax
+	incq	%rcx
+	addq	%rsi, %rax
+	jmp	.L79
+.L78:
+	testq	%r8, %r8
+	je	.L80
+	movq	%rcx, (%r8)
+.L80:
+	testl	%edi, %edi
+	je	.L68
+	negq	%rax
+.L68:
+	ret
+	.size	strtoul, .-strtoul
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,578 @@
+	.file	"vsprintf.c"
+	.text
+	.type	cputchar, @function
+cputchar:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%ebx
+	subl	$12, %esp
+	movl	%eax, %ebx
+	pushl	%edx
+	pushl	%eax
+	call	*(%eax)
+	incl	4(%ebx)
+	addl	$16, %esp
+	movl	-4(%ebp), %ebx
+	leave
+	ret
+	.size	cputchar, .-cputchar
+	.type	printf_sputc, @function
+printf_sputc:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	8(%ebp), %eax
+	movl	4(%eax), %edx
+	cmpl	12(%eax), %edx
+	jnb	.L3
+	movl	8(%eax), %eax
+	movl	12(%ebp), %ecx
+	movb	%cl, (%eax,%edx)
+.L3:
+	popl	%ebp
+	ret
+	.size	printf_sputc, .-printf_sputc
+	.type	printf_putchar, @function
+printf_putchar:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	12(%ebp), %eax
+	movl	%eax, 8(%ebp)
+	popl	%ebp
+	jmp	putchar
+	.size	printf_putchar, .-printf_putchar
+	.globl	__udivdi3
+	.globl	__udivmoddi4
+	.type	format_decimal.constprop.0, @function
+format_decimal.constprop.0:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%edi
+	pushl	%esi
+	pushl	%ebx
+	subl	$60, %esp
+	movl	%eax, -44(%ebp)
+	movl	%edx, %eax
+	movl	%ecx, %edx
+	movl	12(%ebp), %ecx
+	movl	%ecx, %edi
+	andl	$16, %edi
+	movl	%edi, -36(%ebp)
+	movl	%edi, %esi
+	orl	$32, %esi
+	movl	%esi, -48(%ebp)
+	andb	$2, %cl
+	je	.L16
+	testl	%edx, %edx
+	jns	.L16
+	negl	%eax
+	adcl	$0, %edx
+	negl	%edx
+	movl	$1, -40(%ebp)
+	jmp	.L10
+.L16:
+	xorl	%ecx, %ecx
+	movl	%ecx, -40(%ebp)
+.L10:
+	movl	-44(%ebp), %ebx
+.L11:
+	movl	%eax, %esi
+	movl	%edx, -60(%ebp)
+	leal	-32(%ebp), %ecx
+	subl	$12, %esp
+	pushl	%ecx
+	pushl	$0
+	pushl	$10
+	pushl	%edx
+	pushl	%eax
+	call	__udivmoddi4
+	addl	$32, %esp
+	movl	%eax, -56(%ebp)
+	movl	%edx, -52(%ebp)
+	movl	%ebx, %ecx
+	decl	%ebx
+	movb	-32(%ebp), %al
+	leal	48(%eax), %edi
+	movl	%edi, %eax
+	movb	%al, (%ebx)
+	movl	-56(%ebp), %eax
+	movl	-52(%ebp), %edx
+	movl	$9, %edi
+	cmpl	%esi, %edi
+	movl	$0, %esi
+	sbbl	-60(%ebp), %esi
+	jc	.L11
+	movb	-40(%ebp), %al
+	andl	$1, %eax
+	cmpl	$0, -36(%ebp)
+	jne	.L13
+	testb	%al, %al
+	je	.L13
+	movb	$45, -1(%ebx)
+	leal	-2(%ecx), %ebx
+.L13:
+	movl	-44(%ebp), %edx
+	subl	%ebx, %edx
+	cmpl	8(%ebp), %edx
+	jge	.L34
+	decl	%ebx
+	movb	-48(%ebp), %dl
+	movb	%dl, (%ebx)
+	jmp	.L13
+.L34:
+	cmpl	$0, -36(%ebp)
+	je	.L9
+	testb	%al, %al
+	je	.L9
+	movb	$45, (%ebx)
+.L9:
+	movl	%ebx, %eax
+	leal	-12(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	ret
+	.size	format_decimal.constprop.0, .-format_decimal.constprop.0
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"<NULL>"
+.LC1:
+	.string	"0123456789ABCDEF"
+	.text
+	.globl	vcprintf
+	.hidden	vcprintf
+	.type	vcprintf, @function
+vcprintf:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%edi
+	pushl	%esi
+	pushl	%ebx
+	subl	$92, %esp
+	movl	8(%ebp), %eax
+	movl	%eax, -80(%ebp)
+	movl	12(%ebp), %esi
+	movl	16(%ebp), %ebx
+	movl	__stack_chk_guard, %eax
+	movl	%eax, -28(%ebp)
+	movl	-80(%ebp), %eax
+	xorl	%edx, %edx
+	movl	%edx, 4(%eax)
+.L36:
+	movsbl	(%esi), %edx
+	testb	%dl, %dl
+	je	.L89
+	cmpb	$37, %dl
+	jne	.L37
+	incl	%esi
+	xorl	%eax, %eax
+	movl	%eax, -88(%ebp)
+	jmp	.L38
+.L37:
+	movl	-80(%ebp), %eax
+	call	cputchar
+	movl	%ebx, %edi
+	jmp	.L39
+.L40:
+	cmpb	$48, %al
+	jne	.L78
+	orl	$16, -88(%ebp)
+.L41:
+	incl	%esi
+.L38:
+	movb	(%esi), %al
+	cmpb	$35, %al
+	jne	.L40
+	orl	$2, -88(%ebp)
+	jmp	.L41
+.L78:
+	xorl	%edi, %edi
+	movl	%edi, -76(%ebp)
+.L42:
+	movsbl	(%esi), %eax
+	subl	$48, %eax
+	leal	1(%esi), %edx
+	cmpl	$9, %eax
+	ja	.L79
+	imull	$10, -76(%ebp), %esi
+	addl	%esi, %eax
+	movl	%eax, -76(%ebp)
+	movl	%edx, %esi
+	jmp	.L42
+.L79:
+	movl	$type_sizes+2, %eax
+.L43:
+	movb	(%esi), %dl
+	cmpb	$104, %dl
+	jne	.L44
+	decl	%eax
+	jmp	.L45
+.L44:
+	cmpb	$108, %dl
+	jne	.L46
+	incl	%eax
+	jmp	.L45
+.L46:
+	cmpb	$122, %dl
+	jne	.L47
+	movl	$type_sizes+5, %eax
+.L45:
+	incl	%esi
+	jmp	.L43
+.L47:
+	movb	$0, -29(%ebp)
+	cmpb	$99, %dl
+	jne	.L48
+	movl	(%ebx), %edx
+	leal	4(%ebx), %edi
+	cmpl	$type_sizes+3, %eax
+	jnb	.L49
+	movl	-80(%ebp), %eax
+	call	cputchar
+	jmp	.L80
+.L49:
+	movb	%dl, -60(%ebp)
+	movb	$0, -59(%ebp)
+	leal	-60(%ebp), %ebx
+	jmp	.L53
+.L48:
+	cmpb	$115, %dl
+	jne	.L51
+	leal	4(%ebx), %edi
+	movl	(%ebx), %ebx
+	cmpl	$type_sizes+3, %eax
+	jnb	.L52
+	testl	%ebx, %ebx
+	jne	.L53
+	movl	$.LC0, %ebx
+	jmp	.L53
+.L52:
+	testl	%ebx, %ebx
+	jne	.L54
+.L80:
+	leal	-29(%ebp), %ebx
+	jmp	.L53
+.L51:
+	cmpb	$112, %dl
+	jne	.L55
+	leal	4(%ebx), %edi
+	movl	(%ebx), %eax
+	xorl	%edx, %edx
+	leal	-29(%ebp), %ecx
+.L56:
+	decl	%ecx
+	movl	%eax, %ebx
+	andl	$15, %ebx
+	movb	.LC1(%ebx), %bl
+	orl	$32, %ebx
+	movb	%bl, (%ecx)
+	shrdl	$4, %edx, %eax
+	shrl	$4, %edx
+	movl	%edx, %ebx
+	orl	%eax, %ebx
+	jne	.L56
+	leal	-29(%ebp), %edx
+.L57:
+	movl	%edx, %eax
+	subl	%ecx, %eax
+	cmpl	%eax, -76(%ebp)
+	jle	.L90
+	decl	%ecx
+	movb	$32, (%ecx)
+	jmp	.L57
+.L90:
+	movb	$120, -1(%ecx)
+	leal	-2(%ecx), %ebx
+	movb	$48, -2(%ecx)
+	jmp	.L53
+.L55:
+	movl	%edx, %edi
+	andl	$-33, %edi
+	movl	%edi, %ecx
+	cmpb	$88, %cl
+	jne	.L59
+	andl	$32, %edx
+	movl	-88(%ebp), %edi
+	orl	%edi, %edx
+	movl	%edx, -92(%ebp)
+	cmpb	$7, (%eax)
+	jbe	.L60
+	leal	8(%ebx), %edi
+	movl	(%ebx), %eax
+	movl	4(%ebx), %edx
+	movl	%eax, -88(%ebp)
+	movl	%edx, -84(%ebp)
+	jmp	.L61
+.L60:
+	movl	(%ebx), %eax
+	xorl	%edx, %edx
+	movl	%eax, -88(%ebp)
+	movl	%edx, -84(%ebp)
+	leal	4(%ebx), %edi
+.L61:
+	movl	-92(%ebp), %eax
+	andl	$32, %eax
+	movl	%eax, -96(%ebp)
+	movl	-92(%ebp), %ecx
+	andl	$16, %ecx
+	orl	$32, %ecx
+	movl	%ecx, -100(%ebp)
+	leal	-29(%ebp), %ebx
+.L62:
+	decl	%ebx
+	movl	-88(%ebp), %ecx
+	andl	$15, %ecx
+	movb	-96(%ebp), %al
+	orb	.LC1(%ecx), %al
+	movb	%al, (%ebx)
+	movl	-88(%ebp), %eax
+	movl	-84(%ebp), %edx
+	shrdl	$4, %edx, %eax
+	shrl	$4, %edx
+	movl	%eax, -88(%ebp)
+	movl	%edx, -84(%ebp)
+	movl	-84(%ebp), %eax
+	orl	-88(%ebp), %eax
+	jne	.L62
+	leal	-29(%ebp), %edx
+.L63:
+	movl	%edx, %eax
+	subl	%ebx, %eax
+	cmpl	%eax, -76(%ebp)
+	jle	.L91
+	decl	%ebx
+	movb	-100(%ebp), %al
+	movb	%al, (%ebx)
+	jmp	.L63
+.L91:
+	testb	$2, -92(%ebp)
+	je	.L53
+	movb	-96(%ebp), %al
+	orl	$88, %eax
+	movb	%al, -1(%ebx)
+	movb	$48, -2(%ebx)
+	subl	$2, %ebx
+	jmp	.L53
+.L59:
+	cmpb	$105, %dl
+	je	.L81
+	cmpb	$100, %dl
+	jne	.L66
+.L81:
+	movl	-88(%ebp), %ecx
+	orl	$2, %ecx
+	movb	(%eax), %al
+	cmpb	$7, %al
+	ja	.L88
+	leal	4(%ebx), %edi
+	movl	(%ebx), %eax
+	cltd
+	jmp	.L73
+.L66:
+	cmpb	$117, %dl
+	jne	.L71
+	movl	-88(%ebp), %ecx
+	andl	$-3, %ecx
+	cmpb	$7, (%eax)
+	jbe	.L72
+.L88:
+	leal	8(%ebx), %edi
+	movl	(%ebx), %eax
+	movl	4(%ebx), %edx
+	jmp	.L73
+.L72:
+	movl	(%ebx), %eax
+	xorl	%edx, %edx
+	leal	4(%ebx), %edi
+.L73:
+	pushl	%ebx
+	pushl	%ebx
+	pushl	%ecx
+	pushl	-76(%ebp)
+	movl	%edx, %ecx
+	movl	%eax, %edx
+	leal	-29(%ebp), %eax
+	call	format_decimal.constprop.0
+	movl	%eax, %ebx
+	addl	$16, %esp
+	jmp	.L53
+.L71:
+	movb	%dl, -30(%ebp)
+	movl	%ebx, %edi
+	leal	-30(%ebp), %ebx
+.L53:
+	movsbl	(%ebx), %edx
+	testb	%dl, %dl
+	je	.L39
+	movl	-80(%ebp), %eax
+	call	cputchar
+	incl	%ebx
+	jmp	.L53
+.L54:
+	movw	(%ebx), %dx
+	testw	%dx, %dx
+	je	.L39
+	movb	%dl, -60(%ebp)
+	movsbl	%dl, %edx
+	movl	-80(%ebp), %eax
+	call	cputchar
+	addl	$2, %ebx
+	jmp	.L54
+.L39:
+	incl	%esi
+	movl	%edi, %ebx
+	jmp	.L36
+.L89:
+	movl	-80(%ebp), %eax
+	movl	4(%eax), %eax
+	movl	-28(%ebp), %edx
+	subl	__stack_chk_guard, %edx
+	je	.L77
+	call	__stack_chk_fail
+.L77:
+	leal	-12(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%edi
+	popl	%ebp
+	ret
+	.size	vcprintf, .-vcprintf
+	.globl	vsnprintf
+	.hidden	vsnprintf
+	.type	vsnprintf, @function
+vsnprintf:
+	pushl	%ebp
+	movl	%esp, %ebp
+	pushl	%esi
+	pushl	%ebx
+	subl	$36, %esp
+	movl	8(%ebp), %esi
+	movl	12(%ebp), %ebx
+	movl	__stack_chk_guard, %eax
+	movl	%eax, -12(%ebp)
+	xorl	%eax, %eax
+	movl	$printf_sputc, -28(%ebp)
+	movl	%esi, -20(%ebp)
+	movl	%ebx, -16(%ebp)
+	pushl	20(%ebp)
+	pushl	16(%ebp)
+	leal	-28(%ebp), %eax
+	pushl	%eax
+	call	vcprintf
+	addl	$16, %esp
+	testl	%ebx, %ebx
+	je	.L93
+	decl	%ebx
+	cmpl	%ebx, %eax
+	jnb	.L94
+	movl	%eax, %ebx
+.L94:
+	movb	$0, (%esi,%ebx)
+.L93:
+	movl	-12(%ebp), %edx
+	subl	__stack_chk_guard, %edx
+	je	.L95
+	call	__stack_chk_fail
+.L95:
+	leal	-8(%ebp), %esp
+	popl	%ebx
+	popl	%esi
+	popl	%ebp
+	ret
+	.size	vsnprintf, .-vsnprintf
+	.globl	snprintf
+	.hidden	snprintf
+	.type	snprintf, @function
+snprintf:
+	pushl	%ebp
+	movl	%esp, %ebp
+	subl	$8, %esp
+	leal	20(%ebp), %eax
+	pushl	%eax
+	pushl	16(%ebp)
+	pushl	12(%ebp)
+	pushl	8(%ebp)
+	call	vsnprintf
+	leave
+	ret
+	.size	snprintf, .-snprintf
+	.globl	vssnprintf
+	.hidden	vssnprintf
+	.type	vssnprintf, @function
+vssnprintf:
+	pushl	%ebp
+	movl	%esp, %ebp
+	movl	8(%ebp), %edx
+	movl	12(%ebp), %eax
+	testl	%eax, %eax
+	jns	.L103
+	xorl	%eax, %eax
+.L103:
+	movl	%eax, 12(%ebp)
+	movl	%edx, 8(%ebp)
+	popl	%ebp
+	jmp	vsnprintf
+	.size	vssnprintf, .-vssnprintf
+	.globl	ssnprintf
+	.hidden	ssnprintf
+	.type	ssnprintf, @function
+ssnprintf:
+	pushl	%ebp
+	movl	%esp, %ebp
+	subl	$8, %esp
+	leal	20(%ebp), %eax
+	pushl	%eax
+	pushl	16(%ebp)
+	pushl	12(%ebp)
+	pushl	8(%ebp)
+	call	vssnprintf
+	leave
+	ret
+	.size	ssnprintf, .-ssnprintf
+	.globl	vprintf
+	.hidden	vprintf
+	.type	vprintf, @function
+vprintf:
+	pushl	%ebp
+	movl	%esp, %ebp
+	subl	$28, %esp
+	movl	__stack_chk_guard, %eax
+	movl	%eax, -12(%ebp)
+	xorl	%eax, %eax
+	movl	$printf_putchar, -20(%ebp)
+	pushl	12(%ebp)
+	pushl	8(%ebp)
+	leal	-20(%ebp), %eax
+	pushl	%eax
+	call	vcprintf
+	movl	-12(%ebp), %edx
+	subl	__stack_chk_guard, %edx
+	je	.L108
+	call	__stack_chk_fail
+.L108:
+	leave
+	ret
+	.size	vprintf, .-vprintf
+	.globl	printf
+	.hidden	printf
+	.type	printf, @function
+printf:
+	pushl	%ebp
+	movl	%esp, %ebp
+	subl	$16, %esp
+	leal	12(%ebp), %eax
+	pushl	%eax
+	pushl	8(%ebp)
+	call	vprintf
+	leave
+	ret
+	.size	printf, .-printf
+	.data
+	.align 4
+	.type	type_sizes, @object
+	.size	type_sizes, 6
+type_sizes:
+	.ascii	"\001\002\004\004\b\004"
+	.hidden	putchar
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
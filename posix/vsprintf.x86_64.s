@@ -0,0 +1,667 @@
+	.file	"vsprintf.c"
+	.text
+	.type	cputchar, @function
+cputchar:
+	pushq	%rbx
+	movq	%rdi, %rbx
+	call	*(%rdi)
+	incq	8(%rbx)
+	popq	%rbx
+	ret
+	.size	cputchar, .-cputchar
+	.type	printf_sputc, @function
+printf_sputc:
+	movq	8(%rdi), %rax
+	cmpq	24(%rdi), %rax
+	jnb	.L3
+	movq	16(%rdi), %rdx
+	movb	%sil, (%rdx,%rax)
+.L3:
+	ret
+	.size	printf_sputc, .-printf_sputc
+	.type	printf_putchar, @function
+printf_putchar:
+	movl	%esi, %edi
+	jmp	putchar
+	.size	printf_putchar, .-printf_putchar
+	.type	format_decimal.constprop.0, @function
+format_decimal.constprop.0:
+	movl	%ecx, %r9d
+	pushq	%rbp
+	movq	%rdi, %r8
+	movq	%rsi, %rax
+	andl	$16, %r9d
+	pushq	%rbx
+	movslq	%edx, %rdi
+	movl	%r9d, %r11d
+	orl	$32, %r11d
+	andb	$2, %cl
+	je	.L14
+	testq	%rsi, %rsi
+	jns	.L14
+	negq	%rax
+	movl	$1, %esi
+	jmp	.L8
+.L14:
+	xorl	%esi, %esi
+.L8:
+	movq	%r8, %rcx
+	movl	$10, %ebp
+.L9:
+	xorl	%edx, %edx
+	movq	%rax, %r10
+	movq	%rcx, %rbx
+	decq	%rcx
+	divq	%rbp
+	addl	$48, %edx
+	movb	%dl, (%rcx)
+	cmpq	$9, %r10
+	ja	.L9
+	andl	$1, %esi
+	testl	%r9d, %r9d
+	jne	.L11
+	testb	%sil, %sil
+	je	.L11
+	movb	$45, -1(%rcx)
+	leaq	-2(%rbx), %rcx
+.L11:
+	movq	%r8, %rax
+	subq	%rcx, %rax
+	cmpq	%rdi, %rax
+	jge	.L32
+	decq	%rcx
+	movb	%r11b, (%rcx)
+	jmp	.L11
+.L32:
+	testl	%r9d, %r9d
+	je	.L7
+	testb	%sil, %sil
+	je	.L7
+	movb	$45, (%rcx)
+.L7:
+	movq	%rcx, %rax
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	format_decimal.constprop.0, .-format_decimal.constprop.0
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"<NULL>"
+.LC1:
+	.string	"0123456789ABCDEF"
+	.text
+	.globl	vcprintf
+	.hidden	vcprintf
+	.type	vcprintf, @function
+vcprintf:
+	pushq	%r14
+	leaq	3+type_sizes(%rip), %r14
+	pushq	%r13
+	movq	%rdi, %r13
+	pushq	%r12
+	movq	%rsi, %r12
+	pushq	%rbp
+	pushq	%rbx
+	movq	%rdx, %rbx
+	subq	$48, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	xorl	%eax, %eax
+	xorl	%eax, %eax
+	movq	%rax, 8(%rdi)
+.L34:
+	movsbl	(%r12), %esi
+	testb	%sil, %sil
+	je	.L114
+	cmpb	$37, %sil
+	jne	.L35
+	incq	%r12
+	xorl	%edx, %edx
+	jmp	.L36
+.L35:
+	movq	%r13, %rdi
+	call	cputchar
+	jmp	.L37
+.L38:
+	cmpb	$48, %al
+	jne	.L99
+	orl	$16, %edx
+.L39:
+	incq	%r12
+.L36:
+	movb	(%r12), %al
+	cmpb	$35, %al
+	jne	.L38
+	orl	$2, %edx
+	jmp	.L39
+.L99:
+	xorl	%esi, %esi
+.L40:
+	movsbl	(%r12), %eax
+	leaq	1(%r12), %rcx
+	subl	$48, %eax
+	cmpl	$9, %eax
+	ja	.L100
+	imull	$10, %esi, %esi
+	movq	%rcx, %r12
+	addl	%eax, %esi
+	jmp	.L40
+.L100:
+	leaq	2+type_sizes(%rip), %rdi
+.L41:
+	movb	(%r12), %al
+	cmpb	$104, %al
+	jne	.L42
+	decq	%rdi
+	jmp	.L43
+.L42:
+	cmpb	$108, %al
+	jne	.L44
+	incq	%rdi
+	jmp	.L43
+.L44:
+	cmpb	$122, %al
+	jne	.L45
+	leaq	5+type_sizes(%rip), %rdi
+.L43:
+	incq	%r12
+	jmp	.L41
+.L45:
+	movb	$0, 39(%rsp)
+	cmpb	$99, %al
+	jne	.L46
+	movl	(%rbx), %eax
+	cmpq	%r14, %rdi
+	jnb	.L47
+	cmpl	$47, %eax
+	ja	.L48
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%rbx), %rdx
+	movl	%eax, (%rbx)
+	jmp	.L49
+.L48:
+	movq	8(%rbx), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%rbx)
+.L49:
+	movl	(%rdx), %esi
+	movq	%r13, %rdi
+	call	cputchar
+.L60:
+	leaq	39(%rsp), %rbp
+	jmp	.L50
+.L47:
+	cmpl	$47, %eax
+	ja	.L51
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%rbx), %rdx
+	movl	%eax, (%rbx)
+	jmp	.L52
+.L51:
+	movq	8(%rbx), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%rbx)
+.L52:
+	movl	(%rdx), %eax
+	movb	$0, 9(%rsp)
+	leaq	8(%rsp), %rbp
+	movb	%al, 8(%rsp)
+	jmp	.L50
+.L46:
+	cmpb	$115, %al
+	jne	.L54
+	leaq	3+type_sizes(%rip), %rdx
+	movl	(%rbx), %eax
+	cmpq	%rdx, %rdi
+	jnb	.L55
+	cmpl	$47, %eax
+	ja	.L56
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%rbx), %rdx
+	movl	%eax, (%rbx)
+	jmp	.L57
+.L56:
+	movq	8(%rbx), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%rbx)
+.L57:
+	movq	(%rdx), %rbp
+	testq	%rbp, %rbp
+	jne	.L50
+	leaq	.LC0(%rip), %rbp
+	jmp	.L50
+.L55:
+	cmpl	$47, %eax
+	ja	.L58
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%rbx), %rdx
+	movl	%eax, (%rbx)
+	jmp	.L59
+.L58:
+	movq	8(%rbx), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%rbx)
+.L59:
+	movq	(%rdx), %rbp
+	testq	%rbp, %rbp
+	jne	.L61
+	jmp	.L60
+.L54:
+	cmpb	$112, %al
+	jne	.L62
+	movl	(%rbx), %edx
+	cmpl	$47, %edx
+	ja	.L63
+	movl	%edx, %eax
+	addl	$8, %edx
+	addq	16(%rbx), %rax
+	movl	%edx, (%rbx)
+	jmp	.L64
+.L63:
+	movq	8(%rbx), %rax
+	leaq	8(%rax), %rdx
+	movq	%rdx, 8(%rbx)
+.L64:
+	movq	(%rax), %rdx
+	leaq	39(%rsp), %rax
+	leaq	.LC1(%rip), %r8
+	movq	%rax, %rdi
+.L65:
+	movq	%rdx, %rcx
+	decq	%rax
+	andl	$15, %ecx
+	movb	(%r8,%rcx), %cl
+	orl	$32, %ecx
+	shrq	$4, %rdx
+	movb	%cl, (%rax)
+	jne	.L65
+	movslq	%esi, %rsi
+.L66:
+	movq	%rdi, %rdx
+	subq	%rax, %rdx
+	cmpq	%rsi, %rdx
+	jge	.L115
+	decq	%rax
+	movb	$32, (%rax)
+	jmp	.L66
+.L115:
+	movb	$120, -1(%rax)
+	leaq	-2(%rax), %rbp
+	movb	$48, -2(%rax)
+	jmp	.L50
+.L62:
+	movl	%eax, %ecx
+	andl	$-33, %ecx
+	cmpb	$88, %cl
+	jne	.L68
+	andl	$32, %eax
+	orl	%eax, %edx
+	cmpb	$7, (%rdi)
+	movl	(%rbx), %eax
+	jbe	.L69
+	cmpl	$47, %eax
+	ja	.L70
+	movl	%eax, %ecx
+	addl	$8, %eax
+	addq	16(%rbx), %rcx
+	movl	%eax, (%rbx)
+	jmp	.L71
+.L70:
+	movq	8(%rbx), %rcx
+	leaq	8(%rcx), %rax
+	movq	%rax, 8(%rbx)
+.L71:
+	movq	(%rcx), %rax
+	jmp	.L72
+.L69:
+	cmpl	$47, %eax
+	ja	.L73
+	movl	%eax, %ecx
+	addl	$8, %eax
+	addq	16(%rbx), %rcx
+	movl	%eax, (%rbx)
+	jmp	.L74
+.L73:
+	movq	8(%rbx), %rcx
+	leaq	8(%rcx), %rax
+	movq	%rax, 8(%rbx)
+.L74:
+	movl	(%rcx), %eax
+.L72:
+	movl	%edx, %edi
+	leaq	39(%rsp), %rbp
+	leaq	.LC1(%rip), %r10
+	movl	%edx, %ecx
+	andl	$16, %edi
+	andl	$32, %ecx
+	movq	%rbp, %r8
+	orl	$32, %edi
+.L75:
+	movq	%rax, %r9
+	decq	%rbp
+	andl	$15, %r9d
+	movb	(%r10,%r9), %r11b
+	orl	%ecx, %r11d
+	shrq	$4, %rax
+	movb	%r11b, 0(%rbp)
+	jne	.L75
+	movslq	%esi, %rsi
+.L76:
+	movq	%r8, %rax
+	subq	%rbp, %rax
+	cmpq	%rsi, %rax
+	jge	.L116
+	decq	%rbp
+	movb	%dil, 0(%rbp)
+	jmp	.L76
+.L116:
+	andb	$2, %dl
+	je	.L50
+	orl	$88, %ecx
+	movb	$48, -2(%rbp)
+	subq	$2, %rbp
+	movb	%cl, 1(%rbp)
+	jmp	.L50
+.L68:
+	cmpb	$100, %al
+	je	.L101
+	cmpb	$105, %al
+	jne	.L79
+.L101:
+	movl	%edx, %ecx
+	movl	(%rbx), %eax
+	orl	$2, %ecx
+	cmpb	$7, (%rdi)
+	ja	.L113
+	cmpl	$47, %eax
+	ja	.L85
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%rbx), %rdx
+	movl	%eax, (%rbx)
+	jmp	.L86
+.L85:
+	movq	8(%rbx), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%rbx)
+.L86:
+	movslq	(%rdx), %rax
+	jmp	.L91
+.L79:
+	cmpb	$117, %al
+	jne	.L87
+	movl	%edx, %ecx
+	movl	(%rbx), %eax
+	andl	$-3, %ecx
+	cmpb	$7, (%rdi)
+	jbe	.L88
+.L113:
+	cmpl	$47, %eax
+	ja	.L89
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%rbx), %rdx
+	movl	%eax, (%rbx)
+	jmp	.L90
+.L89:
+	movq	8(%rbx), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%rbx)
+.L90:
+	movq	(%rdx), %rax
+	jmp	.L91
+.L88:
+	cmpl	$47, %eax
+	ja	.L92
+	movl	%eax, %edx
+	addl	$8, %eax
+	addq	16(%rbx), %rdx
+	movl	%eax, (%rbx)
+	jmp	.L93
+.L92:
+	movq	8(%rbx), %rdx
+	leaq	8(%rdx), %rax
+	movq	%rax, 8(%rbx)
+.L93:
+	movl	(%rdx), %eax
+.L91:
+	movl	%esi, %edx
+	leaq	39(%rsp), %rdi
+	movq	%rax, %rsi
+	call	format_decimal.constprop.0
+	movq	%rax, %rbp
+	jmp	.L50
+.L87:
+	movb	%al, 38(%rsp)
+	leaq	38(%rsp), %rbp
+.L50:
+	movsbl	0(%rbp), %esi
+	testb	%sil, %sil
+	je	.L37
+	movq	%r13, %rdi
+	incq	%rbp
+	call	cputchar
+	jmp	.L50
+.L61:
+	movw	0(%rbp), %si
+	testw	%si, %si
+	je	.L37
+	movb	%sil, 8(%rsp)
+	movq	%r13, %rdi
+	movsbl	%sil, %esi
+	addq	$2, %rbp
+	call	cputchar
+	jmp	.L61
+.L37:
+	incq	%r12
+	jmp	.L34
+.L114:
+	movq	8(%r13), %rax
+	movq	40(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L98
+	call	__stack_chk_fail@PLT
+.L98:
+	addq	$48, %rsp
+	popq	%rbx
+	popq	%rbp
+	popq	%r12
+	popq	%r13
+	popq	%r14
+	ret
+	.size	vcprintf, .-vcprintf
+	.globl	vsnprintf
+	.hidden	vsnprintf
+	.type	vsnprintf, @function
+vsnprintf:
+	pushq	%rbp
+	movq	%rdi, %rbp
+	pushq	%rbx
+	movq	%rsi, %rbx
+	movq	%rdx, %rsi
+	movq	%rcx, %rdx
+	subq	$56, %rsp
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 40(%rsp)
+	leaq	printf_sputc(%rip), %rax
+	movq	%rdi, 16(%rsp)
+	movq	%rsp, %rdi
+	movq	%rbx, 24(%rsp)
+	movq	%rax, (%rsp)
+	call	vcprintf
+	testq	%rbx, %rbx
+	je	.L118
+	decq	%rbx
+	cmpq	%rax, %rbx
+	cmova	%rax, %rbx
+	movb	$0, 0(%rbp,%rbx)
+.L118:
+	movq	40(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L119
+	call	__stack_chk_fail@PLT
+.L119:
+	addq	$56, %rsp
+	popq	%rbx
+	popq	%rbp
+	ret
+	.size	vsnprintf, .-vsnprintf
+	.globl	snprintf
+	.hidden	snprintf
+	.type	snprintf, @function
+snprintf:
+	subq	$216, %rsp
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L125
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L125:
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	224(%rsp), %rax
+	movq	%rsp, %rcx
+	movl	$24, (%rsp)
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movl	$48, 4(%rsp)
+	movq	%rax, 16(%rsp)
+	call	vsnprintf
+	movq	24(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L126
+	call	__stack_chk_fail@PLT
+.L126:
+	addq	$216, %rsp
+	ret
+	.size	snprintf, .-snprintf
+	.globl	vssnprintf
+	.hidden	vssnprintf
+	.type	vssnprintf, @function
+vssnprintf:
+	xorl	%eax, %eax
+	testq	%rsi, %rsi
+	cmovs	%rax, %rsi
+	jmp	vsnprintf
+	.size	vssnprintf, .-vssnprintf
+	.globl	ssnprintf
+	.hidden	ssnprintf
+	.type	ssnprintf, @function
+ssnprintf:
+	subq	$216, %rsp
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L130
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L130:
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	224(%rsp), %rax
+	movq	%rsp, %rcx
+	movl	$24, (%rsp)
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movl	$48, 4(%rsp)
+	movq	%rax, 16(%rsp)
+	call	vssnprintf
+	movq	24(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L131
+	call	__stack_chk_fail@PLT
+.L131:
+	addq	$216, %rsp
+	ret
+	.size	ssnprintf, .-ssnprintf
+	.globl	vprintf
+	.hidden	vprintf
+	.type	vprintf, @function
+vprintf:
+	subq	$40, %rsp
+	movq	%rsi, %rdx
+	movq	%rdi, %rsi
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	leaq	printf_putchar(%rip), %rax
+	movq	%rax, 8(%rsp)
+	leaq	8(%rsp), %rax
+	movq	%rax, %rdi
+	call	vcprintf
+	movq	24(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L134
+	call	__stack_chk_fail@PLT
+.L134:
+	addq	$40, %rsp
+	ret
+	.size	vprintf, .-vprintf
+	.globl	printf
+	.hidden	printf
+	.type	printf, @function
+printf:
+	subq	$216, %rsp
+	movq	%rsi, 40(%rsp)
+	movq	%rdx, 48(%rsp)
+	movq	%rcx, 56(%rsp)
+	movq	%r8, 64(%rsp)
+	movq	%r9, 72(%rsp)
+	testb	%al, %al
+	je	.L137
+	movaps	%xmm0, 80(%rsp)
+	movaps	%xmm1, 96(%rsp)
+	movaps	%xmm2, 112(%rsp)
+	movaps	%xmm3, 128(%rsp)
+	movaps	%xmm4, 144(%rsp)
+	movaps	%xmm5, 160(%rsp)
+	movaps	%xmm6, 176(%rsp)
+	movaps	%xmm7, 192(%rsp)
+.L137:
+	movq	__stack_chk_guard(%rip), %rax
+	movq	%rax, 24(%rsp)
+	xorl	%eax, %eax
+	leaq	224(%rsp), %rax
+	movq	%rsp, %rsi
+	movl	$8, (%rsp)
+	movq	%rax, 8(%rsp)
+	leaq	32(%rsp), %rax
+	movl	$48, 4(%rsp)
+	movq	%rax, 16(%rsp)
+	call	vprintf
+	movq	24(%rsp), %rdx
+	subq	__stack_chk_guard(%rip), %rdx
+	je	.L138
+	call	__stack_chk_fail@PLT
+.L138:
+	addq	$216, %rsp
+	ret
+	.size	printf, .-printf
+	.data
+	.type	type_sizes, @object
+	.size	type_sizes, 6
+type_sizes:
+	.ascii	"\001\002\004\b\b\b"
+	.hidden	putchar
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,164 @@
+# 0 "prefix.S"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "include/compiler.h" 1
+# 0 "<command-line>" 2
+# 1 "prefix.S"
+# 27 "prefix.S"
+# 1 "include/ntloader.h" 1
+# 28 "prefix.S" 2
+# 63 "prefix.S"
+ .section ".note.GNU-stack", "", @progbits
+ .text
+ .section ".prefix", "ax", @progbits
+ .org 0
+_prefix:
+
+
+
+ .code32
+ .arch i386
+
+ .org 0x1f1
+setup_sects:
+ .byte 4
+
+ .org 0x1fe
+boot_flag:
+ .word 0xaa55
+
+ .org 0x200
+jump:
+ .byte 0xeb, setup - 1f
+1:
+
+ .org 0x202
+header:
+ .ascii "HdrS"
+
+ .org 0x206
+version:
+ .word 0x206
+
+ .org 0x20e
+kernel_version:
+ .word ( version_string - _prefix - 0x200 )
+
+ .org 0x211
+loadflags:
+ .byte 0x01
+
+ .org 0x218
+ramdisk_image:
+ .long 0
+
+ .org 0x21c
+ramdisk_size:
+ .long 0
+
+ .org 0x228
+cmd_line_ptr:
+ .long 0
+
+ .org 0x22c
+ramdisk_max:
+ .long 0xffffffff
+
+ .org 0x238
+cmdline_size:
+ .long 4096
+
+version_string:
+ .asciz "v3.0.7"
+
+
+ .code16
+setup:
+
+ pushw %ds
+ pushw $( 1f - _prefix )
+ lret
+1:
+
+ xorl %eax, %eax
+ movw %cs, %ax
+ shll $4, %eax
+ addl %eax, ( gdt - _prefix + 2 )
+ addl %eax, ( gdt - _prefix + 0x08 + 2 )
+
+
+ cli
+ data32 lgdt ( gdt - _prefix )
+ movl %cr0, %eax
+ orb $0x01, %al
+ movl %eax, %cr0
+ data32 ljmp $0x08, $( 1f - _prefix )
+ .code32
+1:
+
+ movw $0x18, %ax
+ movw %ax, %ds
+ movw %ax, %es
+ movw %ax, %fs
+ movw %ax, %gs
+ movw %ax, %ss
+
+
+ xorl %eax, %eax
+ movl $_bss16, %edi
+ movl $_bss16_len, %ecx
+ rep stosb
+ movl $_bss, %edi
+ movl $_bss_len, %ecx
+ rep stosb
+
+
+ movl $( 0x100000 + _payload_pos - ( ( 4 + 1 ) * 512 ) ), %esi
+ movl $_payload, %edi
+ movl $_payload_len, %ecx
+ cld
+ rep movsb
+
+
+ movl $(0x100000 + _payload_pos - ( ( 4 + 1 ) * 512 )), %eax
+ addl $_payload_len, %eax
+ movl %eax, %esi
+ movl $_bcd, %edi
+ movl $_bcd_len, %ecx
+ cld
+ rep movsb
+
+
+ movl %cs:( cmd_line_ptr - _prefix ), %eax
+ movl %eax, cmdline
+ movl %cs:( ramdisk_image - _prefix ), %eax
+ movl %eax, initrd
+ movl %cs:( ramdisk_size - _prefix ), %eax
+ movl %eax, initrd_len
+
+
+ ljmp $0x10, $startup
+ .size setup, . - setup
+
+
+gdt:
+ .word gdt_limit
+ .long ( gdt - _prefix )
+
+ .org ( gdt + 0x08 )
+ .word 0xffff, 0
+ .byte 0, 0x9f, 0xcf, 0
+
+ .org ( gdt + 0x10 )
+ .word 0xffff, 0
+ .byte 0, 0x9f, 0xcf, 0
+
+ .org ( gdt + 0x18 )
+ .word 0xffff, 0
+ .byte 0, 0x93, 0xcf, 0
+ .size gdt, . - gdt
+ .equ gdt_limit, . - gdt - 1
+
+
+
+ .org ( ( 4 + 1 ) * 512 )
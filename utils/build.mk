@@ -19,11 +19,13 @@ RM_FILES += elf2efi32 elf2efi64
 
 # Initrd rootfs
 #
-mkinitrd.exe : utils/mkinitrd.c
-	$(MINGW_CC) $(HOST_CFLAGS) -iquote include/ $< -o $@
+MKINITRD_FILES := libnt/lznt1.c libnt/lzfile.c utils/mkinitrd.c
 
-mkinitrd : utils/mkinitrd.c
-	$(HOST_CC) $(HOST_CFLAGS) -iquote include/ $< -o $@
+mkinitrd.exe : $(MKINITRD_FILES)
+	$(MINGW_CC) $(HOST_CFLAGS) -iquote include/ $(MKINITRD_FILES) -o $@
+
+mkinitrd : $(MKINITRD_FILES)
+	$(HOST_CC) $(HOST_CFLAGS) -iquote include/ $(MKINITRD_FILES) -o $@
 
 initrd.cpio : mkinitrd
 	./mkinitrd utils/rootfs $@
@@ -65,6 +67,31 @@ bmtool : $(BMTOOL_FILES)
 
 RM_FILES += bmtool bmtool.exe
 
+# vtrace
+#
+vtrace.exe : utils/vtrace.c
+	$(MINGW_CC) $(HOST_CFLAGS) -iquote include/ $< -o $@
+
+vtrace : utils/vtrace.c
+	$(HOST_CC) $(HOST_CFLAGS) -iquote include/ $< -o $@
+
+RM_FILES += vtrace vtrace.exe
+
+# vdiskimg
+#
+VDISKIMG_FILES := libnt/vdisk.c libnt/cpio.c libnt/bcd.c libnt/reg.c
+VDISKIMG_FILES += libnt/charset.c libnt/lzfile.c libnt/lznt1.c
+VDISKIMG_FILES += kern/cmdline.c utils/vdiskimg.c
+
+VDISKIMG_CFLAGS := -DDEBUG=0 -Wno-address-of-packed-member
+VDISKIMG_CFLAGS += -D__unused="__attribute__ ((unused))" -D__nonstring=
+
+vdiskimg : $(VDISKIMG_FILES) include/bcd_raw.h
+	$(HOST_CC) $(HOST_CFLAGS) $(VDISKIMG_CFLAGS) -iquote include/ \
+		$(VDISKIMG_FILES) -o $@
+
+RM_FILES += vdiskimg
+
 # bin2c
 #
 bin2c : utils/bin2c.c
@@ -73,4 +100,4 @@ include/bcd_raw.h : utils/bcd bin2c
 	./bin2c utils/bcd $@ bcd_raw "__attribute__ ((section (\".bcd\"), aligned (512)))"
 
 HEADERS += include/bcd_raw.h
-RM_FILES += bin2c include/bcd_raw.h
\ No newline at end of file
+RM_FILES += bin2c include/bcd_raw.h
\ No newline at end of file
@@ -26,8 +26,12 @@
 #include <sys/stat.h>
 #include <dirent.h>
 #include <unistd.h>
+#include <strings.h>
+#include <time.h>
 
 #include "cpio.h"
+#include "lznt1.h"
+#include "lzfile.h"
 
 #ifdef _WIN32
 #define lstat stat
@@ -36,6 +40,11 @@
 #define ALIGN_UP_OVERHEAD(addr, align) \
     ((-(addr)) & ((typeof (addr)) (align) - 1))
 
+/* Maximum number of match candidates examined per position */
+#define LZNT1_MAX_CHAIN 64
+
+static int compress_files = 0;
+
 static char
 hex (uint8_t val)
 {
@@ -135,6 +144,286 @@ copy_data (FILE *out, FILE *in, size_t fsize)
     return 0;
 }
 
+static unsigned int
+lznt1_split (size_t pos)
+{
+    unsigned int split = 12;
+    size_t threshold = 16;
+    while (pos > threshold)
+    {
+        split--;
+        threshold <<= 1;
+    }
+    return split;
+}
+
+static size_t
+lznt1_compress_block (const uint8_t *in, size_t len, uint8_t *out)
+{
+    int16_t head[256 * 16];
+    int16_t prev[LZFILE_BLOCK_SIZE];
+    size_t pos = 0;
+    size_t out_len = 2;
+    size_t tag_pos = 0;
+    unsigned int tag_bit = 8;
+    uint16_t header;
+
+    memset (head, 0xff, sizeof (head));
+    while (pos < len)
+    {
+        unsigned int split = lznt1_split (pos);
+        size_t max_off = ((size_t) 1 << (16 - split));
+        size_t max_len = ((size_t) 1 << split) + 2;
+        size_t best_len = 0;
+        size_t best_off = 0;
+        unsigned int hash = 0;
+        unsigned int chain = LZNT1_MAX_CHAIN;
+        int cand;
+
+        if (max_len > len - pos)
+            max_len = len - pos;
+        if (pos + 3 <= len)
+        {
+            hash = ((in[pos] << 4) ^ (in[pos + 1] << 2) ^ in[pos + 2]) &
+                   (sizeof (head) / sizeof (head[0]) - 1);
+            for (cand = head[hash] ; cand >= 0 && chain-- ;
+                 cand = prev[cand])
+            {
+                size_t off = pos - cand;
+                size_t l = 0;
+                if (off > max_off)
+                    break;
+                while (l < max_len && in[cand + l] == in[pos + l])
+                    l++;
+                if (l > best_len)
+                {
+                    best_len = l;
+                    best_off = off;
+                    if (l == max_len)
+                        break;
+                }
+            }
+        }
+
+        if (tag_bit == 8)
+        {
+            if (out_len + 1 + 16 > len + 2)
+                goto store;
+            tag_pos = out_len++;
+            out[tag_pos] = 0;
+            tag_bit = 0;
+        }
+
+        if (best_len >= 3)
+        {
+            uint16_t tuple = (uint16_t) (((best_off - 1) << split) |
+                                         (best_len - 3));
+            out[tag_pos] |= (1 << tag_bit);
+            out[out_len++] = (tuple & 0xff);
+            out[out_len++] = (tuple >> 8);
+        }
+        else
+        {
+            best_len = 1;
+            out[out_len++] = in[pos];
+        }
+        tag_bit++;
+
+        /* Insert every covered position into the hash chains */
+        while (best_len--)
+        {
+            if (pos + 3 <= len)
+            {
+                hash = ((in[pos] << 4) ^ (in[pos + 1] << 2) ^ in[pos + 2]) &
+                       (sizeof (head) / sizeof (head[0]) - 1);
+                prev[pos] = head[hash];
+                head[hash] = (int16_t) pos;
+            }
+            pos++;
+        }
+    }
+
+    if (out_len - 2 < len)
+    {
+        header = (uint16_t) (LZFILE_BLOCK_COMPRESSED | (out_len - 2 - 1));
+        out[0] = (header & 0xff);
+        out[1] = (header >> 8);
+        return out_len;
+    }
+
+store:
+    header = (uint16_t) (LZFILE_BLOCK_UNCOMPRESSED | (len - 1));
+    out[0] = (header & 0xff);
+    out[1] = (header >> 8);
+    memcpy (out + 2, in, len);
+    return len + 2;
+}
+
+static uint8_t *
+compress_data (const uint8_t *in, size_t len, size_t *out_len)
+{
+    uint32_t chunks = (uint32_t) ((len + (1U << LZFILE_CHUNK_SHIFT) - 1)
+                                  >> LZFILE_CHUNK_SHIFT);
+    size_t table_len = (chunks + 1) * sizeof (uint32_t);
+    size_t max = sizeof (struct lzfile_header) + table_len +
+                 len + 2 * ((len >> LZFILE_BLOCK_SHIFT) + 1);
+    struct lzfile_header *header;
+    uint32_t *offsets;
+    uint8_t *out;
+    size_t pos;
+    size_t done = 0;
+    uint32_t i;
+
+    out = malloc (max);
+    if (!out)
+        return NULL;
+    header = (struct lzfile_header *) out;
+    memcpy (header->magic, LZFILE_MAGIC, sizeof (header->magic));
+    header->chunk_shift = LZFILE_CHUNK_SHIFT;
+    header->chunks = chunks;
+    header->len = len;
+    offsets = (uint32_t *) (header + 1);
+    pos = sizeof (*header) + table_len;
+
+    for (i = 0; i < chunks; i++)
+    {
+        size_t chunk_end = done + (1U << LZFILE_CHUNK_SHIFT);
+        if (chunk_end > len)
+            chunk_end = len;
+        offsets[i] = (uint32_t) pos;
+        while (done < chunk_end)
+        {
+            size_t block_len = chunk_end - done;
+            if (block_len > LZFILE_BLOCK_SIZE)
+                block_len = LZFILE_BLOCK_SIZE;
+            pos += lznt1_compress_block (in + done, block_len, out + pos);
+            done += block_len;
+        }
+    }
+    offsets[chunks] = (uint32_t) pos;
+    *out_len = pos;
+    return out;
+}
+
+static int
+is_bootmgr (const char *name)
+{
+    size_t len = strlen (name);
+    if (strcasecmp (name, "bootmgr.exe") == 0)
+        return 1;
+    return (len > 8 && strncasecmp (name, "boot", 4) == 0 &&
+            strcasecmp (name + len - 4, ".efi") == 0);
+}
+
+static double
+decode_speed (const uint8_t *data, size_t len)
+{
+    static uint8_t buf[1U << LZFILE_CHUNK_SHIFT];
+    size_t total = 0;
+    clock_t start = clock ();
+    clock_t elapsed;
+    size_t offset;
+
+    do
+    {
+        for (offset = 0; offset < len; offset += sizeof (buf))
+        {
+            size_t frag = len - offset;
+            if (frag > sizeof (buf))
+                frag = sizeof (buf);
+            if (lzfile_pread (data, buf, offset, frag) != 0)
+                return -1;
+            total += frag;
+        }
+        elapsed = clock () - start;
+    } while (len && elapsed < CLOCKS_PER_SEC / 10);
+
+    if (elapsed <= 0)
+        elapsed = 1;
+    return ((double) total / (1024 * 1024)) /
+           ((double) elapsed / CLOCKS_PER_SEC);
+}
+
+static int
+compress_file (const char *path, const char *arcname,
+               const struct stat *st, FILE *out)
+{
+    size_t len = (size_t) st->st_size;
+    size_t comp_len;
+    size_t file_len;
+    uint8_t *data;
+    uint8_t *comp;
+    double speed;
+    int rc = -1;
+
+    FILE *in = fopen (path, "rb");
+    if (!in)
+    {
+        perror (path);
+        return -1;
+    }
+    data = malloc (len ? len : 1);
+    if (!data || fread (data, 1, len, in) != len)
+    {
+        perror (path);
+        fclose (in);
+        free (data);
+        return -1;
+    }
+    fclose (in);
+
+    comp = compress_data (data, len, &comp_len);
+    if (!comp)
+    {
+        perror ("compress");
+        free (data);
+        return -1;
+    }
+    if (lzfile_check (comp, comp_len, &file_len) != 0 || file_len != len)
+    {
+        fprintf (stderr, "%s: bad compressed file\n", path);
+        goto out;
+    }
+    speed = decode_speed (comp, len);
+    if (speed < 0)
+    {
+        fprintf (stderr, "%s: decompression failed\n", path);
+        goto out;
+    }
+
+    /* Store uncompressed if compression does not help */
+    if (comp_len >= len)
+    {
+        printf ("%-24s %10zu stored\n", arcname, len);
+        rc = write_header (out, arcname, st->st_mode, (uint32_t) len);
+        if (rc == 0 && fwrite (data, 1, len, out) != len)
+            rc = -1;
+    }
+    else
+    {
+        printf ("%-24s %10zu -> %10zu (%5.1f%%) decode %8.1f MB/s\n",
+                arcname, len, comp_len, 100.0 * comp_len / len, speed);
+        rc = write_header (out, arcname, st->st_mode, (uint32_t) comp_len);
+        if (rc == 0 && fwrite (comp, 1, comp_len, out) != comp_len)
+            rc = -1;
+        len = comp_len;
+    }
+    if (rc == 0)
+    {
+        size_t pad = ALIGN_UP_OVERHEAD ((ssize_t) len, 4);
+        char zero[4] = {0, 0, 0, 0};
+        if (fwrite (zero, 1, pad, out) != pad)
+            rc = -1;
+    }
+    if (rc != 0)
+        perror ("fwrite file data");
+
+out:
+    free (comp);
+    free (data);
+    return rc;
+}
+
 static int
 process_file (const char *path,
               const char *arcname,
@@ -142,6 +431,8 @@ process_file (const char *path,
               FILE *out)
 {
     uint32_t fsize = (uint32_t) st->st_size;
+    if (compress_files && !is_bootmgr (arcname))
+        return compress_file (path, arcname, st, out);
     if (write_header (out, arcname, st->st_mode, fsize) != 0)
         return -1;
 
@@ -202,9 +493,15 @@ process_root (const char *dir, FILE *out)
 
 int main (int argc, char *argv[])
 {
+    if (argc == 4 && strcmp (argv[1], "-c") == 0)
+    {
+        compress_files = 1;
+        argc--;
+        argv++;
+    }
     if (argc != 3)
     {
-        fprintf (stderr, "Usage: %s DIR OUT_FILE\n", argv[0]);
+        fprintf (stderr, "Usage: %s [-c] DIR OUT_FILE\n", argv[0]);
         return EXIT_FAILURE;
     }
     const char *dir = argv[1];
@@ -0,0 +1,677 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Render the virtual disk that ntloader would present for an initrd,
+ * using the loader's own vdisk, cpio and BCD code.  The disk can be
+ * written out as a sparse image (for fsck or mount), served over NBD
+ * on a local socket, or swept sequentially and randomly to measure
+ * vdisk_read throughput.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <wchar.h>
+#include <strings.h>
+#include <errno.h>
+#include <endian.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include "ntloader.h"
+#include "vdisk.h"
+#include "cpio.h"
+#include "bcd.h"
+#include "cmdline.h"
+#include "lzfile.h"
+#include "bcd_raw.h"
+
+/** Sectors per read when sweeping or writing the disk (64 KiB) */
+#define SWEEP_COUNT 128
+
+/** Largest NBD read request accepted */
+#define NBD_MAX_READ (32 * 1024 * 1024)
+
+#define NBD_MAGIC            0x4e42444d41474943ULL
+#define NBD_OPTS_MAGIC       0x49484156454f5054ULL
+#define NBD_REP_MAGIC        0x0003e889045565a9ULL
+#define NBD_REQUEST_MAGIC    0x25609513
+#define NBD_REPLY_MAGIC      0x67446698
+
+#define NBD_FLAG_FIXED_NEWSTYLE  0x0001
+#define NBD_FLAG_NO_ZEROES       0x0002
+#define NBD_FLAG_HAS_FLAGS       0x0001
+#define NBD_FLAG_READ_ONLY       0x0002
+
+#define NBD_OPT_EXPORT_NAME  1
+#define NBD_OPT_ABORT        2
+#define NBD_OPT_INFO         6
+#define NBD_OPT_GO           7
+
+#define NBD_REP_ACK          1
+#define NBD_REP_INFO         3
+#define NBD_REP_ERR_UNSUP    0x80000001
+#define NBD_INFO_EXPORT      0
+
+#define NBD_CMD_READ         0
+#define NBD_CMD_WRITE        1
+#define NBD_CMD_DISC         2
+#define NBD_CMD_FLUSH        3
+
+#define NBD_EPERM            1
+#define NBD_EINVAL           22
+
+/** Used by bcd_patch_data() to pick .efi or .exe paths */
+void *efi_systab;
+
+/** A bootmgr file was found */
+static int found_bootmgr;
+
+void die (const char *fmt, ...)
+{
+    va_list args;
+
+    va_start (args, fmt);
+    vfprintf (stderr, fmt, args);
+    va_end (args);
+    exit (EXIT_FAILURE);
+}
+
+/* The loader is built with -fshort-wchar, which the C library's own
+ * wcslen() knows nothing about */
+size_t wcslen (const wchar_t *str)
+{
+    size_t len = 0;
+    while (str[len])
+        len++;
+    return len;
+}
+
+static void
+read_mem_file (struct vdisk_file *file, void *data, size_t offset,
+               size_t len)
+{
+    memcpy (data, (file->opaque + offset), len);
+}
+
+static void
+read_lz_file (struct vdisk_file *file, void *data, size_t offset,
+              size_t len)
+{
+    if (lzfile_pread (file->opaque, data, offset, len) != 0)
+        die ("could not decompress %s\n", file->name);
+}
+
+static int
+is_bootmgr (const char *name)
+{
+    size_t len = strlen (name);
+    if (!efi_systab)
+        return (strcasecmp (name, "bootmgr.exe") == 0);
+    return (len > 8 && strncasecmp (name, "boot", 4) == 0 &&
+            strcasecmp (name + len - 4, ".efi") == 0);
+}
+
+static int
+add_file (const char *name, void *data, size_t len)
+{
+    size_t file_len;
+
+    if (lzfile_check (data, len, &file_len) == 0)
+    {
+        if (is_bootmgr (name))
+            die ("bootmgr file %s is compressed\n", name);
+        vdisk_add_file (name, data, file_len, read_lz_file);
+    }
+    else
+        vdisk_add_file (name, data, len, read_mem_file);
+    if (is_bootmgr (name))
+    {
+        nt_cmdline->bootmgr = data;
+        nt_cmdline->bootmgr_length = len;
+        found_bootmgr = 1;
+    }
+    return 0;
+}
+
+static void *
+load_file (const char *path, size_t *len)
+{
+    FILE *fp = fopen (path, "rb");
+    struct stat st;
+    void *data;
+
+    if (!fp || fstat (fileno (fp), &st) != 0)
+    {
+        perror (path);
+        exit (EXIT_FAILURE);
+    }
+    data = malloc (st.st_size ? st.st_size : 1);
+    if (!data)
+        die ("out of memory\n");
+    if (fread (data, 1, st.st_size, fp) != (size_t) st.st_size)
+        die ("error reading %s\n", path);
+    fclose (fp);
+    *len = st.st_size;
+    return data;
+}
+
+static double
+now (void)
+{
+    struct timespec ts;
+    clock_gettime (CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Reads are whole sectors, so data can be scanned a word at a time */
+static int
+is_zero (const uint64_t *data, size_t len)
+{
+    size_t i;
+    for (i = 0; i < len / sizeof (*data); i++)
+    {
+        if (data[i])
+            return 0;
+    }
+    return 1;
+}
+
+/* Order-independent digest of a sweep, so both sweeps can be compared */
+static uint64_t
+chunk_digest (const uint64_t *data, size_t len, uint64_t chunk)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL ^ chunk;
+    size_t i;
+    for (i = 0; i < len / sizeof (*data); i++)
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    return hash;
+}
+
+/* Read one sweep chunk, returning the time spent in vdisk_read() */
+static double
+read_chunk (uint64_t chunk, uint64_t used, uint64_t *buf, size_t *len)
+{
+    uint64_t lba = chunk * SWEEP_COUNT;
+    unsigned int count = SWEEP_COUNT;
+    double start;
+
+    if (lba + count > used)
+        count = (unsigned int) (used - lba);
+    start = now ();
+    vdisk_read (lba, count, buf);
+    *len = (size_t) count * VDISK_SECTOR_SIZE;
+    return now () - start;
+}
+
+static void
+report (const char *name, uint64_t bytes, double secs)
+{
+    if (secs <= 0)
+        secs = 1e-9;
+    printf ("%-11s %10.1f MiB in %8.3f s  %10.1f MiB/s\n", name,
+            bytes / (1024.0 * 1024.0), secs,
+            bytes / (1024.0 * 1024.0) / secs);
+}
+
+static int
+benchmark (uint64_t used)
+{
+    static uint64_t buf[SWEEP_COUNT * VDISK_SECTOR_SIZE / sizeof (uint64_t)];
+    uint64_t chunks = (used + SWEEP_COUNT - 1) / SWEEP_COUNT;
+    uint64_t *order;
+    uint64_t seq_digest = 0;
+    uint64_t rnd_digest = 0;
+    uint64_t state = 0x9e3779b97f4a7c15ULL;
+    uint64_t bytes = 0;
+    uint64_t i, j, tmp;
+    size_t len;
+    double secs;
+
+    order = malloc (chunks * sizeof (*order));
+    if (!order)
+        die ("out of memory\n");
+    for (i = 0; i < chunks; i++)
+        order[i] = i;
+    for (i = chunks; i > 1; i--)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        j = state % i;
+        tmp = order[i - 1];
+        order[i - 1] = order[j];
+        order[j] = tmp;
+    }
+
+    secs = 0;
+    for (i = 0; i < chunks; i++)
+    {
+        secs += read_chunk (i, used, buf, &len);
+        seq_digest += chunk_digest (buf, len, i);
+        bytes += len;
+    }
+    report ("Sequential:", bytes, secs);
+
+    bytes = 0;
+    secs = 0;
+    for (i = 0; i < chunks; i++)
+    {
+        secs += read_chunk (order[i], used, buf, &len);
+        rnd_digest += chunk_digest (buf, len, order[i]);
+        bytes += len;
+    }
+    report ("Random:", bytes, secs);
+    free (order);
+
+    if (seq_digest != rnd_digest)
+    {
+        fprintf (stderr, "Sequential and random sweeps differ\n");
+        return -1;
+    }
+    return 0;
+}
+
+static int
+write_image (const char *path, uint64_t used)
+{
+    static uint64_t buf[SWEEP_COUNT * VDISK_SECTOR_SIZE / sizeof (uint64_t)];
+    uint64_t chunks = (used + SWEEP_COUNT - 1) / SWEEP_COUNT;
+    uint64_t written = 0;
+    uint64_t i;
+    size_t len;
+    double start = now ();
+    int fd;
+
+    fd = open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        perror (path);
+        return -1;
+    }
+    for (i = 0; i < chunks; i++)
+    {
+        read_chunk (i, used, buf, &len);
+        if (is_zero (buf, len))
+            continue;
+        if (pwrite (fd, buf, len, i * sizeof (buf)) != (ssize_t) len)
+        {
+            perror (path);
+            close (fd);
+            return -1;
+        }
+        written += len;
+    }
+    if (ftruncate (fd, (off_t) VDISK_COUNT * VDISK_SECTOR_SIZE) != 0)
+    {
+        perror (path);
+        close (fd);
+        return -1;
+    }
+    close (fd);
+    printf ("Wrote %s: %.1f MiB of data, %.3f s\n", path,
+            written / (1024.0 * 1024.0), now () - start);
+    return 0;
+}
+
+static int
+nbd_read (int fd, void *buf, size_t len)
+{
+    uint8_t *p = buf;
+    while (len)
+    {
+        ssize_t n = read (fd, p, len);
+        if (n <= 0)
+            return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int
+nbd_write (int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    while (len)
+    {
+        ssize_t n = write (fd, p, len);
+        if (n <= 0)
+            return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int
+nbd_option_reply (int fd, uint32_t option, uint32_t type,
+                  const void *data, uint32_t len)
+{
+    struct __attribute__ ((packed))
+    {
+        uint64_t magic;
+        uint32_t option;
+        uint32_t type;
+        uint32_t len;
+    } reply =
+    {
+        htobe64 (NBD_REP_MAGIC), htobe32 (option), htobe32 (type),
+        htobe32 (len)
+    };
+    if (nbd_write (fd, &reply, sizeof (reply)) != 0)
+        return -1;
+    return nbd_write (fd, data, len);
+}
+
+/* Negotiate options; returns 0 once the client enters transmission */
+static int
+nbd_handshake (int fd, uint64_t size)
+{
+    static const uint8_t zeroes[124];
+    const uint16_t flags = (NBD_FLAG_HAS_FLAGS | NBD_FLAG_READ_ONLY);
+    struct __attribute__ ((packed))
+    {
+        uint64_t magic;
+        uint64_t opts_magic;
+        uint16_t flags;
+    } hello =
+    {
+        htobe64 (NBD_MAGIC), htobe64 (NBD_OPTS_MAGIC),
+        htobe16 (NBD_FLAG_FIXED_NEWSTYLE | NBD_FLAG_NO_ZEROES)
+    };
+    struct __attribute__ ((packed))
+    {
+        uint64_t magic;
+        uint32_t option;
+        uint32_t len;
+    } opt;
+    struct __attribute__ ((packed))
+    {
+        uint16_t type;
+        uint64_t size;
+        uint16_t flags;
+    } info = { htobe16 (NBD_INFO_EXPORT), htobe64 (size), htobe16 (flags) };
+    struct __attribute__ ((packed))
+    {
+        uint64_t size;
+        uint16_t flags;
+    } export = { htobe64 (size), htobe16 (flags) };
+    uint8_t data[4096];
+    uint32_t client_flags;
+    uint32_t option;
+    uint32_t len;
+
+    if (nbd_write (fd, &hello, sizeof (hello)) != 0 ||
+        nbd_read (fd, &client_flags, sizeof (client_flags)) != 0)
+        return -1;
+    client_flags = be32toh (client_flags);
+
+    while (nbd_read (fd, &opt, sizeof (opt)) == 0)
+    {
+        option = be32toh (opt.option);
+        len = be32toh (opt.len);
+        if (be64toh (opt.magic) != NBD_OPTS_MAGIC || len > sizeof (data) ||
+            nbd_read (fd, data, len) != 0)
+            return -1;
+
+        switch (option)
+        {
+        case NBD_OPT_EXPORT_NAME:
+            if (nbd_write (fd, &export, sizeof (export)) != 0)
+                return -1;
+            if (!(client_flags & NBD_FLAG_NO_ZEROES) &&
+                nbd_write (fd, zeroes, sizeof (zeroes)) != 0)
+                return -1;
+            return 0;
+        case NBD_OPT_INFO:
+        case NBD_OPT_GO:
+            if (nbd_option_reply (fd, option, NBD_REP_INFO, &info,
+                                  sizeof (info)) != 0 ||
+                nbd_option_reply (fd, option, NBD_REP_ACK, NULL, 0) != 0)
+                return -1;
+            if (option == NBD_OPT_GO)
+                return 0;
+            break;
+        case NBD_OPT_ABORT:
+            nbd_option_reply (fd, option, NBD_REP_ACK, NULL, 0);
+            return -1;
+        default:
+            if (nbd_option_reply (fd, option, NBD_REP_ERR_UNSUP,
+                                  NULL, 0) != 0)
+                return -1;
+            break;
+        }
+    }
+    return -1;
+}
+
+static void
+nbd_transmit (int fd, uint64_t size, uint8_t *buf)
+{
+    struct __attribute__ ((packed))
+    {
+        uint32_t magic;
+        uint16_t flags;
+        uint16_t type;
+        uint64_t handle;
+        uint64_t offset;
+        uint32_t len;
+    } req;
+    struct __attribute__ ((packed))
+    {
+        uint32_t magic;
+        uint32_t error;
+        uint64_t handle;
+    } reply;
+    uint64_t offset, lba, end;
+    uint32_t len;
+    uint32_t error;
+
+    while (nbd_read (fd, &req, sizeof (req)) == 0)
+    {
+        if (be32toh (req.magic) != NBD_REQUEST_MAGIC)
+            return;
+        offset = be64toh (req.offset);
+        len = be32toh (req.len);
+        error = 0;
+
+        switch (be16toh (req.type))
+        {
+        case NBD_CMD_READ:
+            if (len > NBD_MAX_READ || offset > size || len > size - offset)
+                error = NBD_EINVAL;
+            break;
+        case NBD_CMD_WRITE:
+            /* Discard the payload */
+            while (len)
+            {
+                uint32_t frag = (len > NBD_MAX_READ) ? NBD_MAX_READ : len;
+                if (nbd_read (fd, buf, frag) != 0)
+                    return;
+                len -= frag;
+            }
+            error = NBD_EPERM;
+            break;
+        case NBD_CMD_DISC:
+            return;
+        case NBD_CMD_FLUSH:
+            break;
+        default:
+            error = NBD_EINVAL;
+            break;
+        }
+
+        reply.magic = htobe32 (NBD_REPLY_MAGIC);
+        reply.error = htobe32 (error);
+        reply.handle = req.handle;
+        if (nbd_write (fd, &reply, sizeof (reply)) != 0)
+            return;
+        if (error || be16toh (req.type) != NBD_CMD_READ || !len)
+            continue;
+
+        lba = offset / VDISK_SECTOR_SIZE;
+        end = (offset + len + VDISK_SECTOR_SIZE - 1) / VDISK_SECTOR_SIZE;
+        vdisk_read (lba, (unsigned int) (end - lba), buf);
+        if (nbd_write (fd, buf + (offset % VDISK_SECTOR_SIZE), len) != 0)
+            return;
+    }
+}
+
+static int
+serve_nbd (const char *path)
+{
+    uint64_t size = (uint64_t) VDISK_COUNT * VDISK_SECTOR_SIZE;
+    struct sockaddr_un addr;
+    uint8_t *buf;
+    int sock;
+    int fd;
+
+    buf = malloc (NBD_MAX_READ + 2 * VDISK_SECTOR_SIZE);
+    if (!buf)
+        die ("out of memory\n");
+    memset (&addr, 0, sizeof (addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen (path) >= sizeof (addr.sun_path))
+        die ("socket path too long: %s\n", path);
+    strcpy (addr.sun_path, path);
+    unlink (path);
+
+    sock = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (sock < 0 || bind (sock, (struct sockaddr *) &addr,
+                          sizeof (addr)) != 0 || listen (sock, 1) != 0)
+    {
+        perror (path);
+        return -1;
+    }
+    printf ("Serving on %s (e.g. nbd-client -unix %s /dev/nbd0)\n",
+            path, path);
+    fflush (stdout);
+
+    while ((fd = accept (sock, NULL, NULL)) >= 0)
+    {
+        if (nbd_handshake (fd, size) == 0)
+            nbd_transmit (fd, size, buf);
+        close (fd);
+    }
+    perror ("accept");
+    close (sock);
+    free (buf);
+    return -1;
+}
+
+static void
+usage (const char *prog)
+{
+    fprintf (stderr,
+             "Usage: %s [-e] [-c CMDLINE] [-o IMAGE] [-n SOCKET] [-b] "
+             "INITRD\n"
+             "  -e          Render as seen under UEFI (default: BIOS)\n"
+             "  -c CMDLINE  ntloader command line\n"
+             "  -o IMAGE    Write the disk as a sparse image\n"
+             "  -n SOCKET   Serve the disk read-only over NBD\n"
+             "  -b          Benchmark sequential and random sweeps "
+             "(default)\n", prog);
+}
+
+int main (int argc, char *argv[])
+{
+    const char *image = NULL;
+    const char *socket_path = NULL;
+    char *cmdline = NULL;
+    int bench = 0;
+    int rc = 0;
+    void *initrd;
+    size_t initrd_len;
+    uint64_t used;
+    double start;
+    unsigned int count;
+    int opt;
+
+    while ((opt = getopt (argc, argv, "ec:o:n:b")) != -1)
+    {
+        switch (opt)
+        {
+        case 'e':
+            efi_systab = &efi_systab;
+            break;
+        case 'c':
+            cmdline = strdup (optarg);
+            break;
+        case 'o':
+            image = optarg;
+            break;
+        case 'n':
+            socket_path = optarg;
+            break;
+        case 'b':
+            bench = 1;
+            break;
+        default:
+            usage (argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind != argc - 1)
+    {
+        usage (argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!image && !socket_path)
+        bench = 1;
+
+    /* Follow extract_initrd() */
+    initrd = load_file (argv[optind], &initrd_len);
+    process_cmdline (cmdline);
+    if (nt_cmdline->num_diskfiles)
+        fprintf (stderr, "Ignoring diskfile= entries\n");
+    start = now ();
+    nt_cmdline->bcd = bcd_raw;
+    nt_cmdline->bcd_length = bcd_raw_len;
+    vdisk_add_file ("BCD", bcd_raw, bcd_raw_len, read_mem_file);
+    if (cpio_extract (initrd, initrd_len, add_file) != 0)
+        die ("could not extract initrd files\n");
+    if (!found_bootmgr)
+        die ("no bootmgr\n");
+    bcd_patch_data ();
+    vdisk_finalise ();
+    used = vdisk_used_count ();
+
+    for (count = 0; vdisk_get_file (count); count++)
+        ;
+    printf ("%u files, %.1f MiB in use, set up in %.3f s\n", count,
+            used * VDISK_SECTOR_SIZE / (1024.0 * 1024.0), now () - start);
+
+    if (image && write_image (image, used) != 0)
+        rc = -1;
+    if (bench && benchmark (used) != 0)
+        rc = -1;
+    if (socket_path && serve_nbd (socket_path) != 0)
+        rc = -1;
+
+    free (cmdline);
+    free (initrd);
+    return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,294 @@
+/*
+ *  ntloader  --  Microsoft Windows NT6+ loader
+ *  Copyright (C) 2025  A1ive.
+ *
+ *  ntloader is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License,
+ *  or (at your option) any later version.
+ *
+ *  ntloader is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with ntloader.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Summarise a vdisk read trace captured from a TRACE=N build, either
+ * from the console, from the 0xe9 debug port (e.g. "qemu -debugcon
+ * file:trace.txt") or from \ntloader.trc on the boot partition.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "trace.h"
+
+#define SECTOR_SIZE 512
+#define HEATMAP_WIDTH 64
+
+struct target
+{
+    char kind;
+    char name[64];
+    uint64_t len;
+    uint64_t reads;
+    uint64_t sectors;
+    uint64_t seq_reads;
+    uint64_t ticks;
+    uint64_t next_offset;
+    uint64_t heat[HEATMAP_WIDTH];
+    uint8_t *touched;
+    uint64_t touched_sectors;
+};
+
+static struct target *targets;
+static size_t num_targets;
+
+static struct target *
+find_target (char kind, const char *name)
+{
+    struct target *target;
+    size_t i;
+
+    for (i = 0; i < num_targets; i++)
+    {
+        target = &targets[i];
+        if (strcmp (target->name, name) == 0 &&
+            (target->kind == kind || target->kind == 0 || kind == 0))
+        {
+            if (kind)
+                target->kind = kind;
+            return target;
+        }
+    }
+    targets = realloc (targets, (num_targets + 1) * sizeof (*targets));
+    if (!targets)
+    {
+        perror ("realloc");
+        exit (EXIT_FAILURE);
+    }
+    target = &targets[num_targets++];
+    memset (target, 0, sizeof (*target));
+    target->kind = kind;
+    snprintf (target->name, sizeof (target->name), "%s", name);
+    target->next_offset = UINT64_MAX;
+    return target;
+}
+
+static void
+touch (struct target *target, uint64_t offset, uint64_t count)
+{
+    uint64_t sectors = (target->len + SECTOR_SIZE - 1) / SECTOR_SIZE;
+    uint64_t width = (sectors < HEATMAP_WIDTH) ? sectors : HEATMAP_WIDTH;
+    uint64_t i;
+
+    if (!sectors)
+        return;
+    if (!target->touched)
+    {
+        target->touched = calloc ((sectors + 7) / 8, 1);
+        if (!target->touched)
+        {
+            perror ("calloc");
+            exit (EXIT_FAILURE);
+        }
+    }
+    for (i = offset; i < offset + count && i < sectors; i++)
+    {
+        if (!(target->touched[i / 8] & (1 << (i % 8))))
+        {
+            target->touched[i / 8] |= (1 << (i % 8));
+            target->touched_sectors++;
+        }
+        target->heat[i * width / sectors]++;
+    }
+}
+
+static int
+compare_ticks (const void *a, const void *b)
+{
+    const struct target *ta = a;
+    const struct target *tb = b;
+
+    if (ta->ticks != tb->ticks)
+        return (ta->ticks < tb->ticks) ? 1 : -1;
+    return (ta->sectors < tb->sectors) ? 1 : (ta->sectors > tb->sectors);
+}
+
+static void
+print_heatmap (const struct target *target)
+{
+    static const char ramp[] = " .:-=+*#%@";
+    uint64_t sectors = (target->len + SECTOR_SIZE - 1) / SECTOR_SIZE;
+    uint64_t width = (sectors < HEATMAP_WIDTH) ? sectors : HEATMAP_WIDTH;
+    uint64_t levels = sizeof (ramp) - 2;
+    uint64_t max = 0;
+    uint64_t i;
+
+    for (i = 0; i < width; i++)
+        if (target->heat[i] > max)
+            max = target->heat[i];
+    printf ("    [");
+    for (i = 0; i < width; i++)
+        putchar (ramp[(target->heat[i] * levels + max - 1) / max]);
+    printf ("]\n");
+}
+
+int main (int argc, char *argv[])
+{
+    FILE *in = stdin;
+    char line[512];
+    uint64_t hz = 0;
+    uint64_t first = 0;
+    uint64_t last = 0;
+    uint64_t total_reads = 0;
+    uint64_t total_sectors = 0;
+    uint64_t total_ticks = 0;
+    uint64_t seq_reads = 0;
+    uint64_t next_lba = UINT64_MAX;
+    size_t i;
+
+    if (argc > 2 || (argc == 2 && argv[1][0] == '-' && argv[1][1]))
+    {
+        fprintf (stderr, "Usage: %s [TRACE_FILE]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc == 2 && strcmp (argv[1], "-") != 0)
+    {
+        in = fopen (argv[1], "r");
+        if (!in)
+        {
+            perror (argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    while (fgets (line, sizeof (line), in))
+    {
+        char *p = strstr (line, TRACE_PREFIX " ");
+        char *end;
+        char kind;
+        uint64_t ts, ticks, lba, count, offset, len;
+        int pos = 0;
+        struct target *target;
+
+        if (!p)
+            continue;
+        p += strlen (TRACE_PREFIX " ");
+        end = p + strcspn (p, "\r\n");
+        *end = '\0';
+        kind = *p;
+
+        if (kind == 'H')
+        {
+            sscanf (p + 1, "%" SCNu64, &hz);
+            continue;
+        }
+        if (kind == 'L')
+        {
+            if (sscanf (p + 1, " %" SCNx64 " %n", &len, &pos) < 1 || !pos)
+                continue;
+            target = find_target (0, p + 1 + pos);
+            target->len = len;
+            continue;
+        }
+        if (kind != TRACE_EMPTY && kind != TRACE_REGION &&
+            kind != TRACE_FILE)
+            continue;
+        if (sscanf (p + 1, " %" SCNx64 " %" SCNx64 " %" SCNx64 " %" SCNx64
+                    " %" SCNx64 " %n", &ts, &ticks, &lba, &count,
+                    &offset, &pos) < 5 || !pos)
+            continue;
+
+        target = find_target (kind, p + 1 + pos);
+        target->reads++;
+        target->sectors += count;
+        target->ticks += ticks;
+        if (offset == target->next_offset)
+            target->seq_reads++;
+        target->next_offset = offset + count;
+        if (kind == TRACE_FILE)
+            touch (target, offset, count);
+
+        if (!total_reads)
+            first = ts;
+        last = ts + ticks;
+        total_reads++;
+        total_sectors += count;
+        total_ticks += ticks;
+        if (lba == next_lba)
+            seq_reads++;
+        next_lba = lba + count;
+    }
+    if (in != stdin)
+        fclose (in);
+
+    if (!total_reads)
+    {
+        fprintf (stderr, "No trace records found\n");
+        return EXIT_FAILURE;
+    }
+
+    printf ("Reads: %" PRIu64 ", sectors: %" PRIu64 " (%.1f MiB), "
+            "sequential: %.1f%%\n", total_reads, total_sectors,
+            (double) total_sectors * SECTOR_SIZE / (1024 * 1024),
+            100.0 * seq_reads / total_reads);
+    if (hz)
+        printf ("Elapsed: %.3f s, in vdisk_read: %.3f s\n",
+                (double) (last - first) / hz, (double) total_ticks / hz);
+    else
+        printf ("Elapsed: %" PRIu64 " ticks, in vdisk_read: %" PRIu64
+                " ticks\n", (last - first), total_ticks);
+
+    qsort (targets, num_targets, sizeof (*targets), compare_ticks);
+    printf ("\n%-4s %-24s %8s %10s %6s %7s %8s %10s\n", "Kind", "Name",
+            "Reads", "KiB", "Seq%", "Cover%", "Reread", "Time");
+    for (i = 0; i < num_targets; i++)
+    {
+        struct target *target = &targets[i];
+        uint64_t sectors = (target->len + SECTOR_SIZE - 1) / SECTOR_SIZE;
+        char time[16];
+
+        if (!target->reads)
+            continue;
+        if (hz)
+            snprintf (time, sizeof (time), "%.2f ms",
+                      1000.0 * target->ticks / hz);
+        else
+            snprintf (time, sizeof (time), "%" PRIu64, target->ticks);
+        printf ("%-4c %-24.24s %8" PRIu64 " %10" PRIu64 " %6.1f",
+                target->kind, target->name, target->reads,
+                target->sectors / 2,
+                100.0 * target->seq_reads / target->reads);
+        if (target->kind == TRACE_FILE && sectors)
+            printf (" %7.1f %8.2f",
+                    100.0 * target->touched_sectors / sectors,
+                    target->touched_sectors ?
+                    (double) target->sectors / target->touched_sectors : 0);
+        else
+            printf (" %7s %8s", "-", "-");
+        printf (" %10s\n", time);
+        if (target->kind == TRACE_FILE && sectors)
+            print_heatmap (target);
+    }
+
+    /* Files that were never read are candidates for removal */
+    for (i = 0; i < num_targets; i++)
+    {
+        if (!targets[i].reads)
+            printf ("Unread: %s (%" PRIu64 " bytes)\n",
+                    targets[i].name, targets[i].len);
+    }
+
+    for (i = 0; i < num_targets; i++)
+        free (targets[i].touched);
+    free (targets);
+    return EXIT_SUCCESS;
+}